@@ -73,6 +73,7 @@ enum iox_AllocationResult
     AllocationResult_INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER,
     AllocationResult_UNDEFINED_ERROR,
     AllocationResult_INVALID_PARAMETER_FOR_CHUNK,
+    AllocationResult_CHUNK_QUOTA_EXCEEDED,
     AllocationResult_SUCCESS,
 };
 
@@ -128,6 +128,69 @@ void iox_pub_release_chunk(iox_pub_t const self, void* const userPayload);
 /// @param[in] userPayload pointer to the user-payload of the chunk which should be send
 void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload);
 
+/// @brief allocates multiple chunks in the shared memory with a single call; either all chunks are allocated or none
+/// @param[in] self handle of the publisher
+/// @param[in] userPayloads array with at least numberOfChunks elements in which the pointers to the user-payloads of
+///            the allocated chunks are stored
+/// @param[in] numberOfChunks number of chunks which should be allocated
+/// @param[in] userPayloadSize user-payload size of every allocated chunk
+/// @return on success it returns AllocationResult_SUCCESS otherwise a value which
+///         describes the error; in this case the chunks which were already allocated by this call are released
+/// @note for the user-payload alignment `IOX_C_CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT` is used
+///       for a custom user-payload alignment please use `iox_pub_loan_aligned_chunks`
+ENUM iox_AllocationResult iox_pub_loan_chunks(iox_pub_t const self,
+                                              void** const userPayloads,
+                                              const uint32_t numberOfChunks,
+                                              const uint32_t userPayloadSize);
+
+/// @brief allocates multiple chunks in the shared memory with a custom alignment for the user-payload; either all
+/// chunks are allocated or none
+/// @param[in] self handle of the publisher
+/// @param[in] userPayloads array with at least numberOfChunks elements in which the pointers to the user-payloads of
+///            the allocated chunks are stored
+/// @param[in] numberOfChunks number of chunks which should be allocated
+/// @param[in] userPayloadSize user-payload size of every allocated chunk
+/// @param[in] userPayloadAlignment user-payload alignment of every allocated chunk
+/// @return on success it returns AllocationResult_SUCCESS otherwise a value which
+///         describes the error; in this case the chunks which were already allocated by this call are released
+ENUM iox_AllocationResult iox_pub_loan_aligned_chunks(iox_pub_t const self,
+                                                      void** const userPayloads,
+                                                      const uint32_t numberOfChunks,
+                                                      const uint32_t userPayloadSize,
+                                                      const uint32_t userPayloadAlignment);
+
+/// @brief allocates multiple chunks in the shared memory with a section for the user-header and a custom alignment
+/// for the user-payload; either all chunks are allocated or none
+/// @param[in] self handle of the publisher
+/// @param[in] userPayloads array with at least numberOfChunks elements in which the pointers to the user-payloads of
+///            the allocated chunks are stored
+/// @param[in] numberOfChunks number of chunks which should be allocated
+/// @param[in] userPayloadSize user-payload size of every allocated chunk
+/// @param[in] userPayloadAlignment user-payload alignment of every allocated chunk
+/// @param[in] userHeaderSize user-header size of every allocated chunk
+/// @param[in] userHeaderAlignment user-header alignment of every allocated chunk
+/// @return on success it returns AllocationResult_SUCCESS otherwise a value which
+///         describes the error; in this case the chunks which were already allocated by this call are released
+ENUM iox_AllocationResult iox_pub_loan_aligned_chunks_with_user_header(iox_pub_t const self,
+                                                                       void** const userPayloads,
+                                                                       const uint32_t numberOfChunks,
+                                                                       const uint32_t userPayloadSize,
+                                                                       const uint32_t userPayloadAlignment,
+                                                                       const uint32_t userHeaderSize,
+                                                                       const uint32_t userHeaderAlignment);
+
+/// @brief releases ownership of multiple previously allocated chunks without sending them
+/// @param[in] self handle of the publisher
+/// @param[in] userPayloads array with the pointers to the user-payloads of the chunks which should be free'd
+/// @param[in] numberOfChunks number of elements in userPayloads
+void iox_pub_release_chunks(iox_pub_t const self, void* const* const userPayloads, const uint32_t numberOfChunks);
+
+/// @brief sends multiple previously allocated chunks in the order of the array
+/// @param[in] self handle of the publisher
+/// @param[in] userPayloads array with the pointers to the user-payloads of the chunks which should be send
+/// @param[in] numberOfChunks number of elements in userPayloads
+void iox_pub_publish_chunks(iox_pub_t const self, void* const* const userPayloads, const uint32_t numberOfChunks);
+
 /// @brief offers the service
 /// @param[in] self handle of the publisher
 void iox_pub_offer(iox_pub_t const self);
@@ -106,6 +106,28 @@ ENUM iox_ChunkReceiveResult iox_sub_take_chunk(iox_sub_t const self, const void*
 /// @param[in] userPayload pointer to the user-payload of chunk which should be released
 void iox_sub_release_chunk(iox_sub_t const self, const void* const userPayload);
 
+/// @brief retrieve up to maxNumberOfChunks received chunks with a single call
+/// @param[in] self handle to the subscriber
+/// @param[in] userPayloads array with at least maxNumberOfChunks elements in which the pointers to the user-payloads
+///            of the chunks are stored in the order of reception
+/// @param[in] maxNumberOfChunks the maximum number of chunks which should be retrieved
+/// @param[out] numberOfTakenChunks the number of chunks which were stored in userPayloads
+/// @return ChunkReceiveResult_SUCCESS if at least one chunk was received and the queue ran empty or maxNumberOfChunks
+///         was reached, otherwise an enum which describes the error
+/// @note numberOfTakenChunks is also valid in the error case and the chunks taken so far must be released as usual
+/// @note a maxNumberOfChunks of 0 does not touch the queue and returns ChunkReceiveResult_SUCCESS with
+///       numberOfTakenChunks set to 0
+ENUM iox_ChunkReceiveResult iox_sub_take_chunks(iox_sub_t const self,
+                                               const void** const userPayloads,
+                                               const uint32_t maxNumberOfChunks,
+                                               uint32_t* const numberOfTakenChunks);
+
+/// @brief release multiple previously acquired chunks (via iox_sub_take_chunk or iox_sub_take_chunks)
+/// @param[in] self handle to the subscriber
+/// @param[in] userPayloads array with the pointers to the user-payloads of the chunks which should be released
+/// @param[in] numberOfChunks number of elements in userPayloads
+void iox_sub_release_chunks(iox_sub_t const self, const void* const* const userPayloads, const uint32_t numberOfChunks);
+
 /// @brief release all chunks which are stored in the chunk queue
 /// @param[in] self handle to the subscriber
 void iox_sub_release_queued_chunks(iox_sub_t const self);
@@ -160,6 +160,81 @@ void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload)
     PublisherPortUser(self->m_portData).sendChunk(ChunkHeader::fromUserPayload(userPayload));
 }
 
+iox_AllocationResult iox_pub_loan_chunks(iox_pub_t const self,
+                                         void** const userPayloads,
+                                         const uint32_t numberOfChunks,
+                                         const uint32_t userPayloadSize)
+{
+    return iox_pub_loan_aligned_chunks_with_user_header(self,
+                                                        userPayloads,
+                                                        numberOfChunks,
+                                                        userPayloadSize,
+                                                        IOX_C_CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                                                        IOX_C_CHUNK_NO_USER_HEADER_SIZE,
+                                                        IOX_C_CHUNK_NO_USER_HEADER_ALIGNMENT);
+}
+
+iox_AllocationResult iox_pub_loan_aligned_chunks(iox_pub_t const self,
+                                                 void** const userPayloads,
+                                                 const uint32_t numberOfChunks,
+                                                 const uint32_t userPayloadSize,
+                                                 const uint32_t userPayloadAlignment)
+{
+    return iox_pub_loan_aligned_chunks_with_user_header(self,
+                                                        userPayloads,
+                                                        numberOfChunks,
+                                                        userPayloadSize,
+                                                        userPayloadAlignment,
+                                                        IOX_C_CHUNK_NO_USER_HEADER_SIZE,
+                                                        IOX_C_CHUNK_NO_USER_HEADER_ALIGNMENT);
+}
+
+iox_AllocationResult iox_pub_loan_aligned_chunks_with_user_header(iox_pub_t const self,
+                                                                  void** const userPayloads,
+                                                                  const uint32_t numberOfChunks,
+                                                                  const uint32_t userPayloadSize,
+                                                                  const uint32_t userPayloadAlignment,
+                                                                  const uint32_t userHeaderSize,
+                                                                  const uint32_t userHeaderAlignment)
+{
+    PublisherPortUser port(self->m_portData);
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        auto result = port.tryAllocateChunk(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment)
+                          .and_then([&](ChunkHeader* h) { userPayloads[i] = h->userPayload(); });
+        if (result.has_error())
+        {
+            // all or nothing; hand back what was loaned by this call so that the caller has nothing to clean up
+            for (uint32_t j = 0U; j < i; ++j)
+            {
+                port.releaseChunk(ChunkHeader::fromUserPayload(userPayloads[j]));
+                userPayloads[j] = nullptr;
+            }
+            return cpp2c::allocationResult(result.get_error());
+        }
+    }
+
+    return AllocationResult_SUCCESS;
+}
+
+void iox_pub_release_chunks(iox_pub_t const self, void* const* const userPayloads, const uint32_t numberOfChunks)
+{
+    PublisherPortUser port(self->m_portData);
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        port.releaseChunk(ChunkHeader::fromUserPayload(userPayloads[i]));
+    }
+}
+
+void iox_pub_publish_chunks(iox_pub_t const self, void* const* const userPayloads, const uint32_t numberOfChunks)
+{
+    PublisherPortUser port(self->m_portData);
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        port.sendChunk(ChunkHeader::fromUserPayload(userPayloads[i]));
+    }
+}
+
 void iox_pub_offer(iox_pub_t const self)
 {
     PublisherPortUser(self->m_portData).offer();
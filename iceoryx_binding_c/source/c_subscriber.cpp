@@ -146,6 +146,47 @@ void iox_sub_release_chunk(iox_sub_t const self, const void* const userPayload)
     SubscriberPortUser(self->m_portData).releaseChunk(ChunkHeader::fromUserPayload(userPayload));
 }
 
+iox_ChunkReceiveResult iox_sub_take_chunks(iox_sub_t const self,
+                                          const void** const userPayloads,
+                                          const uint32_t maxNumberOfChunks,
+                                          uint32_t* const numberOfTakenChunks)
+{
+    *numberOfTakenChunks = 0U;
+    if (maxNumberOfChunks == 0U)
+    {
+        // nothing was requested, therefore this is not reported as an empty queue
+        return ChunkReceiveResult_SUCCESS;
+    }
+
+    SubscriberPortUser port(self->m_portData);
+    while (*numberOfTakenChunks < maxNumberOfChunks)
+    {
+        auto result = port.tryGetChunk();
+        if (result.has_error())
+        {
+            // an empty queue only ends the batch, every other error has to be reported
+            if (*numberOfTakenChunks == 0U || result.get_error() != iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE)
+            {
+                return cpp2c::chunkReceiveResult(result.get_error());
+            }
+            break;
+        }
+        userPayloads[*numberOfTakenChunks] = result.value()->userPayload();
+        ++(*numberOfTakenChunks);
+    }
+
+    return ChunkReceiveResult_SUCCESS;
+}
+
+void iox_sub_release_chunks(iox_sub_t const self, const void* const* const userPayloads, const uint32_t numberOfChunks)
+{
+    SubscriberPortUser port(self->m_portData);
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        port.releaseChunk(ChunkHeader::fromUserPayload(userPayloads[i]));
+    }
+}
+
 void iox_sub_release_queued_chunks(iox_sub_t const self)
 {
     SubscriberPortUser(self->m_portData).releaseQueuedChunks();
@@ -113,6 +113,7 @@ TEST(cpp2c_enum_translation_test, AllocationResult)
          AllocationResult_TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL},
         {iox::popo::AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER,
          AllocationResult_INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER},
+        {iox::popo::AllocationError::CHUNK_QUOTA_EXCEEDED, AllocationResult_CHUNK_QUOTA_EXCEEDED},
         {iox::popo::AllocationError::INVALID_STATE, AllocationResult_UNDEFINED_ERROR}};
 
     for (const auto allocationError : ALLOCATION_ERRORS)
@@ -128,6 +129,9 @@ TEST(cpp2c_enum_translation_test, AllocationResult)
         case iox::popo::AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER:
             EXPECT_EQ(cpp2c::allocationResult(allocationError.cpp), allocationError.c);
             break;
+        case iox::popo::AllocationError::CHUNK_QUOTA_EXCEEDED:
+            EXPECT_EQ(cpp2c::allocationResult(allocationError.cpp), allocationError.c);
+            break;
         case iox::popo::AllocationError::INVALID_STATE:
             EXPECT_EQ(cpp2c::allocationResult(allocationError.cpp), allocationError.c);
             break;
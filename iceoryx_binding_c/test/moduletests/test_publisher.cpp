@@ -321,6 +321,96 @@ TEST_F(iox_pub_test, sendDeliversChunk)
     EXPECT_TRUE(static_cast<DummySample*>(maybeSharedChunk->getUserPayload())->dummy == 4711);
 }
 
+TEST_F(iox_pub_test, allocateChunksIsSuccessful)
+{
+    constexpr uint32_t NUMBER_OF_CHUNKS{3U};
+    void* chunks[NUMBER_OF_CHUNKS] = {nullptr, nullptr, nullptr};
+    ASSERT_EQ(AllocationResult_SUCCESS, iox_pub_loan_chunks(&m_sut, chunks, NUMBER_OF_CHUNKS, sizeof(DummySample)));
+    for (auto chunk : chunks)
+    {
+        EXPECT_NE(chunk, nullptr);
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(iox_pub_test, allocateChunksWithUserHeaderAndUserPayloadAlignmentIsSuccessful)
+{
+    constexpr uint32_t USER_PAYLOAD_ALIGNMENT{32U};
+    constexpr uint32_t USER_HEADER_SIZE{4U};
+    void* chunks[2U] = {nullptr, nullptr};
+    ASSERT_EQ(AllocationResult_SUCCESS,
+              iox_pub_loan_aligned_chunks_with_user_header(
+                  &m_sut, chunks, 2U, sizeof(DummySample), USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, 2U));
+    for (auto chunk : chunks)
+    {
+        EXPECT_THAT(reinterpret_cast<uint64_t>(chunk) % USER_PAYLOAD_ALIGNMENT, Eq(0U));
+        auto chunkHeader = iox_chunk_header_from_user_payload(chunk);
+        EXPECT_NE(iox_chunk_header_to_user_header(chunkHeader), nullptr);
+    }
+}
+
+TEST_F(iox_pub_test, allocateChunksFailsAndReleasesAllChunksWhenExceedingTheChunksAllocatedInParallel)
+{
+    void* chunk = nullptr;
+    ASSERT_EQ(AllocationResult_SUCCESS, iox_pub_loan_chunk(&m_sut, &chunk, 100));
+
+    void* chunks[iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY];
+    EXPECT_EQ(AllocationResult_TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL,
+              iox_pub_loan_chunks(&m_sut, chunks, iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY, 100));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+}
+
+TEST_F(iox_pub_test, allocateChunksFailsAndReleasesAllChunksWhenOutOfChunks)
+{
+    constexpr uint32_t NUMBER_OF_REMAINING_CHUNKS{2U};
+    std::vector<SharedChunk> chunkBucket;
+    while (chunkBucket.size() < NUM_CHUNKS_IN_POOL - NUMBER_OF_REMAINING_CHUNKS)
+    {
+        auto chunkSettingsResult = ChunkSettings::create(100U, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        ASSERT_FALSE(chunkSettingsResult.has_error());
+        auto sharedChunk = m_memoryManager.getChunk(chunkSettingsResult.value());
+        ASSERT_TRUE(sharedChunk);
+        chunkBucket.emplace_back(sharedChunk);
+    }
+
+    void* chunks[NUMBER_OF_REMAINING_CHUNKS + 1U];
+    EXPECT_EQ(AllocationResult_RUNNING_OUT_OF_CHUNKS,
+              iox_pub_loan_chunks(&m_sut, chunks, NUMBER_OF_REMAINING_CHUNKS + 1U, 100));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUM_CHUNKS_IN_POOL - NUMBER_OF_REMAINING_CHUNKS));
+}
+
+TEST_F(iox_pub_test, freeingAllocatedChunksReleasesTheMemory)
+{
+    void* chunks[3U];
+    ASSERT_EQ(AllocationResult_SUCCESS, iox_pub_loan_chunks(&m_sut, chunks, 3U, 100));
+    iox_pub_release_chunks(&m_sut, chunks, 3U);
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(iox_pub_test, sendChunksDeliversChunksInOrder)
+{
+    constexpr uint32_t NUMBER_OF_CHUNKS{3U};
+    void* chunks[NUMBER_OF_CHUNKS];
+    iox_pub_offer(&m_sut);
+    this->Subscribe(&m_publisherPortData);
+    ASSERT_EQ(AllocationResult_SUCCESS, iox_pub_loan_chunks(&m_sut, chunks, NUMBER_OF_CHUNKS, sizeof(DummySample)));
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        static_cast<DummySample*>(chunks[i])->dummy = 4711U + i;
+    }
+    iox_pub_publish_chunks(&m_sut, chunks, NUMBER_OF_CHUNKS);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> m_chunkQueuePopper(&m_chunkQueueData);
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = m_chunkQueuePopper.tryPop();
+        ASSERT_TRUE(maybeSharedChunk.has_value());
+        EXPECT_TRUE(*maybeSharedChunk == chunks[i]);
+        EXPECT_THAT(static_cast<DummySample*>(maybeSharedChunk->getUserPayload())->dummy, Eq(4711U + i));
+    }
+    EXPECT_FALSE(m_chunkQueuePopper.tryPop().has_value());
+}
+
 TEST_F(iox_pub_test, correctServiceDescriptionReturned)
 {
     auto serviceDescription = iox_pub_get_service_description(&m_sut);
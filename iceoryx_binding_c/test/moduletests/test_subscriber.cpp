@@ -294,6 +294,113 @@ TEST_F(iox_sub_test, releaseChunkQueuedChunksWorks)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(iox_sub_test, takeChunksWhenNoChunksAvailableFails)
+{
+    const void* chunks[3U] = {nullptr, nullptr, nullptr};
+    uint32_t numberOfTakenChunks{42U};
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, 3U, &numberOfTakenChunks), ChunkReceiveResult_NO_CHUNK_AVAILABLE);
+    EXPECT_THAT(numberOfTakenChunks, Eq(0U));
+}
+
+TEST_F(iox_sub_test, takeChunksWithZeroMaximumSucceedsWithoutTakingAChunk)
+{
+    this->Subscribe(&m_portPtr);
+    m_chunkPusher.push(getChunkFromMemoryManager());
+
+    const void* chunks[1U] = {nullptr};
+    uint32_t numberOfTakenChunks{42U};
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, 0U, &numberOfTakenChunks), ChunkReceiveResult_SUCCESS);
+    EXPECT_THAT(numberOfTakenChunks, Eq(0U));
+    EXPECT_THAT(chunks[0U], Eq(nullptr));
+    EXPECT_TRUE(iox_sub_has_chunks(m_sut));
+}
+
+TEST_F(iox_sub_test, takeChunksWithZeroMaximumSucceedsWhenNoChunksAvailable)
+{
+    const void* chunks[1U] = {nullptr};
+    uint32_t numberOfTakenChunks{42U};
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, 0U, &numberOfTakenChunks), ChunkReceiveResult_SUCCESS);
+    EXPECT_THAT(numberOfTakenChunks, Eq(0U));
+}
+
+TEST_F(iox_sub_test, takeChunksReceivesAllAvailableChunksInOrder)
+{
+    this->Subscribe(&m_portPtr);
+    constexpr uint32_t NUMBER_OF_CHUNKS{3U};
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        *static_cast<uint32_t*>(sharedChunk.getUserPayload()) = i;
+        m_chunkPusher.push(sharedChunk);
+    }
+
+    const void* chunks[NUMBER_OF_CHUNKS + 2U];
+    uint32_t numberOfTakenChunks{0U};
+    ASSERT_EQ(iox_sub_take_chunks(m_sut, chunks, NUMBER_OF_CHUNKS + 2U, &numberOfTakenChunks),
+              ChunkReceiveResult_SUCCESS);
+    ASSERT_THAT(numberOfTakenChunks, Eq(NUMBER_OF_CHUNKS));
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(*static_cast<const uint32_t*>(chunks[i]), Eq(i));
+    }
+}
+
+TEST_F(iox_sub_test, takeChunksReceivesAtMostTheRequestedNumberOfChunks)
+{
+    this->Subscribe(&m_portPtr);
+    for (uint32_t i = 0U; i < 3U; ++i)
+    {
+        m_chunkPusher.push(getChunkFromMemoryManager());
+    }
+
+    const void* chunks[2U];
+    uint32_t numberOfTakenChunks{0U};
+    ASSERT_EQ(iox_sub_take_chunks(m_sut, chunks, 2U, &numberOfTakenChunks), ChunkReceiveResult_SUCCESS);
+    EXPECT_THAT(numberOfTakenChunks, Eq(2U));
+    EXPECT_TRUE(iox_sub_has_chunks(m_sut));
+}
+
+TEST_F(iox_sub_test, takeChunksReportsTooManyChunksHeldWithTheNumberOfTakenChunks)
+{
+    this->Subscribe(&m_portPtr);
+    const void* chunk = nullptr;
+    for (uint64_t i = 0U; i < MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY; ++i)
+    {
+        m_chunkPusher.push(getChunkFromMemoryManager());
+    }
+    for (uint64_t i = 0U; i < MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY; ++i)
+    {
+        ASSERT_EQ(iox_sub_take_chunk(m_sut, &chunk), ChunkReceiveResult_SUCCESS);
+    }
+    m_chunkPusher.push(getChunkFromMemoryManager());
+    m_chunkPusher.push(getChunkFromMemoryManager());
+
+    // the subscriber can hold one chunk more than MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY
+    const void* chunks[2U] = {nullptr, nullptr};
+    uint32_t numberOfTakenChunks{0U};
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, 2U, &numberOfTakenChunks),
+              ChunkReceiveResult_TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    EXPECT_THAT(numberOfTakenChunks, Eq(1U));
+    EXPECT_NE(chunks[0U], nullptr);
+}
+
+TEST_F(iox_sub_test, releaseChunksWorks)
+{
+    this->Subscribe(&m_portPtr);
+    for (uint32_t i = 0U; i < 3U; ++i)
+    {
+        m_chunkPusher.push(getChunkFromMemoryManager());
+    }
+
+    const void* chunks[3U];
+    uint32_t numberOfTakenChunks{0U};
+    ASSERT_EQ(iox_sub_take_chunks(m_sut, chunks, 3U, &numberOfTakenChunks), ChunkReceiveResult_SUCCESS);
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(3U));
+    iox_sub_release_chunks(m_sut, chunks, numberOfTakenChunks);
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 TEST_F(iox_sub_test, initialStateHasNewChunksFalse)
 {
     EXPECT_FALSE(iox_sub_has_chunks(m_sut));
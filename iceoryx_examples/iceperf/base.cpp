@@ -16,16 +16,41 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "base.hpp"
 
+#include "iceoryx_hoofs/platform/pthread.hpp"
 
-void IcePerfBase::preLatencyPerfTestLeader(const uint32_t payloadSizeInBytes) noexcept
+double ThroughputMeasurement::messagesPerSecond() const noexcept
 {
-    sendPerfTopic(payloadSizeInBytes, RunFlag::RUN);
+    auto durationInSeconds = static_cast<double>(duration.toNanoseconds()) / 1.0e9;
+    return (durationInSeconds > 0.0) ? static_cast<double>(numberOfMessages) / durationInSeconds : 0.0;
 }
 
-void IcePerfBase::postLatencyPerfTestLeader() noexcept
+double ThroughputMeasurement::gigabytesPerSecond() const noexcept
 {
-    // Wait for the last response
-    receivePerfTopic();
+    return messagesPerSecond() * static_cast<double>(payloadSizeInBytes) / 1.0e9;
+}
+
+bool setCpuAffinity(const int32_t cpu, std::thread::native_handle_type nativeHandle) noexcept
+{
+    if (cpu < 0)
+    {
+        return true;
+    }
+#ifdef __linux__
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(static_cast<uint32_t>(cpu), &cpuset);
+    auto retVal = pthread_setaffinity_np(nativeHandle, sizeof(cpu_set_t), &cpuset);
+    if (retVal != 0)
+    {
+        std::cerr << "Could not pin thread to CPU " << cpu << ", error: " << retVal << std::endl;
+        return false;
+    }
+    return true;
+#else
+    static_cast<void>(nativeHandle);
+    std::cerr << "Pinning threads to a CPU is not supported on this platform!" << std::endl;
+    return false;
+#endif
 }
 
 void IcePerfBase::releaseFollower() noexcept
@@ -33,38 +58,70 @@ void IcePerfBase::releaseFollower() noexcept
     sendPerfTopic(sizeof(PerfTopic), RunFlag::STOP);
 }
 
-iox::units::Duration IcePerfBase::latencyPerfTestLeader(const uint64_t numRoundTrips) noexcept
+LatencyHistogram IcePerfBase::latencyPerfTestLeader(const uint32_t payloadSizeInBytes,
+                                                    const uint64_t numRoundTrips) noexcept
 {
-    auto start = std::chrono::high_resolution_clock::now();
+    constexpr uint64_t TRANSMISSIONS_PER_ROUNDTRIP{2U};
+    LatencyHistogram latencies;
 
     // run the performance test
     for (auto i = 0U; i < numRoundTrips; ++i)
     {
-        auto perfTopic = receivePerfTopic();
-        sendPerfTopic(perfTopic.payloadSize, RunFlag::RUN);
+        auto start = std::chrono::steady_clock::now();
+        sendPerfTopic(payloadSizeInBytes, RunFlag::RUN);
+        receivePerfTopic();
+        auto finish = std::chrono::steady_clock::now();
+
+        auto roundTrip = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start);
+        latencies.record(static_cast<uint64_t>(roundTrip.count()) / TRANSMISSIONS_PER_ROUNDTRIP);
+    }
+
+    return latencies;
+}
+
+ThroughputMeasurement IcePerfBase::throughputPerfTestLeader(const uint32_t payloadSizeInBytes,
+                                                            const uint64_t numberOfSamples) noexcept
+{
+    auto start = std::chrono::steady_clock::now();
+
+    for (auto i = 1U; i < numberOfSamples; ++i)
+    {
+        sendPerfTopic(payloadSizeInBytes, RunFlag::BURST);
     }
+    sendPerfTopic(payloadSizeInBytes, RunFlag::BURST_END);
 
-    auto finish = std::chrono::high_resolution_clock::now();
+    // the acknowledgement of the follower guarantees that all samples were received
+    receivePerfTopic();
 
-    constexpr uint64_t TRANSMISSIONS_PER_ROUNDTRIP{2U};
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start);
-    auto latencyInNanoSeconds =
-        (static_cast<uint64_t>(duration.count()) / (numRoundTrips * TRANSMISSIONS_PER_ROUNDTRIP));
-    return iox::units::Duration::fromNanoseconds(latencyInNanoSeconds);
+    auto finish = std::chrono::steady_clock::now();
+
+    ThroughputMeasurement measurement;
+    measurement.numberOfMessages = numberOfSamples;
+    measurement.payloadSizeInBytes = payloadSizeInBytes;
+    measurement.duration = iox::units::Duration::fromNanoseconds(
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count()));
+    return measurement;
 }
 
-void IcePerfBase::latencyPerfTestFollower() noexcept
+void IcePerfBase::perfTestFollower() noexcept
 {
     while (true)
     {
         auto perfTopic = receivePerfTopic();
 
-        // stop replying when no more run
-        if (perfTopic.runFlag == RunFlag::STOP)
+        switch (perfTopic.runFlag)
         {
+        case RunFlag::STOP:
+            // stop replying when no more run
+            return;
+        case RunFlag::RUN:
+            sendPerfTopic(perfTopic.payloadSize, RunFlag::RUN);
+            break;
+        case RunFlag::BURST:
+            break;
+        case RunFlag::BURST_END:
+            sendPerfTopic(sizeof(PerfTopic), RunFlag::RUN);
             break;
         }
-
-        sendPerfTopic(perfTopic.payloadSize, RunFlag::RUN);
     }
 }
@@ -18,12 +18,30 @@
 #define IOX_EXAMPLES_ICEPERF_BASE_HPP
 
 #include "example_common.hpp"
+#include "latency_histogram.hpp"
 #include "topic_data.hpp"
 
 #include "iceoryx_hoofs/internal/units/duration.hpp"
 
 #include <chrono>
 #include <iostream>
+#include <thread>
+
+struct ThroughputMeasurement
+{
+    uint64_t numberOfMessages{0U};
+    uint32_t payloadSizeInBytes{0U};
+    iox::units::Duration duration{iox::units::Duration::fromNanoseconds(0U)};
+
+    double messagesPerSecond() const noexcept;
+    double gigabytesPerSecond() const noexcept;
+};
+
+/// @brief Pins a thread to a CPU; only supported on Linux, on other platforms a warning is printed
+/// @param[in] cpu the CPU the thread shall run on, a negative value leaves the affinity untouched
+/// @param[in] nativeHandle the native handle of the thread
+/// @return true if the affinity was set or nothing had to be done, otherwise false
+bool setCpuAffinity(const int32_t cpu, std::thread::native_handle_type nativeHandle) noexcept;
 
 class IcePerfBase
 {
@@ -36,11 +54,17 @@ class IcePerfBase
     virtual void initFollower() noexcept = 0;
     virtual void shutdown() noexcept = 0;
 
-    void preLatencyPerfTestLeader(const uint32_t payloadSizeInBytes) noexcept;
-    void postLatencyPerfTestLeader() noexcept;
     void releaseFollower() noexcept;
-    iox::units::Duration latencyPerfTestLeader(const uint64_t numRoundTrips) noexcept;
-    void latencyPerfTestFollower() noexcept;
+
+    /// @brief Measures every round trip with the follower and records half of it as latency of a single transmission
+    LatencyHistogram latencyPerfTestLeader(const uint32_t payloadSizeInBytes, const uint64_t numRoundTrips) noexcept;
+
+    /// @brief Sends the samples back-to-back and stops the time when the follower acknowledged the last one
+    ThroughputMeasurement throughputPerfTestLeader(const uint32_t payloadSizeInBytes,
+                                                   const uint64_t numberOfSamples) noexcept;
+
+    /// @brief Serves the latency and the throughput measurement of the leader until it is released
+    void perfTestFollower() noexcept;
 
   private:
     virtual void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept = 0;
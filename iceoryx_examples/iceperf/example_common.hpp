@@ -21,7 +21,9 @@ enum class Benchmark
 {
     ALL,
     LATENCY,
-    THROUGHPUT
+    THROUGHPUT,
+    FAN_OUT,
+    FAN_IN
 };
 
 enum class Technology
@@ -36,7 +38,18 @@ enum class Technology
 enum class RunFlag
 {
     STOP,
-    RUN
+    RUN,
+    /// @brief the follower only receives the sample, used for the throughput measurement
+    BURST,
+    /// @brief the last sample of a burst, the follower acknowledges the burst with a reply
+    BURST_END
+};
+
+enum class OutputFormat
+{
+    TABLE,
+    CSV,
+    JSON
 };
 
 #endif
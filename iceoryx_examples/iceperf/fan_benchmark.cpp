@@ -0,0 +1,178 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "fan_benchmark.hpp"
+
+#include <chrono>
+#include <thread>
+
+namespace
+{
+struct FanTopic
+{
+    uint64_t sendTimestampInNanoseconds{0U};
+};
+
+/// @brief small enough that the in-flight samples of all endpoints do not exhaust the largest mempool
+constexpr uint64_t QUEUE_CAPACITY{4U};
+
+uint64_t nowInNanoseconds() noexcept
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+} // namespace
+
+IcePerfFan::IcePerfFan(const Benchmark mode, const PerfSettings& settings) noexcept
+    : m_mode(mode)
+    , m_settings(settings)
+{
+    const iox::capro::IdString_t event{iox::cxx::TruncateToCapacity,
+                                       (m_mode == Benchmark::FAN_OUT) ? "FanOut" : "FanIn"};
+    const iox::capro::ServiceDescription serviceDescription{"IcePerf", event, "C++-API"};
+    const uint32_t numberOfPublishers = (m_mode == Benchmark::FAN_OUT) ? 1U : m_settings.fanDegree;
+    const uint32_t numberOfSubscribers = (m_mode == Benchmark::FAN_OUT) ? m_settings.fanDegree : 1U;
+
+    // no sample must be lost, otherwise the subscribers would wait forever
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.subscriberTooSlowPolicy = iox::popo::SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER;
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = QUEUE_CAPACITY;
+    subscriberOptions.queueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PUBLISHER;
+
+    for (uint32_t i = 0U; i < numberOfPublishers; ++i)
+    {
+        m_publishers.emplace_back(new iox::popo::UntypedPublisher(serviceDescription, publisherOptions));
+    }
+    for (uint32_t i = 0U; i < numberOfSubscribers; ++i)
+    {
+        m_subscribers.emplace_back(new iox::popo::UntypedSubscriber(serviceDescription, subscriberOptions));
+    }
+
+    std::cout << "Waiting for: subscription" << std::flush;
+    for (auto& subscriber : m_subscribers)
+    {
+        while (subscriber->getSubscriptionState() != iox::SubscribeState::SUBSCRIBED)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    std::cout << ", subscriber" << std::flush;
+    for (auto& publisher : m_publishers)
+    {
+        while (!publisher->hasSubscribers())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    std::cout << " [ success ]" << std::endl;
+}
+
+IcePerfFan::Result IcePerfFan::measure(const uint32_t payloadSizeInBytes) noexcept
+{
+    const uint64_t samplesPerSubscriber = m_settings.numberOfSamples * m_publishers.size();
+    std::vector<LatencyHistogram> latencies(m_subscribers.size());
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+
+    if (m_mode == Benchmark::FAN_OUT)
+    {
+        for (uint32_t i = 0U; i < m_subscribers.size(); ++i)
+        {
+            threads.emplace_back([&, i] { receive(*m_subscribers[i], samplesPerSubscriber, latencies[i]); });
+        }
+    }
+    else
+    {
+        for (uint32_t i = 0U; i < m_publishers.size(); ++i)
+        {
+            threads.emplace_back([&, i] { send(*m_publishers[i], payloadSizeInBytes); });
+        }
+    }
+
+    if (m_settings.followerCpu >= 0)
+    {
+        for (uint32_t i = 0U; i < threads.size(); ++i)
+        {
+            setCpuAffinity(m_settings.followerCpu + static_cast<int32_t>(i), threads[i].native_handle());
+        }
+    }
+
+    if (m_mode == Benchmark::FAN_OUT)
+    {
+        send(*m_publishers.front(), payloadSizeInBytes);
+    }
+    else
+    {
+        receive(*m_subscribers.front(), samplesPerSubscriber, latencies.front());
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    auto finish = std::chrono::steady_clock::now();
+
+    Result result;
+    for (const auto& latency : latencies)
+    {
+        result.latency.merge(latency);
+    }
+    result.throughput.numberOfMessages = samplesPerSubscriber * m_subscribers.size();
+    result.throughput.payloadSizeInBytes = payloadSizeInBytes;
+    result.throughput.duration = iox::units::Duration::fromNanoseconds(
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count()));
+    return result;
+}
+
+void IcePerfFan::send(iox::popo::UntypedPublisher& publisher, const uint32_t payloadSizeInBytes) noexcept
+{
+    for (uint64_t i = 0U; i < m_settings.numberOfSamples; ++i)
+    {
+        bool isPublished{false};
+        while (!isPublished)
+        {
+            // loaning fails temporarily when the subscribers still hold all chunks of the mempool
+            publisher.loan(payloadSizeInBytes)
+                .and_then([&](auto& userPayload) {
+                    static_cast<FanTopic*>(userPayload)->sendTimestampInNanoseconds = nowInNanoseconds();
+                    publisher.publish(userPayload);
+                    isPublished = true;
+                })
+                .or_else([](auto&) { std::this_thread::yield(); });
+        }
+    }
+}
+
+void IcePerfFan::receive(iox::popo::UntypedSubscriber& subscriber,
+                         const uint64_t numberOfSamples,
+                         LatencyHistogram& latencies) noexcept
+{
+    uint64_t numberOfReceivedSamples{0U};
+    while (numberOfReceivedSamples < numberOfSamples)
+    {
+        subscriber.take().and_then([&](const void* userPayload) {
+            auto receiveTimestamp = nowInNanoseconds();
+            latencies.record(receiveTimestamp - static_cast<const FanTopic*>(userPayload)->sendTimestampInNanoseconds);
+            subscriber.release(userPayload);
+            ++numberOfReceivedSamples;
+        });
+    }
+}
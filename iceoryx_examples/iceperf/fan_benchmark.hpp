@@ -0,0 +1,67 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_EXAMPLES_ICEPERF_FAN_BENCHMARK_HPP
+#define IOX_EXAMPLES_ICEPERF_FAN_BENCHMARK_HPP
+
+#include "base.hpp"
+#include "latency_histogram.hpp"
+#include "topic_data.hpp"
+
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+
+#include <memory>
+#include <vector>
+
+/// @brief Measures the distribution of samples from one publisher to many subscribers (fan-out) and from many
+/// publishers to one subscriber (fan-in). All endpoints are created within the leader application with the C++ API
+/// and the side with many endpoints is served by one thread per endpoint. The single endpoint runs in the calling
+/// thread, the threads of the other endpoints are pinned to consecutive CPUs starting with the follower CPU.
+/// Every sample carries its send time, therefore the latency is the one-way latency observed by the subscribers.
+class IcePerfFan
+{
+  public:
+    struct Result
+    {
+        LatencyHistogram latency;
+        ThroughputMeasurement throughput;
+    };
+
+    /// @brief Creates the endpoints and waits until all of them are connected
+    /// @param[in] mode is either Benchmark::FAN_OUT or Benchmark::FAN_IN
+    /// @param[in] settings provide the number of endpoints, samples and the CPU pinning
+    IcePerfFan(const Benchmark mode, const PerfSettings& settings) noexcept;
+
+    /// @brief Every publisher sends the number of samples from the settings to all subscribers
+    /// @param[in] payloadSizeInBytes the size of the samples
+    /// @return the latencies of all received samples and the number of received samples per second
+    Result measure(const uint32_t payloadSizeInBytes) noexcept;
+
+  private:
+    void send(iox::popo::UntypedPublisher& publisher, const uint32_t payloadSizeInBytes) noexcept;
+    void receive(iox::popo::UntypedSubscriber& subscriber,
+                 const uint64_t numberOfSamples,
+                 LatencyHistogram& latencies) noexcept;
+
+  private:
+    const Benchmark m_mode;
+    const PerfSettings m_settings;
+    std::vector<std::unique_ptr<iox::popo::UntypedPublisher>> m_publishers;
+    std::vector<std::unique_ptr<iox::popo::UntypedSubscriber>> m_subscribers;
+};
+
+#endif // IOX_EXAMPLES_ICEPERF_FAN_BENCHMARK_HPP
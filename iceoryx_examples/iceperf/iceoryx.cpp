@@ -20,9 +20,33 @@
 #include <chrono>
 #include <thread>
 
+namespace
+{
+/// @brief the publisher is blocked instead of discarding samples to not lose any sample in the throughput
+/// measurement; the capacity is small enough that a burst does not exhaust the chunks of the largest mempool
+constexpr uint64_t QUEUE_CAPACITY{4U};
+
+iox::popo::PublisherOptions publisherOptions() noexcept
+{
+    iox::popo::PublisherOptions options;
+    options.historyCapacity = 1U;
+    options.subscriberTooSlowPolicy = iox::popo::SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER;
+    return options;
+}
+
+iox::popo::SubscriberOptions subscriberOptions() noexcept
+{
+    iox::popo::SubscriberOptions options;
+    options.queueCapacity = QUEUE_CAPACITY;
+    options.historyRequest = 1U;
+    options.queueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PUBLISHER;
+    return options;
+}
+} // namespace
+
 Iceoryx::Iceoryx(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept
-    : m_publisher({"IcePerf", publisherName, "C++-API"}, iox::popo::PublisherOptions{1U})
-    , m_subscriber({"IcePerf", subscriberName, "C++-API"}, iox::popo::SubscriberOptions{1U, 1U})
+    : m_publisher({"IcePerf", publisherName, "C++-API"}, publisherOptions())
+    , m_subscriber({"IcePerf", subscriberName, "C++-API"}, subscriberOptions())
 {
 }
 
@@ -24,11 +24,14 @@ IceoryxC::IceoryxC(const iox::capro::IdString_t& publisherName, const iox::capro
     iox_pub_options_t publisherOptions;
     iox_pub_options_init(&publisherOptions);
     publisherOptions.historyCapacity = 1U;
+    // block instead of discarding samples to not lose any sample in the throughput measurement
+    publisherOptions.subscriberTooSlowPolicy = SubscriberTooSlowPolicy_WAIT_FOR_SUBSCRIBER;
     m_publisher = iox_pub_init(&m_publisherStorage, "IcePerf", publisherName.c_str(), "C-API", &publisherOptions);
 
     iox_sub_options_t subscriberOptions;
     iox_sub_options_init(&subscriberOptions);
-    subscriberOptions.queueCapacity = 1U;
+    subscriberOptions.queueCapacity = 4U;
+    subscriberOptions.queueFullPolicy = QueueFullPolicy_BLOCK_PUBLISHER;
     subscriberOptions.historyRequest = 1U;
     m_subscriber = iox_sub_init(&m_subscriberStorage, "IcePerf", subscriberName.c_str(), "C-API", &subscriberOptions);
 }
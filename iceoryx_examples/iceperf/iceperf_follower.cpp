@@ -36,7 +36,7 @@ void IcePerfFollower::doMeasurement(IcePerfBase& ipcTechnology) noexcept
 {
     ipcTechnology.initFollower();
 
-    ipcTechnology.latencyPerfTestFollower();
+    ipcTechnology.perfTestFollower();
 
     ipcTechnology.shutdown();
 }
@@ -84,6 +84,18 @@ int IcePerfFollower::run() noexcept
     m_settings = getSettings(settingsSubscriber);
     //! [get settings from leader]
 
+    if (!setCpuAffinity(m_settings.followerCpu, pthread_self()))
+    {
+        return EXIT_FAILURE;
+    }
+
+    // the fan-out and fan-in benchmarks are done by the leader alone
+    if (m_settings.benchmark == Benchmark::FAN_OUT || m_settings.benchmark == Benchmark::FAN_IN)
+    {
+        std::cout << "Nothing to do for the selected benchmark!" << std::endl;
+        return EXIT_SUCCESS;
+    }
+
     //! [create an run technologies]
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::POSIX_MESSAGE_QUEUE)
     {
@@ -14,8 +14,8 @@
 // limitations under the License.
 //
 // SPDX-License-Identifier: Apache-2.0
-
 #include "iceperf_leader.hpp"
+#include "fan_benchmark.hpp"
 #include "iceoryx.hpp"
 #include "iceoryx_c.hpp"
 #include "iceoryx_hoofs/cxx/convert.hpp"
@@ -26,6 +26,7 @@
 #include "topic_data.hpp"
 #include "uds.hpp"
 
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <vector>
@@ -36,8 +37,33 @@ constexpr const char PUBLISHER[]{"Leader"};
 constexpr const char SUBSCRIBER[]{"Follower"};
 //! [use constants instead of magic values]
 
-IcePerfLeader::IcePerfLeader(const PerfSettings settings) noexcept
+namespace
+{
+const std::vector<uint32_t> PAYLOAD_SIZES_IN_KB{1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
+constexpr const char LATENCY[]{"latency"};
+constexpr const char THROUGHPUT[]{"throughput"};
+constexpr const char FAN_OUT[]{"fan-out"};
+constexpr const char FAN_IN[]{"fan-in"};
+
+struct Percentile
+{
+    const char* name;
+    double value;
+};
+const std::vector<Percentile> PERCENTILES{{"p50", 50.0}, {"p90", 90.0}, {"p99", 99.0}, {"p99.9", 99.9}};
+
+double toMicroseconds(const uint64_t nanoseconds) noexcept
+{
+    return static_cast<double>(nanoseconds) / 1000.0;
+}
+} // namespace
+
+IcePerfLeader::IcePerfLeader(const PerfSettings settings,
+                             const OutputFormat outputFormat,
+                             const std::string& resultFile) noexcept
     : m_settings(settings)
+    , m_outputFormat(outputFormat)
+    , m_resultFile(resultFile)
 {
     //! [cleanup outdated resources]
 #ifndef __APPLE__
@@ -47,28 +73,43 @@ IcePerfLeader::IcePerfLeader(const PerfSettings settings) noexcept
     //! [cleanup outdated resources]
 }
 
+bool IcePerfLeader::isBenchmarkSelected(const Benchmark benchmark) const noexcept
+{
+    return m_settings.benchmark == Benchmark::ALL || m_settings.benchmark == benchmark;
+}
+
 //! [do the measurement for a single technology]
-void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
+void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology, const std::string& technology) noexcept
 {
     ipcTechnology.initLeader();
 
-    std::vector<std::tuple<uint32_t, iox::units::Duration>> latencyMeasurements;
-    const std::vector<uint32_t> payloadSizesInKB{1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
     std::cout << "Measurement for:";
     const char* separator = " ";
-    for (const auto payloadSizeInKB : payloadSizesInKB)
+    for (const auto payloadSizeInKB : PAYLOAD_SIZES_IN_KB)
     {
         std::cout << separator << payloadSizeInKB << " kB" << std::flush;
         separator = ", ";
         auto payloadSizeInBytes = payloadSizeInKB * IcePerfBase::ONE_KILOBYTE;
 
-        ipcTechnology.preLatencyPerfTestLeader(payloadSizeInBytes);
-
-        auto latency = ipcTechnology.latencyPerfTestLeader(m_settings.numberOfSamples);
-
-        latencyMeasurements.push_back(std::make_tuple(payloadSizeInKB, latency));
+        if (isBenchmarkSelected(Benchmark::LATENCY))
+        {
+            MeasurementResult result;
+            result.technology = technology;
+            result.benchmark = LATENCY;
+            result.payloadSizeInKB = payloadSizeInKB;
+            result.latency = ipcTechnology.latencyPerfTestLeader(payloadSizeInBytes, m_settings.numberOfSamples);
+            m_results.push_back(result);
+        }
 
-        ipcTechnology.postLatencyPerfTestLeader();
+        if (isBenchmarkSelected(Benchmark::THROUGHPUT))
+        {
+            MeasurementResult result;
+            result.technology = technology;
+            result.benchmark = THROUGHPUT;
+            result.payloadSizeInKB = payloadSizeInKB;
+            result.throughput = ipcTechnology.throughputPerfTestLeader(payloadSizeInBytes, m_settings.numberOfSamples);
+            m_results.push_back(result);
+        }
     }
     std::cout << std::endl;
 
@@ -76,30 +117,275 @@ void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
 
     ipcTechnology.shutdown();
 
+    printTable(technology, LATENCY);
+    printTable(technology, THROUGHPUT);
+}
+//! [do the measurement for a single technology]
+
+void IcePerfLeader::doFanMeasurement(const Benchmark mode) noexcept
+{
+    const std::string benchmark = (mode == Benchmark::FAN_OUT) ? FAN_OUT : FAN_IN;
+    IcePerfFan fan(mode, m_settings);
+
+    std::cout << "Measurement for:";
+    const char* separator = " ";
+    for (const auto payloadSizeInKB : PAYLOAD_SIZES_IN_KB)
+    {
+        std::cout << separator << payloadSizeInKB << " kB" << std::flush;
+        separator = ", ";
+
+        auto fanResult = fan.measure(payloadSizeInKB * IcePerfBase::ONE_KILOBYTE);
+
+        MeasurementResult result;
+        result.technology = "iceoryx-cpp-api";
+        result.benchmark = benchmark;
+        result.payloadSizeInKB = payloadSizeInKB;
+        result.latency = fanResult.latency;
+        result.throughput = fanResult.throughput;
+        m_results.push_back(result);
+    }
+    std::cout << std::endl;
+
+    printTable("iceoryx-cpp-api", benchmark);
+}
+
+void IcePerfLeader::printTable(const std::string& technology, const std::string& benchmark) const noexcept
+{
+    if (m_outputFormat != OutputFormat::TABLE)
+    {
+        return;
+    }
+
+    bool hasLatencies{false};
+    bool hasThroughput{false};
+    for (const auto& result : m_results)
+    {
+        if (result.technology == technology && result.benchmark == benchmark)
+        {
+            hasLatencies |= result.latency.count() > 0U;
+            hasThroughput |= result.throughput.numberOfMessages > 0U;
+        }
+    }
+    if (!hasLatencies && !hasThroughput)
+    {
+        return;
+    }
+
     std::cout << std::endl;
-    std::cout << "#### Measurement Result ####" << std::endl;
-    std::cout << m_settings.numberOfSamples << " round trips for each payload." << std::endl;
+    std::cout << "#### Measurement Result: " << benchmark << " ####" << std::endl;
+    if (benchmark == LATENCY)
+    {
+        std::cout << m_settings.numberOfSamples << " round trips for each payload." << std::endl;
+    }
+    else if (benchmark == THROUGHPUT)
+    {
+        std::cout << m_settings.numberOfSamples << " samples for each payload." << std::endl;
+    }
+    else
+    {
+        std::cout << m_settings.numberOfSamples << " samples from each publisher for each payload, "
+                  << m_settings.fanDegree << ((benchmark == FAN_OUT) ? " subscribers." : " publishers.") << std::endl;
+    }
+    std::cout << std::endl;
+
+    std::cout << "| Payload Size [kB] |";
+    if (hasLatencies)
+    {
+        std::cout << " Average Latency [µs] |";
+        for (const auto& percentile : PERCENTILES)
+        {
+            std::cout << " " << std::setw(11) << percentile.name << " [µs] |";
+        }
+        std::cout << "    Max Latency [µs] |";
+    }
+    if (hasThroughput)
+    {
+        std::cout << "     Messages [1/s] | Throughput [GB/s] |";
+    }
+    std::cout << std::endl;
+
+    std::cout << "|------------------:|";
+    if (hasLatencies)
+    {
+        std::cout << "---------------------:|";
+        for (uint64_t i = 0U; i < PERCENTILES.size(); ++i)
+        {
+            std::cout << "-----------------:|";
+        }
+        std::cout << "--------------------:|";
+    }
+    if (hasThroughput)
+    {
+        std::cout << "-------------------:|------------------:|";
+    }
     std::cout << std::endl;
-    std::cout << "| Payload Size [kB] | Average Latency [µs] |" << std::endl;
-    std::cout << "|------------------:|---------------------:|" << std::endl;
-    for (const auto& latencyMeasuement : latencyMeasurements)
+
+    for (const auto& result : m_results)
     {
-        auto payloadSizeInKB = std::get<0>(latencyMeasuement);
-        auto latencyInMicroseconds = static_cast<double>(std::get<1>(latencyMeasuement).toNanoseconds()) / 1000.0;
-        std::cout << "| " << std::setw(17) << payloadSizeInKB << " | " << std::setw(20) << std::setprecision(2)
-                  << latencyInMicroseconds << " |" << std::endl;
+        if (result.technology != technology || result.benchmark != benchmark)
+        {
+            continue;
+        }
+        std::cout << "| " << std::setw(17) << result.payloadSizeInKB << " |";
+        if (hasLatencies)
+        {
+            std::cout << " " << std::setw(20) << std::setprecision(2) << result.latency.mean() / 1000.0 << " |";
+            for (const auto& percentile : PERCENTILES)
+            {
+                std::cout << " " << std::setw(16) << std::setprecision(2)
+                          << toMicroseconds(result.latency.valueAtPercentile(percentile.value)) << " |";
+            }
+            std::cout << " " << std::setw(19) << std::setprecision(2) << toMicroseconds(result.latency.max())
+                      << " |";
+        }
+        if (hasThroughput)
+        {
+            std::cout << " " << std::setw(18) << std::setprecision(3) << result.throughput.messagesPerSecond()
+                      << " | " << std::setw(17) << std::setprecision(3) << result.throughput.gigabytesPerSecond()
+                      << " |";
+        }
+        std::cout << std::endl;
     }
 
     std::cout << std::endl;
     std::cout << "Finished!" << std::endl;
 }
-//! [do the measurement for a single technology]
+
+void IcePerfLeader::writeCsv(std::ostream& output) const noexcept
+{
+    output << "technology,benchmark,payload_size_kb,samples,latency_mean_us,latency_min_us";
+    for (const auto& percentile : PERCENTILES)
+    {
+        output << ",latency_" << percentile.name << "_us";
+    }
+    output << ",latency_max_us,messages_per_second,gigabytes_per_second" << std::endl;
+
+    for (const auto& result : m_results)
+    {
+        output << result.technology << "," << result.benchmark << "," << result.payloadSizeInKB << ","
+               << std::max(result.latency.count(), result.throughput.numberOfMessages);
+        if (result.latency.count() > 0U)
+        {
+            output << "," << result.latency.mean() / 1000.0 << "," << toMicroseconds(result.latency.min());
+            for (const auto& percentile : PERCENTILES)
+            {
+                output << "," << toMicroseconds(result.latency.valueAtPercentile(percentile.value));
+            }
+            output << "," << toMicroseconds(result.latency.max());
+        }
+        else
+        {
+            output << ",,";
+            for (uint64_t i = 0U; i < PERCENTILES.size(); ++i)
+            {
+                output << ",";
+            }
+            output << ",";
+        }
+        if (result.throughput.numberOfMessages > 0U)
+        {
+            output << "," << result.throughput.messagesPerSecond() << "," << result.throughput.gigabytesPerSecond();
+        }
+        else
+        {
+            output << ",,";
+        }
+        output << std::endl;
+    }
+}
+
+void IcePerfLeader::writeJson(std::ostream& output) const noexcept
+{
+    output << "{" << std::endl;
+    output << "  \"settings\": {\"numberOfSamples\": " << m_settings.numberOfSamples
+           << ", \"fanDegree\": " << m_settings.fanDegree << ", \"leaderCpu\": " << m_settings.leaderCpu
+           << ", \"followerCpu\": " << m_settings.followerCpu << "}," << std::endl;
+    output << "  \"results\": [";
+
+    const char* resultSeparator = "";
+    for (const auto& result : m_results)
+    {
+        output << resultSeparator << std::endl;
+        resultSeparator = ",";
+        output << "    {\"technology\": \"" << result.technology << "\", \"benchmark\": \"" << result.benchmark
+               << "\", \"payloadSizeInKB\": " << result.payloadSizeInKB;
+        if (result.latency.count() > 0U)
+        {
+            output << "," << std::endl << "     \"latencyInNanoseconds\": {\"count\": " << result.latency.count()
+                   << ", \"mean\": " << result.latency.mean() << ", \"min\": " << result.latency.min();
+            for (const auto& percentile : PERCENTILES)
+            {
+                output << ", \"" << percentile.name << "\": " << result.latency.valueAtPercentile(percentile.value);
+            }
+            output << ", \"max\": " << result.latency.max() << "," << std::endl;
+
+            // every entry consists of the highest value of a bucket and the number of samples in this bucket
+            output << "       \"histogram\": [";
+            const char* bucketSeparator = "";
+            result.latency.forEachRecordedBucket([&](const uint64_t highestValue, const uint64_t count) {
+                output << bucketSeparator << "[" << highestValue << ", " << count << "]";
+                bucketSeparator = ", ";
+            });
+            output << "]}";
+        }
+        if (result.throughput.numberOfMessages > 0U)
+        {
+            output << "," << std::endl
+                   << "     \"throughput\": {\"messages\": " << result.throughput.numberOfMessages
+                   << ", \"durationInNanoseconds\": " << result.throughput.duration.toNanoseconds()
+                   << ", \"messagesPerSecond\": " << result.throughput.messagesPerSecond()
+                   << ", \"gigabytesPerSecond\": " << result.throughput.gigabytesPerSecond() << "}";
+        }
+        output << "}";
+    }
+    output << std::endl << "  ]" << std::endl << "}" << std::endl;
+}
+
+int IcePerfLeader::writeResults() const noexcept
+{
+    if (m_outputFormat == OutputFormat::TABLE)
+    {
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream resultFile;
+    if (!m_resultFile.empty())
+    {
+        resultFile.open(m_resultFile);
+        if (!resultFile.is_open())
+        {
+            std::cerr << "Could not open '" << m_resultFile << "' to write the results!" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    else
+    {
+        std::cout << std::endl;
+    }
+    std::ostream& output = m_resultFile.empty() ? std::cout : resultFile;
+
+    output << std::setprecision(6);
+    if (m_outputFormat == OutputFormat::CSV)
+    {
+        writeCsv(output);
+    }
+    else
+    {
+        writeJson(output);
+    }
+    return EXIT_SUCCESS;
+}
 
 //! [run all technologies]
 int IcePerfLeader::run() noexcept
 {
     iox::runtime::PoshRuntime::initRuntime(APP_NAME);
 
+    if (!setCpuAffinity(m_settings.leaderCpu, pthread_self()))
+    {
+        return EXIT_FAILURE;
+    }
+
     //! [send setting to follower application]
     iox::capro::ServiceDescription serviceDescription{"IcePerf", "Settings", "Generic"};
     iox::popo::PublisherOptions options;
@@ -112,13 +398,17 @@ int IcePerfLeader::run() noexcept
     }
     //! [send setting to follower application]
 
+    const bool isFollowerRequired =
+        isBenchmarkSelected(Benchmark::LATENCY) || isBenchmarkSelected(Benchmark::THROUGHPUT);
+
     //! [create an run technologies]
-    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::POSIX_MESSAGE_QUEUE)
+    if (isFollowerRequired
+        && (m_settings.technology == Technology::ALL || m_settings.technology == Technology::POSIX_MESSAGE_QUEUE))
     {
 #ifndef __APPLE__
         std::cout << std::endl << "******   MESSAGE QUEUE    ********" << std::endl;
         MQ mq(PUBLISHER, SUBSCRIBER);
-        doMeasurement(mq);
+        doMeasurement(mq, "posix-message-queue");
 #else
         if (m_settings.technology == Technology::POSIX_MESSAGE_QUEUE)
         {
@@ -127,28 +417,43 @@ int IcePerfLeader::run() noexcept
 #endif
     }
 
-    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::UNIX_DOMAIN_SOCKET)
+    if (isFollowerRequired
+        && (m_settings.technology == Technology::ALL || m_settings.technology == Technology::UNIX_DOMAIN_SOCKET))
     {
         std::cout << std::endl << "****** UNIX DOMAIN SOCKET ********" << std::endl;
         UDS uds(PUBLISHER, SUBSCRIBER);
-        doMeasurement(uds);
+        doMeasurement(uds, "unix-domain-sockets");
     }
 
-    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_API)
+    if (isFollowerRequired
+        && (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_API))
     {
         std::cout << std::endl << "******      ICEORYX       ********" << std::endl;
         Iceoryx iceoryx(PUBLISHER, SUBSCRIBER);
-        doMeasurement(iceoryx);
+        doMeasurement(iceoryx, "iceoryx-cpp-api");
     }
 
-    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_C_API)
+    if (isFollowerRequired
+        && (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_C_API))
     {
         std::cout << std::endl << "******   ICEORYX C API    ********" << std::endl;
         IceoryxC iceoryxc(PUBLISHER, SUBSCRIBER);
-        doMeasurement(iceoryxc);
+        doMeasurement(iceoryxc, "iceoryx-c-api");
     }
     //! [create an run technologies]
 
-    return EXIT_SUCCESS;
+    if (isBenchmarkSelected(Benchmark::FAN_OUT))
+    {
+        std::cout << std::endl << "******  ICEORYX FAN-OUT   ********" << std::endl;
+        doFanMeasurement(Benchmark::FAN_OUT);
+    }
+
+    if (isBenchmarkSelected(Benchmark::FAN_IN))
+    {
+        std::cout << std::endl << "******   ICEORYX FAN-IN   ********" << std::endl;
+        doFanMeasurement(Benchmark::FAN_IN);
+    }
+
+    return writeResults();
 }
 //! [run all technologies]
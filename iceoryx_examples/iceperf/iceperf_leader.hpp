@@ -20,20 +20,51 @@
 #include "base.hpp"
 #include "example_common.hpp"
 
+#include "latency_histogram.hpp"
+
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
+#include <ostream>
+#include <string>
+#include <vector>
+
 class IcePerfLeader
 {
   public:
-    IcePerfLeader(const PerfSettings settings) noexcept;
+    /// @brief Creates the leader
+    /// @param[in] settings are sent to the follower
+    /// @param[in] outputFormat the format of the measurement results
+    /// @param[in] resultFile the file the results are written to, if empty they are printed to stdout
+    IcePerfLeader(const PerfSettings settings,
+                  const OutputFormat outputFormat = OutputFormat::TABLE,
+                  const std::string& resultFile = "") noexcept;
 
     int run() noexcept;
 
   private:
-    void doMeasurement(IcePerfBase& ipcTechnology) noexcept;
+    struct MeasurementResult
+    {
+        std::string technology;
+        std::string benchmark;
+        uint32_t payloadSizeInKB{0U};
+        LatencyHistogram latency;
+        ThroughputMeasurement throughput;
+    };
+
+    void doMeasurement(IcePerfBase& ipcTechnology, const std::string& technology) noexcept;
+    void doFanMeasurement(const Benchmark mode) noexcept;
+    bool isBenchmarkSelected(const Benchmark benchmark) const noexcept;
+
+    void printTable(const std::string& technology, const std::string& benchmark) const noexcept;
+    void writeCsv(std::ostream& output) const noexcept;
+    void writeJson(std::ostream& output) const noexcept;
+    int writeResults() const noexcept;
 
   private:
     const PerfSettings m_settings;
+    const OutputFormat m_outputFormat;
+    const std::string m_resultFile;
+    std::vector<MeasurementResult> m_results;
 };
 
 #endif // IOX_EXAMPLES_ICEPERF_LEADER_HPP
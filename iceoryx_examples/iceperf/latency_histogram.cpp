@@ -0,0 +1,149 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+constexpr uint32_t LatencyHistogram::SUB_BUCKET_BITS;
+constexpr uint64_t LatencyHistogram::SUB_BUCKET_COUNT;
+constexpr uint32_t LatencyHistogram::VALUE_BITS;
+constexpr uint64_t LatencyHistogram::MAX_TRACKABLE_VALUE;
+
+namespace
+{
+constexpr uint64_t HALF_SUB_BUCKET_COUNT{LatencyHistogram::SUB_BUCKET_COUNT / 2U};
+constexpr uint64_t NUMBER_OF_BUCKETS{(LatencyHistogram::VALUE_BITS - LatencyHistogram::SUB_BUCKET_BITS + 1U)
+                                         * HALF_SUB_BUCKET_COUNT
+                                     + HALF_SUB_BUCKET_COUNT};
+} // namespace
+
+LatencyHistogram::LatencyHistogram() noexcept
+    : m_counts(NUMBER_OF_BUCKETS, 0U)
+{
+}
+
+uint64_t LatencyHistogram::bucketIndexOf(const uint64_t value) noexcept
+{
+    uint32_t mostSignificantBit{0U};
+    for (uint64_t remainder = value >> 1U; remainder != 0U; remainder >>= 1U)
+    {
+        ++mostSignificantBit;
+    }
+
+    // values below SUB_BUCKET_COUNT are stored exactly, above every power of two has HALF_SUB_BUCKET_COUNT buckets
+    const uint32_t magnitude =
+        (mostSignificantBit < SUB_BUCKET_BITS) ? 0U : mostSignificantBit - (SUB_BUCKET_BITS - 1U);
+    return magnitude * HALF_SUB_BUCKET_COUNT + (value >> magnitude);
+}
+
+uint64_t LatencyHistogram::highestValueOfBucket(const uint64_t bucketIndex) noexcept
+{
+    if (bucketIndex < SUB_BUCKET_COUNT)
+    {
+        return bucketIndex;
+    }
+    const uint64_t magnitude = bucketIndex / HALF_SUB_BUCKET_COUNT - 1U;
+    const uint64_t subBucket = bucketIndex - magnitude * HALF_SUB_BUCKET_COUNT;
+    return ((subBucket + 1U) << magnitude) - 1U;
+}
+
+void LatencyHistogram::record(const uint64_t valueInNanoseconds) noexcept
+{
+    const uint64_t value = std::min(valueInNanoseconds, MAX_TRACKABLE_VALUE);
+    ++m_counts[bucketIndexOf(value)];
+    m_min = (m_count == 0U) ? value : std::min(m_min, value);
+    m_max = std::max(m_max, value);
+    m_sum += value;
+    ++m_count;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) noexcept
+{
+    if (other.m_count == 0U)
+    {
+        return;
+    }
+    for (uint64_t i = 0U; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        m_counts[i] += other.m_counts[i];
+    }
+    m_min = (m_count == 0U) ? other.m_min : std::min(m_min, other.m_min);
+    m_max = std::max(m_max, other.m_max);
+    m_sum += other.m_sum;
+    m_count += other.m_count;
+}
+
+uint64_t LatencyHistogram::count() const noexcept
+{
+    return m_count;
+}
+
+uint64_t LatencyHistogram::min() const noexcept
+{
+    return m_min;
+}
+
+uint64_t LatencyHistogram::max() const noexcept
+{
+    return m_max;
+}
+
+double LatencyHistogram::mean() const noexcept
+{
+    return (m_count == 0U) ? 0.0 : static_cast<double>(m_sum) / static_cast<double>(m_count);
+}
+
+uint64_t LatencyHistogram::valueAtPercentile(const double percentile) const noexcept
+{
+    if (m_count == 0U)
+    {
+        return 0U;
+    }
+    if (percentile <= 0.0)
+    {
+        return m_min;
+    }
+
+    const double clampedPercentile = std::min(percentile, 100.0);
+    const auto requiredCount = std::max(
+        static_cast<uint64_t>(1U),
+        static_cast<uint64_t>(std::ceil(clampedPercentile / 100.0 * static_cast<double>(m_count))));
+
+    uint64_t cumulativeCount{0U};
+    for (uint64_t i = 0U; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        cumulativeCount += m_counts[i];
+        if (cumulativeCount >= requiredCount)
+        {
+            return std::min(highestValueOfBucket(i), m_max);
+        }
+    }
+    return m_max;
+}
+
+void LatencyHistogram::forEachRecordedBucket(
+    const std::function<void(const uint64_t, const uint64_t)>& callback) const noexcept
+{
+    for (uint64_t i = 0U; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        if (m_counts[i] != 0U)
+        {
+            callback(highestValueOfBucket(i), m_counts[i]);
+        }
+    }
+}
@@ -0,0 +1,73 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_EXAMPLES_ICEPERF_LATENCY_HISTOGRAM_HPP
+#define IOX_EXAMPLES_ICEPERF_LATENCY_HISTOGRAM_HPP
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/// @brief A histogram with a high dynamic range in the style of HdrHistogram. The values are sorted into
+/// log-linear buckets, i.e. every power of two is split into SUB_BUCKET_COUNT / 2 linear sub-buckets. This keeps the
+/// relative error of a reported value below 1/64 from one nanosecond up to MAX_TRACKABLE_VALUE with a fixed amount of
+/// memory and O(1) recording, which allows to record every single sample of a benchmark run.
+class LatencyHistogram
+{
+  public:
+    static constexpr uint32_t SUB_BUCKET_BITS{7U};
+    static constexpr uint64_t SUB_BUCKET_COUNT{1U << SUB_BUCKET_BITS};
+    static constexpr uint32_t VALUE_BITS{40U};
+    /// @brief larger values are recorded as MAX_TRACKABLE_VALUE; 2^40 ns are roughly 18 minutes
+    static constexpr uint64_t MAX_TRACKABLE_VALUE{(static_cast<uint64_t>(1U) << VALUE_BITS) - 1U};
+
+    LatencyHistogram() noexcept;
+
+    /// @brief Adds a value to the histogram
+    /// @param[in] valueInNanoseconds the value to add
+    void record(const uint64_t valueInNanoseconds) noexcept;
+
+    /// @brief Adds all values of another histogram to this one
+    /// @param[in] other the histogram to add
+    void merge(const LatencyHistogram& other) noexcept;
+
+    uint64_t count() const noexcept;
+    uint64_t min() const noexcept;
+    uint64_t max() const noexcept;
+    double mean() const noexcept;
+
+    /// @brief Returns the highest value of the bucket which contains the given percentile of all recorded values
+    /// @param[in] percentile in the range of [0, 100]
+    /// @return the value at the percentile, which is never larger than the largest recorded value; 0 if empty
+    uint64_t valueAtPercentile(const double percentile) const noexcept;
+
+    /// @brief Calls the callback for all buckets which contain at least one value in ascending order
+    /// @param[in] callback is called with the highest value of the bucket and the number of values in it
+    void forEachRecordedBucket(const std::function<void(const uint64_t, const uint64_t)>& callback) const noexcept;
+
+  private:
+    static uint64_t bucketIndexOf(const uint64_t value) noexcept;
+    static uint64_t highestValueOfBucket(const uint64_t bucketIndex) noexcept;
+
+  private:
+    std::vector<uint64_t> m_counts;
+    uint64_t m_count{0U};
+    uint64_t m_min{0U};
+    uint64_t m_max{0U};
+    uint64_t m_sum{0U};
+};
+
+#endif // IOX_EXAMPLES_ICEPERF_LATENCY_HISTOGRAM_HPP
@@ -24,19 +24,27 @@
 
 #include <cstring>
 #include <iostream>
+#include <string>
 
 int main(int argc, char* argv[])
 {
     PerfSettings settings;
+    OutputFormat outputFormat{OutputFormat::TABLE};
+    std::string resultFile;
 
     constexpr option longOptions[] = {{"help", no_argument, nullptr, 'h'},
                                       {"benchmark", required_argument, nullptr, 'b'},
                                       {"technology", required_argument, nullptr, 't'},
-                                      {"number-of-samples", required_argument, nullptr, 't'},
+                                      {"number-of-samples", required_argument, nullptr, 'n'},
+                                      {"fan-degree", required_argument, nullptr, 'f'},
+                                      {"leader-cpu", required_argument, nullptr, 'l'},
+                                      {"follower-cpu", required_argument, nullptr, 'c'},
+                                      {"output-format", required_argument, nullptr, 'o'},
+                                      {"result-file", required_argument, nullptr, 'r'},
                                       {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* shortOptions = "hb:t:n:";
+    constexpr const char* shortOptions = "hb:t:n:f:l:c:o:r:";
     int32_t index{0};
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, shortOptions, longOptions, &index), opt != -1))
@@ -48,7 +56,8 @@ int main(int argc, char* argv[])
             std::cout << "Options:" << std::endl;
             std::cout << "-h, --help                        Display help" << std::endl;
             std::cout << "-b, --benchmark <TYPE>            Selects the type of benchmark to run" << std::endl;
-            std::cout << "                                  <TYPE> {all, latency, throughput}" << std::endl;
+            std::cout << "                                  <TYPE> {all, latency, throughput, fan-out, fan-in}"
+                      << std::endl;
             std::cout << "                                  default = 'all'" << std::endl;
             std::cout << "-t, --technology <TYPE>           Selects the type of technology to benchmark" << std::endl;
             std::cout << "                                  <TYPE> {all," << std::endl;
@@ -60,6 +69,22 @@ int main(int argc, char* argv[])
             std::cout << "-n, --number-of-samples <N>       Set the number of samples sent in a benchmark round"
                       << std::endl;
             std::cout << "                                  default = '10000'" << std::endl;
+            std::cout << "-f, --fan-degree <N>              Set the number of subscribers for the fan-out and of"
+                      << std::endl;
+            std::cout << "                                  publishers for the fan-in benchmark, which only use the"
+                      << std::endl;
+            std::cout << "                                  iceoryx C++ API and do not require the follower"
+                      << std::endl;
+            std::cout << "                                  default = '4'" << std::endl;
+            std::cout << "-l, --leader-cpu <CPU>            Pin the leader to a CPU" << std::endl;
+            std::cout << "-c, --follower-cpu <CPU>          Pin the follower to a CPU; the endpoint threads of the"
+                      << std::endl;
+            std::cout << "                                  fan benchmarks are pinned to consecutive CPUs" << std::endl;
+            std::cout << "-o, --output-format <FORMAT>      Selects the format of the results" << std::endl;
+            std::cout << "                                  <FORMAT> {table, csv, json}" << std::endl;
+            std::cout << "                                  default = 'table'" << std::endl;
+            std::cout << "-r, --result-file <FILE>          Write csv or json results to a file instead of stdout"
+                      << std::endl;
 
             return EXIT_SUCCESS;
         case 'b':
@@ -75,9 +100,18 @@ int main(int argc, char* argv[])
             {
                 settings.benchmark = Benchmark::THROUGHPUT;
             }
+            else if (strcmp(optarg, "fan-out") == 0)
+            {
+                settings.benchmark = Benchmark::FAN_OUT;
+            }
+            else if (strcmp(optarg, "fan-in") == 0)
+            {
+                settings.benchmark = Benchmark::FAN_IN;
+            }
             else
             {
-                std::cerr << "Options for 'benchmark' are 'all', 'latency' and 'off'!" << std::endl;
+                std::cerr << "Options for 'benchmark' are 'all', 'latency', 'throughput', 'fan-out' and 'fan-in'!"
+                          << std::endl;
                 return EXIT_FAILURE;
             }
             break;
@@ -117,11 +151,54 @@ int main(int argc, char* argv[])
                 return EXIT_FAILURE;
             }
             break;
+        case 'f':
+            if (!iox::cxx::convert::fromString(optarg, settings.fanDegree) || settings.fanDegree == 0U)
+            {
+                std::cerr << "Could not parse 'fan-degree' paramater!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'l':
+            if (!iox::cxx::convert::fromString(optarg, settings.leaderCpu) || settings.leaderCpu < 0)
+            {
+                std::cerr << "Could not parse 'leader-cpu' paramater!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'c':
+            if (!iox::cxx::convert::fromString(optarg, settings.followerCpu) || settings.followerCpu < 0)
+            {
+                std::cerr << "Could not parse 'follower-cpu' paramater!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'o':
+            if (strcmp(optarg, "table") == 0)
+            {
+                outputFormat = OutputFormat::TABLE;
+            }
+            else if (strcmp(optarg, "csv") == 0)
+            {
+                outputFormat = OutputFormat::CSV;
+            }
+            else if (strcmp(optarg, "json") == 0)
+            {
+                outputFormat = OutputFormat::JSON;
+            }
+            else
+            {
+                std::cerr << "Options for 'output-format' are 'table', 'csv' and 'json'!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'r':
+            resultFile = optarg;
+            break;
         default:
             return EXIT_FAILURE;
         };
     }
 
-    IcePerfLeader app(settings);
+    IcePerfLeader app(settings, outputFormat, resultFile);
     return app.run();
 }
@@ -0,0 +1,253 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "topic_data.hpp"
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_hoofs/platform/getopt.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/typed_unique_id.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_roudi.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_roudi.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_user.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/// @brief Measures the round trip latency of the request/response data path. Since RouDi does not yet match clients
+/// and servers, both ports are created in this process and connected by dispatching the CaPro messages like the port
+/// manager would do. The server runs in its own thread and answers every request with a response of the same size.
+
+namespace
+{
+constexpr uint32_t CHUNKS_PER_PAYLOAD_SIZE{8U};
+constexpr uint32_t HEADER_RESERVE{256U};
+
+void connect(iox::popo::ServerPortRouDi& server, iox::popo::ClientPortRouDi& client)
+{
+    auto offer = server.tryGetCaProMessage();
+    if (offer.has_value())
+    {
+        client.dispatchCaProMessageAndGetPossibleResponse(offer.value());
+    }
+    auto connectRequest = client.tryGetCaProMessage();
+    if (connectRequest.has_value())
+    {
+        auto acknowledge = server.dispatchCaProMessageAndGetPossibleResponse(connectRequest.value());
+        if (acknowledge.has_value())
+        {
+            client.dispatchCaProMessageAndGetPossibleResponse(acknowledge.value());
+        }
+    }
+}
+
+void sendRequest(iox::popo::ClientPortUser& client, const uint32_t payloadSize, const RunFlag runFlag)
+{
+    client.allocateRequest(payloadSize, alignof(PerfTopic))
+        .and_then([&](auto& requestHeader) {
+            auto perfTopic = static_cast<PerfTopic*>(requestHeader->getUserPayload());
+            perfTopic->payloadSize = payloadSize;
+            perfTopic->runFlag = runFlag;
+            client.sendRequest(requestHeader);
+        })
+        .or_else([](auto) {
+            std::cerr << "Could not allocate a request!" << std::endl;
+            std::exit(EXIT_FAILURE);
+        });
+}
+
+void serve(iox::popo::ServerPortUser& server, iox::popo::ConditionListener& listener)
+{
+    while (true)
+    {
+        listener.wait();
+        while (server.hasNewRequests())
+        {
+            auto request = server.getRequest();
+            if (request.has_error() || !request.value().has_value())
+            {
+                break;
+            }
+            auto requestHeader = request.value().value();
+            auto perfTopic = *static_cast<const PerfTopic*>(requestHeader->getUserPayload());
+            if (perfTopic.runFlag == RunFlag::STOP)
+            {
+                server.releaseRequest(requestHeader);
+                return;
+            }
+
+            server.allocateResponse(requestHeader, perfTopic.payloadSize, alignof(PerfTopic))
+                .and_then([&](auto& responseHeader) {
+                    *static_cast<PerfTopic*>(responseHeader->getUserPayload()) = perfTopic;
+                    server.sendResponse(responseHeader);
+                })
+                .or_else([](auto) { std::cerr << "Could not allocate a response!" << std::endl; });
+            server.releaseRequest(requestHeader);
+        }
+    }
+}
+
+iox::units::Duration measureRoundTrips(iox::popo::ClientPortUser& client,
+                                       iox::popo::ConditionListener& listener,
+                                       const uint32_t payloadSize,
+                                       const uint64_t numberOfRoundTrips)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (uint64_t i = 0U; i < numberOfRoundTrips; ++i)
+    {
+        sendRequest(client, payloadSize, RunFlag::RUN);
+
+        bool hasResponse{false};
+        while (!hasResponse)
+        {
+            listener.wait();
+            auto response = client.getResponse();
+            if (!response.has_error() && response.value().has_value())
+            {
+                client.releaseResponse(response.value().value());
+                hasResponse = true;
+            }
+        }
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start);
+    return iox::units::Duration::fromNanoseconds(static_cast<uint64_t>(duration.count()) / numberOfRoundTrips);
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    uint64_t numberOfRoundTrips{10000U};
+
+    constexpr option longOptions[] = {{"help", no_argument, nullptr, 'h'},
+                                      {"number-of-samples", required_argument, nullptr, 'n'},
+                                      {nullptr, 0, nullptr, 0}};
+
+    constexpr const char* shortOptions = "hn:";
+    int32_t index{0};
+    int32_t opt{-1};
+    while ((opt = getopt_long(argc, argv, shortOptions, longOptions, &index), opt != -1))
+    {
+        switch (opt)
+        {
+        case 'h':
+            std::cout << "Usage: " << argv[0] << " [options]" << std::endl;
+            std::cout << "Options:" << std::endl;
+            std::cout << "-h, --help                        Display help" << std::endl;
+            std::cout << "-n, --number-of-samples <N>       Set the number of round trips for each payload size"
+                      << std::endl;
+            std::cout << "                                  default = '10000'" << std::endl;
+            return EXIT_SUCCESS;
+        case 'n':
+            if (!iox::cxx::convert::fromString(optarg, numberOfRoundTrips) || numberOfRoundTrips == 0U)
+            {
+                std::cerr << "Could not parse 'number-of-samples' paramater!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        default:
+            return EXIT_FAILURE;
+        };
+    }
+
+    std::vector<uint32_t> payloadSizesInKB{1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U, 256U, 512U, 1024U};
+
+    iox::mepoo::MePooConfig mempoolConfig;
+    for (const auto payloadSizeInKB : payloadSizesInKB)
+    {
+        mempoolConfig.addMemPool({payloadSizeInKB * 1024U + HEADER_RESERVE, CHUNKS_PER_PAYLOAD_SIZE});
+    }
+    const auto memorySize = iox::mepoo::MemoryManager::requiredFullMemorySize(mempoolConfig);
+    std::unique_ptr<uint8_t[]> memory{new uint8_t[memorySize]};
+    iox::posix::Allocator allocator{memory.get(), memorySize};
+    iox::mepoo::MemoryManager memoryManager;
+    memoryManager.configureMemoryManager(mempoolConfig, allocator, allocator);
+
+    // there is no RouDi which would provide the id for the unique port ids
+    iox::popo::internal::setUniqueRouDiId(0U);
+
+    iox::capro::ServiceDescription serviceDescription{"IcePerf", "RequestResponse", "RoundTrip"};
+    std::unique_ptr<iox::popo::ServerPortData> serverData{new iox::popo::ServerPortData(
+        serviceDescription, "iceperf-server", iox::NodeName_t(""), &memoryManager)};
+    std::unique_ptr<iox::popo::ClientPortData> clientData{new iox::popo::ClientPortData(
+        serviceDescription, "iceperf-client", iox::NodeName_t(""), &memoryManager)};
+    iox::popo::ServerPortUser serverUser{serverData.get()};
+    iox::popo::ServerPortRouDi serverRouDi{serverData.get()};
+    iox::popo::ClientPortUser clientUser{clientData.get()};
+    iox::popo::ClientPortRouDi clientRouDi{clientData.get()};
+
+    iox::popo::ConditionVariableData serverConditionVariable{"iceperf-server"};
+    iox::popo::ConditionVariableData clientConditionVariable{"iceperf-client"};
+    iox::popo::ConditionListener serverListener{serverConditionVariable};
+    iox::popo::ConditionListener clientListener{clientConditionVariable};
+    serverUser.setConditionVariable(serverConditionVariable, 0U);
+    clientUser.setConditionVariable(clientConditionVariable, 0U);
+
+    serverUser.offer();
+    clientUser.connect();
+    connect(serverRouDi, clientRouDi);
+    if (clientUser.getConnectionState() != iox::ConnectionState::CONNNECTED)
+    {
+        std::cerr << "Could not connect the client to the server!" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::thread serverThread([&] { serve(serverUser, serverListener); });
+
+    std::vector<iox::units::Duration> latencies;
+    std::cout << "Measurement for:";
+    for (const auto payloadSizeInKB : payloadSizesInKB)
+    {
+        std::cout << " " << payloadSizeInKB << " kB," << std::flush;
+        latencies.push_back(measureRoundTrips(clientUser, clientListener, payloadSizeInKB * 1024U, numberOfRoundTrips));
+    }
+    std::cout << std::endl;
+
+    sendRequest(clientUser, sizeof(PerfTopic), RunFlag::STOP);
+    serverThread.join();
+
+    clientUser.unsetConditionVariable();
+    serverUser.unsetConditionVariable();
+    iox::popo::internal::unsetUniqueRouDiId();
+
+    std::cout << std::endl;
+    std::cout << "#### Measurement Result ####" << std::endl;
+    std::cout << numberOfRoundTrips << " round trips for each payload." << std::endl;
+    std::cout << std::endl;
+    std::cout << "| Payload Size [kB] | Average Round Trip Latency [µs] |" << std::endl;
+    std::cout << "|------------------:|--------------------------------:|" << std::endl;
+    for (size_t i = 0U; i < payloadSizesInKB.size(); ++i)
+    {
+        auto latencyInMicroSeconds = static_cast<double>(latencies[i].toNanoseconds()) / 1000.0;
+        std::cout << "| " << std::setw(17) << payloadSizesInKB[i] << " | " << std::setw(31) << std::setprecision(2)
+                  << latencyInMicroSeconds << " |" << std::endl;
+    }
+    std::cout << std::endl;
+    std::cout << "Finished!" << std::endl;
+
+    return EXIT_SUCCESS;
+}
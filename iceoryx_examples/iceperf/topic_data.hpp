@@ -27,6 +27,12 @@ struct PerfSettings
     Benchmark benchmark{Benchmark::ALL};
     Technology technology{Technology::ALL};
     uint64_t numberOfSamples{10000U};
+    /// @brief number of subscribers for the fan-out and of publishers for the fan-in benchmark
+    uint32_t fanDegree{4U};
+    /// @brief the CPU the leader is pinned to, a negative value disables pinning
+    int32_t leaderCpu{-1};
+    /// @brief the CPU the follower is pinned to, a negative value disables pinning
+    int32_t followerCpu{-1};
 };
 
 struct PerfTopic
@@ -116,6 +116,8 @@ int main()
     iox::log::LogManager::GetLogManager().SetDefaultLogLevel(iox::log::LogLevel::kError);
 
     iox::RouDiConfig_t defaultRouDiConfig = iox::RouDiConfig_t().setDefaults();
+    // all applications run in this process, therefore neither shared memory nor inter-process semaphores are required
+    defaultRouDiConfig.m_processScope = iox::roudi::ProcessScope::SINGLE_PROCESS;
     iox::roudi::IceOryxRouDiComponents roudiComponents(defaultRouDiConfig);
 
     iox::roudi::RouDi roudi(roudiComponents.rouDiMemoryManager,
@@ -18,6 +18,7 @@
 #ifndef IOX_HOOFS_CONCURRENT_LOCKFREE_QUEUE_HPP
 #define IOX_HOOFS_CONCURRENT_LOCKFREE_QUEUE_HPP
 
+#include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/internal/concurrent/lockfree_queue/buffer.hpp"
 #include "iceoryx_hoofs/internal/concurrent/lockfree_queue/index_queue.hpp"
@@ -85,6 +86,22 @@ class LockFreeQueue
     /// @note threadsafe, lockfree
     iox::cxx::optional<ElementType> pop() noexcept;
 
+    /// @brief tries to insert multiple values in FIFO order, copies the values internally
+    /// @param values to be inserted
+    /// @param numberOfValues number of elements in values
+    /// @return number of inserted values, the first values are inserted and the remaining ones are not
+    ///         if the queue becomes full during the push
+    /// @note threadsafe, lockfree; the free storage for up to MAX_BATCH_SIZE values is obtained at once,
+    ///       the values may be interleaved with concurrently pushed values
+    uint64_t tryPushN(cxx::not_null<const ElementType*> values, const uint64_t numberOfValues) noexcept;
+
+    /// @brief tries to remove multiple values in FIFO order
+    /// @param values memory for at least maxNumberOfValues elements, the removed values are move assigned to it
+    /// @param maxNumberOfValues maximum number of values to remove
+    /// @return number of removed values, 0 if the queue is empty
+    /// @note threadsafe, lockfree; up to MAX_BATCH_SIZE values are removed at once
+    uint64_t popN(cxx::not_null<ElementType*> values, const uint64_t maxNumberOfValues) noexcept;
+
     /// @brief check whether the queue is empty
     /// @return true iff the queue is empty
     /// @note that if the queue is used concurrently it might
@@ -104,6 +121,9 @@ class LockFreeQueue
     using Queue = IndexQueue<Capacity>;
     using BufferIndex = typename Queue::value_t;
 
+    /// @brief the batch operations reserve up to this number of indices at once on the stack
+    static constexpr uint64_t MAX_BATCH_SIZE{(Capacity < 64U) ? Capacity : 64U};
+
     // remark: actually m_freeIndices do not have to be in a queue, it could be another
     // multi-push multi-pop capable lockfree container (e.g. a stack or a list)
     Queue m_freeIndices;
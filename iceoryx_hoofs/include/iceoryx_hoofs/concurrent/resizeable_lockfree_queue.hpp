@@ -71,8 +71,10 @@ class ResizeableLockFreeQueue : protected LockFreeQueue<ElementType, MaxCapacity
 
     using Base::empty;
     using Base::pop;
+    using Base::popN;
     using Base::size;
     using Base::tryPush;
+    using Base::tryPushN;
 
     /// @brief returns the current capacity of the queue
     /// @return the current capacity
@@ -37,6 +37,7 @@ namespace cxx
 /// @code
 ///     std::string number      = cxx::convert::toString(123);
 ///     std::string someClass   = cxx::convert::toString(someToStringConvertableObject);
+///     cxx::string<20> noHeap  = cxx::convert::toCxxString<20>(123);
 ///
 ///     int i;
 ///     unsigned int a;
@@ -55,6 +56,10 @@ class convert
 
     static constexpr int32_t STRTOULL_BASE = 10;
 
+    /// @brief the maximum number of characters required to represent any 64 bit integer in decimal notation
+    ///         including the sign
+    static constexpr uint64_t INTEGER_STRING_CAPACITY = 20U;
+
     /// @brief Converts every type which is either a pod (plain old data) type or is convertable
     ///         to a string (this means that the operator std::string() is defined)
     /// @param Source type of the value which should be converted to a string
@@ -73,6 +78,16 @@ class convert
     static typename std::enable_if<std::is_convertible<Source, std::string>::value, std::string>::type
     toString(const Source& t);
 
+    /// @brief Converts an integral type into its decimal string representation. The conversion does not depend on
+    ///         the locale and does not allocate memory on the heap.
+    /// @param Capacity the capacity of the resulting string, must be large enough to hold every value of Source
+    /// @param Source integral type of the value which should be converted to a string
+    /// @param[in] t value which should be converted to a string
+    /// @return string representation of t
+    template <uint64_t Capacity, typename Source>
+    static typename std::enable_if<std::is_integral<Source>::value, string<Capacity>>::type
+    toCxxString(const Source t) noexcept;
+
     /// @brief Sets dest from a given string. If the conversion fails false is
     ///         returned and the value of dest is undefined.
     /// @param[in] v string which contains the value of dest
@@ -88,6 +103,35 @@ class convert
     static bool stringIsNumber(const char* v, const NumberType type);
 
   private:
+    /// @brief integral types which are converted digit by digit, char and bool are excluded since they
+    ///         have a dedicated string representation
+    template <typename T>
+    using IsConvertibleInteger = std::integral_constant<bool,
+                                                        std::is_integral<T>::value && !std::is_same<T, char>::value
+                                                            && !std::is_same<T, bool>::value>;
+
+    template <typename Source>
+    static std::string toStringImpl(const Source& t, std::true_type);
+
+    template <typename Source>
+    static std::string toStringImpl(const Source& t, std::false_type);
+
+    /// @brief writes the decimal representation of t into buffer without null termination
+    /// @param[in] buffer must be able to hold at least INTEGER_STRING_CAPACITY characters
+    /// @return the number of written characters
+    template <typename Source>
+    static uint64_t integerToChars(const Source t, char* const buffer) noexcept;
+
+    /// @brief parses a sequence of decimal digits which was already verified by stringIsNumber
+    /// @return false if v contains no digits or the value does not fit into an uint64_t
+    static bool charsToUnsignedInteger(const char* v, uint64_t& value) noexcept;
+
+    template <typename Destination>
+    static bool fromStringToUnsignedInteger(const char* v, Destination& dest) noexcept;
+
+    template <typename Destination>
+    static bool fromStringToSignedInteger(const char* v, Destination& dest) noexcept;
+
     static bool stringIsNumberWithErrorMessage(const char* v, const NumberType type);
 };
 
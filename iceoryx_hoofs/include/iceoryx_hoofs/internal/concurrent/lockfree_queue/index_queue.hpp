@@ -18,10 +18,12 @@
 #ifndef IOX_HOOFS_LOCKFREE_QUEUE_INDEX_QUEUE_HPP
 #define IOX_HOOFS_LOCKFREE_QUEUE_INDEX_QUEUE_HPP
 
+#include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/internal/concurrent/lockfree_queue/buffer.hpp"
 #include "iceoryx_hoofs/internal/concurrent/lockfree_queue/cyclic_index.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <type_traits>
 
@@ -100,6 +102,20 @@ class IndexQueue
     /// @return index if the queue contains size elements, nullopt otherwise
     cxx::optional<ValueType> popIfSizeIsAtLeast(uint64_t size) noexcept;
 
+    /// @brief push multiple indices into the queue in FIFO order
+    /// @param indices to be pushed
+    /// @param numberOfIndices number of elements in indices
+    /// note that the indices are pushed one by one and may be interleaved with concurrently pushed indices,
+    /// since the write position can only advance after the cell it refers to was written
+    void pushN(cxx::not_null<const ValueType*> indices, const uint64_t numberOfIndices) noexcept;
+
+    /// @brief pop multiple indices from the queue in FIFO order, the ownership of all popped indices
+    ///        is obtained with a single update of the read position
+    /// @param indices memory for at least maxNumberOfIndices elements which receives the popped indices
+    /// @param maxNumberOfIndices maximum number of indices to pop
+    /// @return number of popped indices, 0 if the queue is empty
+    uint64_t popN(cxx::not_null<ValueType*> indices, const uint64_t maxNumberOfIndices) noexcept;
+
   private:
     template <typename ElementType, uint64_t Cap>
     friend class LockFreeQueue;
@@ -189,6 +189,85 @@ bool IndexQueue<Capacity, ValueType>::pop(ValueType& index) noexcept
     return true;
 }
 
+template <uint64_t Capacity, typename ValueType>
+void IndexQueue<Capacity, ValueType>::pushN(cxx::not_null<const ValueType*> indices,
+                                            const uint64_t numberOfIndices) noexcept
+{
+    const ValueType* const indicesToPush = indices;
+    for (uint64_t i = 0U; i < numberOfIndices; ++i)
+    {
+        push(indicesToPush[i]);
+    }
+}
+
+template <uint64_t Capacity, typename ValueType>
+uint64_t IndexQueue<Capacity, ValueType>::popN(cxx::not_null<ValueType*> indices,
+                                               const uint64_t maxNumberOfIndices) noexcept
+{
+    // the case analysis of pop applies to the cell at the read position,
+    // additionally all following cells of the same cycle are taken until maxNumberOfIndices is reached
+    // since a cell can only be overwritten after the read position passed it, the loaded values of all cells
+    // between the old and the new read position are valid if the compare-exchange of the read position succeeds
+
+    ValueType* const poppedIndices = indices;
+    const uint64_t maxBatchSize = std::min(maxNumberOfIndices, Capacity);
+    if (maxBatchSize == 0U)
+    {
+        return 0U;
+    }
+
+    uint64_t numberOfPoppedIndices{0U};
+    bool ownershipGained = false;
+    auto readPosition = m_readPosition.load(std::memory_order_relaxed);
+    do
+    {
+        const auto value = loadvalueAt(readPosition, std::memory_order_relaxed);
+
+        // we only dequeue if value and readPosition are in the same cycle
+        auto cellIsValidToRead = readPosition.getCycle() == value.getCycle();
+
+        if (cellIsValidToRead)
+        {
+            // case (1)
+            poppedIndices[0U] = value.getIndex();
+            numberOfPoppedIndices = 1U;
+            for (; numberOfPoppedIndices < maxBatchSize; ++numberOfPoppedIndices)
+            {
+                const Index position(readPosition + numberOfPoppedIndices);
+                const auto nextValue = loadvalueAt(position, std::memory_order_relaxed);
+                if (position.getCycle() != nextValue.getCycle())
+                {
+                    break;
+                }
+                poppedIndices[numberOfPoppedIndices] = nextValue.getIndex();
+            }
+
+            Index newReadPosition(readPosition + numberOfPoppedIndices);
+            ownershipGained = m_readPosition.compare_exchange_weak(
+                readPosition, newReadPosition, std::memory_order_relaxed, std::memory_order_relaxed);
+        }
+        else
+        {
+            // readPosition is ahead by one cycle, queue was empty at value load
+            auto isEmpty = value.isOneCycleBehind(readPosition);
+
+            if (isEmpty)
+            {
+                // case (2)
+                return 0U;
+            }
+
+            // case (3) and (4) requires loading readPosition again
+            readPosition = m_readPosition.load(std::memory_order_relaxed);
+        }
+
+        // readPosition is outdated, retry operation
+
+    } while (!ownershipGained); // we leave if we gain ownership of readPosition
+
+    return numberOfPoppedIndices;
+}
+
 template <uint64_t Capacity, typename ValueType>
 bool IndexQueue<Capacity, ValueType>::popIfFull(ValueType& index) noexcept
 {
@@ -17,12 +17,16 @@
 
 #include "iceoryx_hoofs/cxx/optional.hpp"
 
+#include <algorithm>
 #include <utility>
 
 namespace iox
 {
 namespace concurrent
 {
+template <typename ElementType, uint64_t Capacity>
+constexpr uint64_t LockFreeQueue<ElementType, Capacity>::MAX_BATCH_SIZE;
+
 template <typename ElementType, uint64_t Capacity>
 LockFreeQueue<ElementType, Capacity>::LockFreeQueue() noexcept
     : m_freeIndices(IndexQueue<Capacity>::ConstructFull)
@@ -137,6 +141,67 @@ iox::cxx::optional<ElementType> LockFreeQueue<ElementType, Capacity>::pop() noex
     return result;
 }
 
+template <typename ElementType, uint64_t Capacity>
+uint64_t LockFreeQueue<ElementType, Capacity>::tryPushN(cxx::not_null<const ElementType*> values,
+                                                        const uint64_t numberOfValues) noexcept
+{
+    const ElementType* const valuesToPush = values;
+    BufferIndex indices[MAX_BATCH_SIZE];
+    uint64_t numberOfPushedValues{0U};
+
+    while (numberOfPushedValues < numberOfValues)
+    {
+        const uint64_t batchSize = std::min(numberOfValues - numberOfPushedValues, MAX_BATCH_SIZE);
+        const uint64_t numberOfIndices = m_freeIndices.popN(indices, batchSize);
+
+        for (uint64_t i = 0U; i < numberOfIndices; ++i)
+        {
+            writeBufferAt(indices[i], valuesToPush[numberOfPushedValues + i]); // const& version is called
+        }
+
+        // indices can only be pushed after the buffer was written
+        m_usedIndices.pushN(indices, numberOfIndices);
+        numberOfPushedValues += numberOfIndices;
+
+        if (numberOfIndices < batchSize)
+        {
+            break; // detected full queue
+        }
+    }
+
+    return numberOfPushedValues;
+}
+
+template <typename ElementType, uint64_t Capacity>
+uint64_t LockFreeQueue<ElementType, Capacity>::popN(cxx::not_null<ElementType*> values,
+                                                    const uint64_t maxNumberOfValues) noexcept
+{
+    ElementType* const poppedValues = values;
+    BufferIndex indices[MAX_BATCH_SIZE];
+    uint64_t numberOfPoppedValues{0U};
+
+    while (numberOfPoppedValues < maxNumberOfValues)
+    {
+        const uint64_t batchSize = std::min(maxNumberOfValues - numberOfPoppedValues, MAX_BATCH_SIZE);
+        const uint64_t numberOfIndices = m_usedIndices.popN(indices, batchSize);
+
+        for (uint64_t i = 0U; i < numberOfIndices; ++i)
+        {
+            poppedValues[numberOfPoppedValues + i] = std::move(readBufferAt(indices[i]).value());
+        }
+
+        m_freeIndices.pushN(indices, numberOfIndices);
+        numberOfPoppedValues += numberOfIndices;
+
+        if (numberOfIndices < batchSize)
+        {
+            break; // detected empty queue
+        }
+    }
+
+    return numberOfPoppedValues;
+}
+
 template <typename ElementType, uint64_t Capacity>
 bool LockFreeQueue<ElementType, Capacity>::empty() const noexcept
 {
@@ -89,6 +89,20 @@ class LoFFLi
     /// @return true if index is valid or not yet pushed, false otherwise
     bool push(const Index_t index) noexcept;
 
+    /// Pop multiple values from the free-list with a single compare-and-swap on the head
+    /// @param [out] indices memory for at least maxNumberOfIndices elements which receives the popped indices
+    /// @param [in] maxNumberOfIndices is the maximum number of indices to pop
+    /// @return the number of popped indices which is less than maxNumberOfIndices if the free-list does not contain
+    ///         enough elements
+    uint32_t popN(cxx::not_null<Index_t*> indices, const uint32_t maxNumberOfIndices) noexcept;
+
+    /// Push multiple previously poped elements with a single compare-and-swap on the head; the indices are linked to a
+    /// chain in advance which is spliced into the free-list
+    /// @param [in] indices to previously poped elements
+    /// @param [in] numberOfIndices is the number of elements in indices
+    /// @return true if all indices are valid, not yet pushed and unique, false otherwise; nothing is pushed in this case
+    bool pushN(cxx::not_null<const Index_t*> indices, const uint32_t numberOfIndices) noexcept;
+
     /// Calculates the required memory size for a free-list
     /// @param [in] capacity is the number of elements of the free-list
     /// @return the required memory size for a free-list with the requested capacity
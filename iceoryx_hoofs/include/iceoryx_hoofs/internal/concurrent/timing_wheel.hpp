@@ -0,0 +1,177 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_CONCURRENT_TIMING_WHEEL_HPP
+#define IOX_HOOFS_CONCURRENT_TIMING_WHEEL_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_hoofs/posix_wrapper/thread.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace iox
+{
+namespace concurrent
+{
+enum class TimingWheelError : uint8_t
+{
+    INVALID_STATE,
+    TIMER_LIMIT_REACHED,
+    INVALID_TIMER_CALLBACK
+};
+
+enum class TimingWheelTimerMode : uint8_t
+{
+    /// @brief the callback is executed once after the timeout
+    ONCE,
+    /// @brief the callback is executed repeatedly with the timeout as period
+    PERIODIC
+};
+
+/// @brief A hierarchical timing wheel which serves an arbitrary number of one-shot and periodic timers with a single
+///        thread. Adding and removing a timer is O(1) independent of the number of active timers, expiring timers
+///        are cascaded from the coarse levels down to the finest level when the wheel turns.
+/// @code
+///     iox::concurrent::TimingWheel wheel{iox::units::Duration::fromMilliseconds(1U), "MyWheel"};
+///     auto timerId = wheel.addTimer(iox::units::Duration::fromMilliseconds(100U),
+///                                   iox::concurrent::TimingWheelTimerMode::PERIODIC,
+///                                   [] { std::cout << "tick" << std::endl; });
+///     // ...
+///     wheel.removeTimer(timerId.value());
+/// @endcode
+/// @note The resolution of a timer is one tick of the wheel. Callbacks are executed sequentially by the thread of the
+///       wheel, a long running callback therefore delays all other timers of this wheel.
+class TimingWheel
+{
+  public:
+    using TimerId = uint64_t;
+    using Callback_t = std::function<void()>;
+
+    static constexpr uint32_t MAX_NUMBER_OF_TIMERS{128U};
+    static constexpr uint32_t NUMBER_OF_LEVELS{4U};
+    static constexpr uint32_t SLOT_BITS{6U};
+    static constexpr uint32_t SLOTS_PER_LEVEL{1U << SLOT_BITS};
+    static constexpr units::Duration DEFAULT_TICK_DURATION{units::Duration::fromMilliseconds(1U)};
+
+    /// @brief Creates the wheel. Its thread is spawned with the first timer and terminates when no timer is left.
+    /// @param[in] tickDuration the resolution of the wheel; timeouts are rounded up to a multiple of it
+    /// @param[in] threadName will be set as thread name
+    explicit TimingWheel(const units::Duration tickDuration = DEFAULT_TICK_DURATION,
+                         const posix::ThreadName_t& threadName = "TimingWheel") noexcept;
+
+    /// @brief Stops and joins the thread of the wheel. Timers which are still registered will not fire anymore.
+    ~TimingWheel() noexcept;
+
+    TimingWheel(const TimingWheel&) = delete;
+    TimingWheel(TimingWheel&&) = delete;
+    TimingWheel& operator=(const TimingWheel&) = delete;
+    TimingWheel& operator=(TimingWheel&&) = delete;
+
+    /// @brief Returns a wheel with the default tick duration which is shared by all users within the process
+    static TimingWheel& sharedInstance() noexcept;
+
+    /// @brief Registers a timer
+    /// @param[in] timeout the time until the callback fires and, for periodic timers, the period
+    /// @param[in] mode whether the timer fires once or periodically
+    /// @param[in] callback the callback which is executed by the thread of the wheel
+    /// @return the id of the timer on success, otherwise a TimingWheelError
+    cxx::expected<TimerId, TimingWheelError>
+    addTimer(const units::Duration timeout, const TimingWheelTimerMode mode, const Callback_t& callback) noexcept;
+
+    /// @brief Registers a periodic timer whose first expiration differs from its period
+    /// @param[in] initialTimeout the time until the callback fires for the first time
+    /// @param[in] period the time between two subsequent executions of the callback
+    /// @param[in] callback the callback which is executed by the thread of the wheel
+    /// @return the id of the timer on success, otherwise a TimingWheelError
+    cxx::expected<TimerId, TimingWheelError>
+    addTimer(const units::Duration initialTimeout, const units::Duration period, const Callback_t& callback) noexcept;
+
+    /// @brief Removes a timer. When the method returns the callback of the timer is not executing anymore, except
+    ///        when it is called from within the callback of the timer itself.
+    /// @param[in] timerId the id returned by addTimer
+    /// @return true if the timer was active, false if it already expired or the id is unknown
+    bool removeTimer(const TimerId timerId) noexcept;
+
+    /// @brief Returns the number of registered timers
+    uint32_t numberOfTimers() const noexcept;
+
+    /// @brief Returns the tick duration of the wheel
+    units::Duration tickDuration() const noexcept;
+
+  private:
+    static constexpr uint32_t INVALID_INDEX{UINT32_MAX};
+    static constexpr uint32_t NUMBER_OF_SLOTS{NUMBER_OF_LEVELS * SLOTS_PER_LEVEL};
+
+    struct Timer
+    {
+        Callback_t callback;
+        uint64_t expirationTick{0U};
+        uint64_t periodInTicks{0U};
+        uint32_t previous{INVALID_INDEX};
+        uint32_t next{INVALID_INDEX};
+        uint32_t slot{INVALID_INDEX};
+        uint32_t generation{0U};
+        bool isActive{false};
+    };
+
+    cxx::expected<TimerId, TimingWheelError>
+    addTimerImpl(const units::Duration initialTimeout, const uint64_t periodInTicks, const Callback_t& callback) noexcept;
+    void run() noexcept;
+    void stopThreadIfIdle() noexcept;
+    void advance() noexcept;
+    void fire(const uint32_t index, std::unique_lock<std::mutex>& lock) noexcept;
+    void insert(const uint32_t index) noexcept;
+    void unlink(const uint32_t index) noexcept;
+    void release(const uint32_t index) noexcept;
+    void cascade(const uint32_t level) noexcept;
+    uint64_t toTicks(const units::Duration duration) const noexcept;
+    uint64_t elapsedTicks() const noexcept;
+    std::chrono::steady_clock::time_point timeOfTick(const uint64_t tick) const noexcept;
+    uint64_t nextWakeupTick() const noexcept;
+
+  private:
+    std::chrono::nanoseconds m_tickDuration;
+    posix::ThreadName_t m_threadName;
+    std::chrono::steady_clock::time_point m_startTime{std::chrono::steady_clock::now()};
+    uint64_t m_currentTick{0U};
+
+    Timer m_timers[MAX_NUMBER_OF_TIMERS];
+    uint32_t m_slots[NUMBER_OF_SLOTS];
+    uint32_t m_freeListHead{0U};
+    uint32_t m_numberOfTimers{0U};
+    uint32_t m_executingTimer{INVALID_INDEX};
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    std::condition_variable m_callbackFinished;
+    bool m_keepRunning{true};
+    bool m_isThreadRunning{false};
+    std::thread::id m_threadId;
+    /// @brief serializes spawning and joining of the thread; must be acquired before m_mutex
+    std::mutex m_threadMutex;
+    std::thread m_thread;
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_TIMING_WHEEL_HPP
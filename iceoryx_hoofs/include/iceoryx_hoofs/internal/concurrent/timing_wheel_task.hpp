@@ -0,0 +1,84 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_CONCURRENT_TIMING_WHEEL_TASK_HPP
+#define IOX_HOOFS_CONCURRENT_TIMING_WHEEL_TASK_HPP
+
+#include "iceoryx_hoofs/cxx/attributes.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/concurrent/timing_wheel.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief This class periodically executes a callable specified by the template parameter, like the PeriodicTask.
+///        Instead of spawning a thread per task, the callable is executed by the thread of a TimingWheel which can be
+///        shared by many tasks.
+/// @code
+///     TimingWheelTask<iox::cxx::MethodCallback<void>> task{TimingWheel::sharedInstance(), *this, &MyClass::send};
+///     task.start(iox::units::Duration::fromMilliseconds(100U));
+/// @endcode
+/// @tparam T is a callable type without function parameters
+template <typename T>
+class TimingWheelTask
+{
+  public:
+    /// @brief Creates a task. The specified callable is stored but not executed.
+    /// To run the task, `void start(const units::Duration interval)` must be called.
+    /// @tparam Args are variadic template parameter for which are forwarded to the underlying callable object
+    /// @param[in] timingWheel the wheel which executes the callable; it must outlive the task
+    /// @param[in] args are forwarded to the underlying callable object
+    template <typename... Args>
+    TimingWheelTask(TimingWheel& timingWheel, Args&&... args) noexcept;
+
+    /// @brief Stops the task
+    /// @note This is blocking if the callable is currently executed.
+    ~TimingWheelTask() noexcept;
+
+    TimingWheelTask(const TimingWheelTask&) = delete;
+    TimingWheelTask(TimingWheelTask&&) = delete;
+
+    TimingWheelTask& operator=(const TimingWheelTask&) = delete;
+    TimingWheelTask& operator=(TimingWheelTask&&) = delete;
+
+    /// @brief Executes the callable with the next tick of the wheel and repeats it after the specified interval.
+    /// @param[in] interval is the time between two invocations of the callable
+    /// @attention If the task is already active, it is stopped and started again with the new interval.
+    /// @return true if the task was started, false if the wheel has no free timer left
+    bool start(const units::Duration interval) noexcept;
+
+    /// @brief This stops the task if it's active, otherwise does nothing. When this method returns, the callable is
+    /// not executing anymore.
+    void stop() noexcept;
+
+    /// @brief This method checks if the task is active
+    /// @return true if the task is active, false otherwise.
+    bool isActive() const noexcept;
+
+  private:
+    TimingWheel& m_timingWheel;
+    T m_callable;
+    cxx::optional<TimingWheel::TimerId> m_timerId;
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#include "iceoryx_hoofs/internal/concurrent/timing_wheel_task.inl"
+
+#endif // IOX_HOOFS_CONCURRENT_TIMING_WHEEL_TASK_HPP
@@ -0,0 +1,71 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_CONCURRENT_TIMING_WHEEL_TASK_INL
+#define IOX_HOOFS_CONCURRENT_TIMING_WHEEL_TASK_INL
+
+namespace iox
+{
+namespace concurrent
+{
+template <typename T>
+template <typename... Args>
+inline TimingWheelTask<T>::TimingWheelTask(TimingWheel& timingWheel, Args&&... args) noexcept
+    : m_timingWheel(timingWheel)
+    , m_callable(std::forward<Args>(args)...)
+{
+}
+
+template <typename T>
+inline TimingWheelTask<T>::~TimingWheelTask() noexcept
+{
+    stop();
+}
+
+template <typename T>
+inline bool TimingWheelTask<T>::start(const units::Duration interval) noexcept
+{
+    stop();
+    auto result = m_timingWheel.addTimer(
+        units::Duration::fromNanoseconds(0U), interval, [this] { IOX_DISCARD_RESULT(m_callable()); });
+    if (result.has_error())
+    {
+        return false;
+    }
+    m_timerId.emplace(result.value());
+    return true;
+}
+
+template <typename T>
+inline void TimingWheelTask<T>::stop() noexcept
+{
+    if (m_timerId.has_value())
+    {
+        IOX_DISCARD_RESULT(m_timingWheel.removeTimer(m_timerId.value()));
+        m_timerId.reset();
+    }
+}
+
+template <typename T>
+inline bool TimingWheelTask<T>::isActive() const noexcept
+{
+    return m_timerId.has_value();
+}
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_TIMING_WHEEL_TASK_INL
@@ -41,12 +41,71 @@ convert::toString(const int8_t& t)
 template <typename Source>
 inline typename std::enable_if<!std::is_convertible<Source, std::string>::value, std::string>::type
 convert::toString(const Source& t)
+{
+    return toStringImpl(t, IsConvertibleInteger<Source>());
+}
+
+template <typename Source>
+inline std::string convert::toStringImpl(const Source& t, std::true_type)
+{
+    char buffer[INTEGER_STRING_CAPACITY];
+    return std::string(buffer, static_cast<size_t>(integerToChars(t, &buffer[0])));
+}
+
+template <typename Source>
+inline std::string convert::toStringImpl(const Source& t, std::false_type)
 {
     std::stringstream ss;
     ss << t;
     return ss.str();
 }
 
+template <uint64_t Capacity, typename Source>
+inline typename std::enable_if<std::is_integral<Source>::value, string<Capacity>>::type
+convert::toCxxString(const Source t) noexcept
+{
+    static_assert(IsConvertibleInteger<Source>::value, "char and bool are not supported by toCxxString");
+    static_assert(Capacity >= static_cast<uint64_t>(std::numeric_limits<Source>::digits10) + 1U
+                                  + (std::is_signed<Source>::value ? 1U : 0U),
+                  "the capacity is too small to hold every value of the source type");
+
+    char buffer[INTEGER_STRING_CAPACITY];
+    return string<Capacity>(TruncateToCapacity, &buffer[0], integerToChars(t, &buffer[0]));
+}
+
+template <typename Source>
+inline uint64_t convert::integerToChars(const Source t, char* const buffer) noexcept
+{
+    static_assert(sizeof(Source) <= sizeof(uint64_t), "only integers up to 64 bit are supported");
+
+    const bool isNegative = t < static_cast<Source>(0);
+    // the magnitude is calculated in unsigned arithmetic to also handle the minimum of signed types correctly
+    uint64_t magnitude = static_cast<uint64_t>(t);
+    if (isNegative)
+    {
+        magnitude = 0U - magnitude;
+    }
+
+    char reversedDigits[INTEGER_STRING_CAPACITY];
+    uint64_t numberOfDigits{0U};
+    do
+    {
+        reversedDigits[numberOfDigits++] = static_cast<char>('0' + static_cast<char>(magnitude % 10U));
+        magnitude /= 10U;
+    } while (magnitude != 0U);
+
+    uint64_t position{0U};
+    if (isNegative)
+    {
+        buffer[position++] = '-';
+    }
+    while (numberOfDigits > 0U)
+    {
+        buffer[position++] = reversedDigits[--numberOfDigits];
+    }
+    return position;
+}
+
 template <typename Source>
 inline typename std::enable_if<std::is_convertible<Source, std::string>::value, std::string>::type
 convert::toString(const Source& t)
@@ -193,230 +252,154 @@ inline bool convert::fromString<long double>(const char* v, long double& dest)
                 .has_error();
 }
 
-template <>
-inline bool convert::fromString<uint64_t>(const char* v, uint64_t& dest)
+inline bool convert::charsToUnsignedInteger(const char* v, uint64_t& value) noexcept
 {
-    if (!stringIsNumberWithErrorMessage(v, NumberType::UNSIGNED_INTEGER))
-    {
-        return false;
-    }
+    constexpr uint64_t MAX_VALUE_BEFORE_LAST_DIGIT = std::numeric_limits<uint64_t>::max() / 10U;
+    constexpr uint64_t MAX_LAST_DIGIT = std::numeric_limits<uint64_t>::max() % 10U;
 
-    auto call = posix::posixCall(strtoull)(v, nullptr, STRTOULL_BASE).failureReturnValue(ULLONG_MAX).evaluate();
-
-    if (call.has_error())
+    if (*v == '\0')
     {
         return false;
     }
 
-    if (call->value > std::numeric_limits<uint64_t>::max())
+    value = 0U;
+    for (; *v != '\0'; ++v)
     {
-        std::cerr << call->value << " too large, uint64_t overflow" << std::endl;
-        return false;
+        const uint64_t digit = static_cast<uint64_t>(*v - '0');
+        if (value > MAX_VALUE_BEFORE_LAST_DIGIT || (value == MAX_VALUE_BEFORE_LAST_DIGIT && digit > MAX_LAST_DIGIT))
+        {
+            return false;
+        }
+        value = value * 10U + digit;
     }
-
-    dest = static_cast<uint64_t>(call->value);
     return true;
 }
 
-#ifdef __APPLE__
-/// introduced for mac os since unsigned long is not uint64_t despite it has the same size
-/// who knows why ¯\_(ツ)_/¯
-template <>
-inline bool convert::fromString<unsigned long>(const char* v, unsigned long& dest)
-{
-    uint64_t temp{0};
-    bool retVal = fromString(v, temp);
-    dest = temp;
-    return retVal;
-}
-#endif
-
-template <>
-inline bool convert::fromString<uint32_t>(const char* v, uint32_t& dest)
+template <typename Destination>
+inline bool convert::fromStringToUnsignedInteger(const char* v, Destination& dest) noexcept
 {
     if (!stringIsNumberWithErrorMessage(v, NumberType::UNSIGNED_INTEGER))
     {
         return false;
     }
 
-    auto call = posix::posixCall(strtoull)(v, nullptr, STRTOULL_BASE).failureReturnValue(ULLONG_MAX).evaluate();
-
-    if (call.has_error())
-    {
-        return false;
-    }
-
-    if (call->value > std::numeric_limits<uint32_t>::max())
+    uint64_t value{0U};
+    if (!charsToUnsignedInteger(v, value)
+        || value > static_cast<uint64_t>(std::numeric_limits<Destination>::max()))
     {
-        std::cerr << call->value << " too large, uint32_t overflow" << std::endl;
+        std::cerr << v << " too large, unsigned integer overflow" << std::endl;
         return false;
     }
 
-    dest = static_cast<uint32_t>(call->value);
+    dest = static_cast<Destination>(value);
     return true;
 }
 
-template <>
-inline bool convert::fromString<uint16_t>(const char* v, uint16_t& dest)
+template <typename Destination>
+inline bool convert::fromStringToSignedInteger(const char* v, Destination& dest) noexcept
 {
-    if (!stringIsNumberWithErrorMessage(v, NumberType::UNSIGNED_INTEGER))
+    if (!stringIsNumberWithErrorMessage(v, NumberType::INTEGER))
     {
         return false;
     }
 
-    auto call = posix::posixCall(strtoul)(v, nullptr, STRTOULL_BASE).failureReturnValue(ULONG_MAX).evaluate();
+    const bool isNegative = (*v == '-');
+    const char* digits = (*v == '-' || *v == '+') ? v + 1 : v;
+
+    // the magnitude of the minimum is one larger than the maximum in two's complement
+    const uint64_t maxMagnitude =
+        static_cast<uint64_t>(std::numeric_limits<Destination>::max()) + (isNegative ? 1U : 0U);
 
-    if (call.has_error())
+    uint64_t magnitude{0U};
+    if (!charsToUnsignedInteger(digits, magnitude) || magnitude > maxMagnitude)
     {
+        std::cerr << v << " is out of range, signed integer overflow" << std::endl;
         return false;
     }
 
-    if (call->value > std::numeric_limits<uint16_t>::max())
+    if (isNegative && magnitude != 0U)
     {
-        std::cerr << call->value << " too large, uint16_t overflow" << std::endl;
-        return false;
+        dest = static_cast<Destination>(-static_cast<int64_t>(magnitude - 1U) - 1);
+    }
+    else
+    {
+        dest = static_cast<Destination>(magnitude);
     }
-
-    dest = static_cast<uint16_t>(call->value);
     return true;
 }
 
 template <>
-inline bool convert::fromString<uint8_t>(const char* v, uint8_t& dest)
+inline bool convert::fromString<uint64_t>(const char* v, uint64_t& dest)
 {
-    if (!stringIsNumberWithErrorMessage(v, NumberType::UNSIGNED_INTEGER))
-    {
-        return false;
-    }
+    return fromStringToUnsignedInteger(v, dest);
+}
 
-    auto call = posix::posixCall(strtoul)(v, nullptr, STRTOULL_BASE).failureReturnValue(ULONG_MAX).evaluate();
+#ifdef __APPLE__
+/// introduced for mac os since unsigned long is not uint64_t despite it has the same size
+/// who knows why ¯\_(ツ)_/¯
+template <>
+inline bool convert::fromString<unsigned long>(const char* v, unsigned long& dest)
+{
+    uint64_t temp{0};
+    bool retVal = fromString(v, temp);
+    dest = temp;
+    return retVal;
+}
+#endif
 
-    if (call.has_error())
-    {
-        return false;
-    }
+template <>
+inline bool convert::fromString<uint32_t>(const char* v, uint32_t& dest)
+{
+    return fromStringToUnsignedInteger(v, dest);
+}
 
-    if (call->value > std::numeric_limits<uint8_t>::max())
-    {
-        std::cerr << call->value << " too large, uint8_t overflow" << std::endl;
-        return false;
-    }
+template <>
+inline bool convert::fromString<uint16_t>(const char* v, uint16_t& dest)
+{
+    return fromStringToUnsignedInteger(v, dest);
+}
 
-    dest = static_cast<uint8_t>(call->value);
-    return true;
+template <>
+inline bool convert::fromString<uint8_t>(const char* v, uint8_t& dest)
+{
+    return fromStringToUnsignedInteger(v, dest);
 }
 
 template <>
 inline bool convert::fromString<int64_t>(const char* v, int64_t& dest)
 {
-    if (!stringIsNumberWithErrorMessage(v, NumberType::INTEGER))
-    {
-        return false;
-    }
-
-    auto call =
-        posix::posixCall(strtoll)(v, nullptr, STRTOULL_BASE).failureReturnValue(LLONG_MAX, LLONG_MIN).evaluate();
-    if (call.has_error())
-    {
-        return false;
-    }
-
-    if (call->value > std::numeric_limits<int64_t>::max() || call->value < std::numeric_limits<int64_t>::min())
-    {
-        std::cerr << call->value << " is out of range, int64_t overflow" << std::endl;
-        return false;
-    }
-
-    dest = static_cast<int64_t>(call->value);
-    return true;
+    return fromStringToSignedInteger(v, dest);
 }
 
 template <>
 inline bool convert::fromString<int32_t>(const char* v, int32_t& dest)
 {
-    if (!stringIsNumberWithErrorMessage(v, NumberType::INTEGER))
-    {
-        return false;
-    }
-
-    auto call =
-        posix::posixCall(strtoll)(v, nullptr, STRTOULL_BASE).failureReturnValue(LLONG_MAX, LLONG_MIN).evaluate();
-    if (call.has_error())
-    {
-        return false;
-    }
-
-    if (call->value > std::numeric_limits<int32_t>::max() || call->value < std::numeric_limits<int32_t>::min())
-    {
-        std::cerr << call->value << " is out of range, int32_t overflow" << std::endl;
-        return false;
-    }
-
-    dest = static_cast<int32_t>(call->value);
-    return true;
+    return fromStringToSignedInteger(v, dest);
 }
 
 template <>
 inline bool convert::fromString<int16_t>(const char* v, int16_t& dest)
 {
-    if (!stringIsNumberWithErrorMessage(v, NumberType::INTEGER))
-    {
-        return false;
-    }
-
-    auto call = posix::posixCall(strtol)(v, nullptr, STRTOULL_BASE).failureReturnValue(LONG_MAX, LONG_MIN).evaluate();
-    if (call.has_error())
-    {
-        return false;
-    }
-
-    if (call->value > std::numeric_limits<int16_t>::max() || call->value < std::numeric_limits<int16_t>::min())
-    {
-        std::cerr << call->value << " is out of range, int16_t overflow" << std::endl;
-        return false;
-    }
-
-    dest = static_cast<int16_t>(call->value);
-    return true;
+    return fromStringToSignedInteger(v, dest);
 }
 
 template <>
 inline bool convert::fromString<int8_t>(const char* v, int8_t& dest)
 {
-    if (!stringIsNumberWithErrorMessage(v, NumberType::INTEGER))
-    {
-        return false;
-    }
-
-    auto call = posix::posixCall(strtol)(v, nullptr, STRTOULL_BASE).failureReturnValue(LONG_MAX, LONG_MIN).evaluate();
-    if (call.has_error())
-    {
-        return false;
-    }
-
-    if (call->value > std::numeric_limits<int8_t>::max() || call->value < std::numeric_limits<int8_t>::min())
-    {
-        std::cerr << call->value << " is out of range, int8_t overflow" << std::endl;
-        return false;
-    }
-
-    dest = static_cast<int8_t>(call->value);
-    return true;
+    return fromStringToSignedInteger(v, dest);
 }
 
 template <>
 inline bool convert::fromString<bool>(const char* v, bool& dest)
 {
-    if (!stringIsNumberWithErrorMessage(v, NumberType::UNSIGNED_INTEGER))
+    uint64_t value{0U};
+    if (!fromStringToUnsignedInteger(v, value))
     {
         return false;
     }
 
-    return !posix::posixCall(strtoul)(v, nullptr, STRTOULL_BASE)
-                .failureReturnValue(ULONG_MAX)
-                .evaluate()
-                .and_then([&](auto& r) { dest = static_cast<bool>(r.value); })
-                .has_error();
+    dest = (value != 0U);
+    return true;
 }
 
 } // namespace cxx
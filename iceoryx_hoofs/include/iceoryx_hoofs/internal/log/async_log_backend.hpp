@@ -0,0 +1,90 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_LOG_ASYNC_LOG_BACKEND_HPP
+#define IOX_HOOFS_LOG_ASYNC_LOG_BACKEND_HPP
+
+#include "iceoryx_hoofs/concurrent/lockfree_queue.hpp"
+#include "iceoryx_hoofs/cxx/method_callback.hpp"
+#include "iceoryx_hoofs/cxx/string.hpp"
+#include "iceoryx_hoofs/internal/concurrent/periodic_task.hpp"
+#include "iceoryx_hoofs/log/logcommon.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+namespace iox
+{
+namespace log
+{
+/// @brief Decouples the logging threads from the console output. Log entries are copied into a preallocated
+/// lock-free queue and printed by a background task. If the queue is full the entry is dropped and counted, the
+/// number of dropped entries is reported with the next flush.
+class AsyncLogBackend
+{
+  public:
+    static constexpr uint64_t QUEUE_CAPACITY{1024U};
+    static constexpr uint64_t MAX_MESSAGE_LENGTH{512U};
+
+    /// @brief the backend and its background task are created on the first access and live until the end of the
+    /// process
+    static AsyncLogBackend& instance() noexcept;
+
+    /// @brief tells whether the backend is running and accepts entries; this is false before the first access and
+    /// once the backend was destroyed at process exit, e.g. when a static destructor logs after the backend is gone
+    /// @return true if entries can be pushed, otherwise false
+    static bool isActive() noexcept;
+
+    /// @brief stops the background task and prints all remaining entries
+    ~AsyncLogBackend() noexcept;
+
+    AsyncLogBackend(const AsyncLogBackend&) = delete;
+    AsyncLogBackend(AsyncLogBackend&&) = delete;
+    AsyncLogBackend& operator=(const AsyncLogBackend&) = delete;
+    AsyncLogBackend& operator=(AsyncLogBackend&&) = delete;
+
+    /// @brief copies the entry into the queue, messages longer than MAX_MESSAGE_LENGTH are truncated
+    /// @param[in] entry the log entry to print
+    /// @return false if the queue was full and the entry was dropped, otherwise true
+    bool push(const LogEntry& entry) noexcept;
+
+    /// @brief prints all queued entries and the number of entries which were dropped since the last flush
+    void flush() noexcept;
+
+    /// @brief returns the number of entries which were dropped since the creation of the backend
+    uint64_t droppedEntries() const noexcept;
+
+  private:
+    AsyncLogBackend() noexcept;
+
+    struct Entry
+    {
+        LogLevel level{LogLevel::kVerbose};
+        std::chrono::milliseconds time{0};
+        cxx::string<MAX_MESSAGE_LENGTH> message;
+    };
+
+    concurrent::LockFreeQueue<Entry, QUEUE_CAPACITY> m_queue;
+    std::atomic<uint64_t> m_droppedEntries{0U};
+    uint64_t m_reportedDroppedEntries{0U};
+    std::mutex m_flushMutex;
+    concurrent::PeriodicTask<cxx::MethodCallback<void>> m_flushTask;
+};
+
+} // namespace log
+} // namespace iox
+
+#endif // IOX_HOOFS_LOG_ASYNC_LOG_BACKEND_HPP
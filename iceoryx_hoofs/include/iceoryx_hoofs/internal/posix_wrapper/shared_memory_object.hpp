@@ -39,6 +39,14 @@ enum class SharedMemoryObjectError
     MAPPING_SHARED_MEMORY_FAILED,
 };
 
+/// @brief tag to create a SharedMemoryObject which is not backed by a named POSIX shared memory but by an anonymous
+/// private mapping, i.e. the memory is only accessible from within the creating process
+struct CreateUnnamedSingleProcessMemory_t
+{
+};
+static constexpr CreateUnnamedSingleProcessMemory_t CreateUnnamedSingleProcessMemory =
+    CreateUnnamedSingleProcessMemory_t();
+
 class SharedMemoryObject : public DesignPattern::Creation<SharedMemoryObject, SharedMemoryObjectError>
 {
   public:
@@ -56,8 +64,15 @@ class SharedMemoryObject : public DesignPattern::Creation<SharedMemoryObject, Sh
     void* getBaseAddress() const;
 
     uint64_t getSizeInBytes() const;
+
+    /// @brief the file handle of the underlying POSIX shared memory
+    /// @return the file handle or SharedMemory::INVALID_HANDLE for single process memory
     int getFileHandle() const;
 
+    /// @brief checks whether the memory was created with CreateUnnamedSingleProcessMemory
+    /// @return true if the memory is only accessible from within this process, otherwise false
+    bool isSingleProcessMemory() const;
+
     friend class DesignPattern::Creation<SharedMemoryObject, SharedMemoryObjectError>;
 
   private:
@@ -68,6 +83,12 @@ class SharedMemoryObject : public DesignPattern::Creation<SharedMemoryObject, Sh
                        const void* baseAddressHint,
                        const mode_t permissions = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
 
+    /// @brief creates zero initialized memory without a file descriptor and a name in /dev/shm; used when all
+    /// participants live in the same process
+    SharedMemoryObject(CreateUnnamedSingleProcessMemory_t,
+                       const uint64_t memorySizeInBytes,
+                       const void* baseAddressHint = NO_ADDRESS_HINT);
+
     bool isInitialized() const;
 
   private:
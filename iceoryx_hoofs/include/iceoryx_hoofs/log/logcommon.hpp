@@ -62,6 +62,13 @@ constexpr const char* LogLevelText[] = {
     "[Verbose]", // bold cyan
 };
 
+/// @brief defines whether a log entry is printed by the thread which creates it or handed over to a background task
+enum class LogDispatchMode : uint8_t
+{
+    kSynchronous = 0,
+    kAsynchronous
+};
+
 LogMode operator|(LogMode lhs, LogMode rhs);
 LogMode& operator|=(LogMode& lhs, LogMode rhs);
 LogMode operator&(LogMode lhs, LogMode rhs);
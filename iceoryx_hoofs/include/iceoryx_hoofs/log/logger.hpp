@@ -29,12 +29,10 @@ namespace iox
 {
 namespace log
 {
-/// @todo for asynchronous logging, make the logger an active object according to Herb Sutter
-/// https://herbsutter.com/2010/07/12/effective-concurrency-prefer-using-active-objects-instead-of-naked-threads/
-
 class Logger
 {
     friend class LogManager;
+    friend class AsyncLogBackend;
     /// @todo LogStream needs to call Log(); do we want to make Log() public?
     friend class LogStream;
 
@@ -63,7 +61,7 @@ class Logger
     virtual void Log(const LogEntry& entry) const;
 
   private:
-    void Print(const LogEntry entry) const;
+    static void Print(const LogLevel level, const std::chrono::milliseconds time, const char* message) noexcept;
 
     std::atomic<LogLevel> m_logLevel{LogLevel::kVerbose};
     std::atomic<LogMode> m_logMode{LogMode::kConsole};
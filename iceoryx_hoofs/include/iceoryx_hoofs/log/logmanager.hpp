@@ -54,12 +54,21 @@ class LogManager
     LogMode DefaultLogMode() const noexcept;
     void SetDefaultLogMode(const LogMode logMode) noexcept;
 
+    LogDispatchMode DefaultLogDispatchMode() const noexcept;
+    /// @brief With LogDispatchMode::kAsynchronous the log entries of all loggers are stored in a preallocated
+    /// lock-free queue and printed by a background task. When the queue is full, log entries are dropped and counted.
+    void SetDefaultLogDispatchMode(const LogDispatchMode logDispatchMode) noexcept;
+
+    /// @brief returns the number of log entries which were dropped in the asynchronous dispatch mode
+    uint64_t DroppedLogEntries() const noexcept;
+
   protected:
     LogManager() = default;
 
   private:
     std::atomic<LogLevel> m_defaultLogLevel{LogLevel::kVerbose};
     std::atomic<LogMode> m_defaultLogMode{LogMode::kConsole};
+    std::atomic<LogDispatchMode> m_defaultLogDispatchMode{LogDispatchMode::kSynchronous};
 
     std::map<std::string, Logger> m_loggers;
 };
@@ -31,6 +31,8 @@
 #include "iceoryx_hoofs/platform/platform_correction.hpp"
 
 #define MAP_SHARED 0
+#define MAP_PRIVATE 0
+#define MAP_ANONYMOUS 0x20
 #define MAP_FAILED 1
 #define PROT_NONE 0
 #define PROT_READ 3
@@ -31,6 +31,12 @@ void* mmap(void* addr, size_t length, int prot, int flags, int fd, off_t offset)
     DWORD fileOffsetLow = 0;
     DWORD numberOfBytesToMap = length;
 
+    if (flags & MAP_ANONYMOUS)
+    {
+        // committed pages are zero initialized like an anonymous mapping on POSIX systems
+        return Win32Call(VirtualAlloc, addr, numberOfBytesToMap, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE).value;
+    }
+
     void* mappedObject = Win32Call(MapViewOfFile,
                                    HandleTranslator::getInstance().get(fd),
                                    desiredAccess,
@@ -47,6 +53,13 @@ void* mmap(void* addr, size_t length, int prot, int flags, int fd, off_t offset)
 
 int munmap(void* addr, size_t length)
 {
+    MEMORY_BASIC_INFORMATION memoryInfo;
+    if (Win32Call(VirtualQuery, addr, &memoryInfo, sizeof(memoryInfo)).value != 0 && memoryInfo.Type == MEM_PRIVATE)
+    {
+        // memory of an anonymous mapping, see mmap
+        return Win32Call(VirtualFree, addr, static_cast<SIZE_T>(0), MEM_RELEASE).value ? 0 : -1;
+    }
+
     if (Win32Call(UnmapViewOfFile, addr).value)
     {
         return 0;
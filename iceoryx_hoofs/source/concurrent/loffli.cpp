@@ -104,5 +104,96 @@ bool LoFFLi::push(const Index_t index) noexcept
     return true;
 }
 
+uint32_t LoFFLi::popN(cxx::not_null<Index_t*> indices, const uint32_t maxNumberOfIndices) noexcept
+{
+    Index_t* const poppedIndices = indices;
+    uint32_t numberOfPoppedIndices{0U};
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    do
+    {
+        /// @brief the chain is walked without synchronization; if another thread pops or pushes in the meantime the
+        ///         values might be garbage but then the head and its abaCounter changed and the CAS below fails
+        numberOfPoppedIndices = 0U;
+        Index_t nextFreeIndex = oldHead.indexToNextFreeIndex;
+        while (numberOfPoppedIndices < maxNumberOfIndices && nextFreeIndex < m_size)
+        {
+            poppedIndices[numberOfPoppedIndices] = nextFreeIndex;
+            ++numberOfPoppedIndices;
+            nextFreeIndex = m_nextFreeIndex[nextFreeIndex];
+        }
+
+        // we are empty if next points to an element with index of Size
+        if (numberOfPoppedIndices == 0U)
+        {
+            return 0U;
+        }
+
+        newHead.indexToNextFreeIndex = nextFreeIndex;
+        newHead.abaCounter = oldHead.abaCounter + 1U;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    for (uint32_t i = 0U; i < numberOfPoppedIndices; ++i)
+    {
+        m_nextFreeIndex[poppedIndices[i]] = m_invalidIndex;
+    }
+
+    /// we need to synchronize m_nextFreeIndex with push so that we can perform a validation
+    /// check right before push to avoid double free's
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return numberOfPoppedIndices;
+}
+
+bool LoFFLi::pushN(cxx::not_null<const Index_t*> indices, const uint32_t numberOfIndices) noexcept
+{
+    const Index_t* const indicesToPush = indices;
+    if (numberOfIndices == 0U)
+    {
+        return true;
+    }
+
+    /// we synchronize with m_nextFreeIndex in pop to perform the validity check
+    std::atomic_thread_fence(std::memory_order_release);
+
+    /// link the indices to a chain; since a linked index no longer refers to m_invalidIndex, an index which is
+    /// contained twice fails the same check as an index which was not acquired in pop
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        const Index_t index = indicesToPush[i];
+        if (index >= m_size || m_nextFreeIndex[index] != m_invalidIndex)
+        {
+            for (uint32_t j = 0U; j < i; ++j)
+            {
+                m_nextFreeIndex[indicesToPush[j]] = m_invalidIndex;
+            }
+            return false;
+        }
+
+        /// the last index is linked to the head in the CAS loop
+        if (i + 1U < numberOfIndices)
+        {
+            m_nextFreeIndex[index] = indicesToPush[i + 1U];
+        }
+    }
+
+    const Index_t firstIndex = indicesToPush[0U];
+    const Index_t lastIndex = indicesToPush[numberOfIndices - 1U];
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    do
+    {
+        m_nextFreeIndex[lastIndex] = oldHead.indexToNextFreeIndex;
+        newHead.indexToNextFreeIndex = firstIndex;
+        newHead.abaCounter = oldHead.abaCounter + 1U;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    return true;
+}
+
 } // namespace concurrent
 } // namespace iox
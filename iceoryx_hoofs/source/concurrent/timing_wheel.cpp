@@ -0,0 +1,425 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/concurrent/timing_wheel.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace concurrent
+{
+constexpr uint32_t TimingWheel::MAX_NUMBER_OF_TIMERS;
+constexpr uint32_t TimingWheel::NUMBER_OF_LEVELS;
+constexpr uint32_t TimingWheel::SLOT_BITS;
+constexpr uint32_t TimingWheel::SLOTS_PER_LEVEL;
+constexpr units::Duration TimingWheel::DEFAULT_TICK_DURATION;
+constexpr uint32_t TimingWheel::INVALID_INDEX;
+constexpr uint32_t TimingWheel::NUMBER_OF_SLOTS;
+
+namespace
+{
+constexpr uint64_t SLOT_MASK{TimingWheel::SLOTS_PER_LEVEL - 1U};
+
+constexpr uint64_t levelShift(const uint32_t level) noexcept
+{
+    return static_cast<uint64_t>(level) * TimingWheel::SLOT_BITS;
+}
+} // namespace
+
+TimingWheel::TimingWheel(const units::Duration tickDuration, const posix::ThreadName_t& threadName) noexcept
+    : m_tickDuration(std::max<uint64_t>(tickDuration.toNanoseconds(), 1U))
+    , m_threadName(threadName)
+{
+    for (auto& slot : m_slots)
+    {
+        slot = INVALID_INDEX;
+    }
+
+    for (uint32_t i = 0U; i < MAX_NUMBER_OF_TIMERS; ++i)
+    {
+        m_timers[i].next = (i + 1U < MAX_NUMBER_OF_TIMERS) ? i + 1U : INVALID_INDEX;
+    }
+}
+
+TimingWheel::~TimingWheel() noexcept
+{
+    std::thread thread;
+    {
+        std::lock_guard<std::mutex> threadLock(m_threadMutex);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_keepRunning = false;
+        thread = std::move(m_thread);
+    }
+    m_wakeup.notify_one();
+    if (thread.joinable())
+    {
+        thread.join();
+    }
+}
+
+TimingWheel& TimingWheel::sharedInstance() noexcept
+{
+    static TimingWheel wheel{DEFAULT_TICK_DURATION, "SharedTimer"};
+    return wheel;
+}
+
+cxx::expected<TimingWheel::TimerId, TimingWheelError> TimingWheel::addTimer(const units::Duration timeout,
+                                                                            const TimingWheelTimerMode mode,
+                                                                            const Callback_t& callback) noexcept
+{
+    return addTimerImpl(timeout, (mode == TimingWheelTimerMode::PERIODIC) ? toTicks(timeout) : 0U, callback);
+}
+
+cxx::expected<TimingWheel::TimerId, TimingWheelError> TimingWheel::addTimer(const units::Duration initialTimeout,
+                                                                            const units::Duration period,
+                                                                            const Callback_t& callback) noexcept
+{
+    return addTimerImpl(initialTimeout, toTicks(period), callback);
+}
+
+cxx::expected<TimingWheel::TimerId, TimingWheelError> TimingWheel::addTimerImpl(const units::Duration initialTimeout,
+                                                                                const uint64_t periodInTicks,
+                                                                                const Callback_t& callback) noexcept
+{
+    if (!callback)
+    {
+        return cxx::error<TimingWheelError>(TimingWheelError::INVALID_TIMER_CALLBACK);
+    }
+
+    uint32_t index{INVALID_INDEX};
+    TimerId timerId{0U};
+    bool spawnThread{false};
+
+    std::lock_guard<std::mutex> threadLock(m_threadMutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_freeListHead == INVALID_INDEX)
+        {
+            return cxx::error<TimingWheelError>(TimingWheelError::TIMER_LIMIT_REACHED);
+        }
+
+        // an idle wheel does not turn; catch up with the wall clock before the new timer is placed relative to it
+        if (m_numberOfTimers == 0U)
+        {
+            m_currentTick = std::max(m_currentTick, elapsedTicks());
+        }
+
+        index = m_freeListHead;
+        auto& timer = m_timers[index];
+        m_freeListHead = timer.next;
+
+        timer.callback = callback;
+        // the wheel thread skips empty ticks and may lag behind, therefore the expiration is based on the wall clock
+        timer.expirationTick = std::max(m_currentTick, elapsedTicks()) + toTicks(initialTimeout);
+        timer.periodInTicks = periodInTicks;
+        timer.isActive = true;
+        ++m_numberOfTimers;
+        insert(index);
+
+        timerId = (static_cast<TimerId>(timer.generation) << 32U) | index;
+
+        spawnThread = !m_isThreadRunning;
+        m_isThreadRunning = true;
+    }
+
+    if (spawnThread)
+    {
+        // the previous thread terminated on its own when the last timer expired
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+        m_thread = std::thread(&TimingWheel::run, this);
+        posix::setThreadName(m_thread.native_handle(), m_threadName);
+    }
+    else
+    {
+        m_wakeup.notify_one();
+    }
+
+    return cxx::success<TimerId>(timerId);
+}
+
+bool TimingWheel::removeTimer(const TimerId timerId) noexcept
+{
+    const auto index = static_cast<uint32_t>(timerId & UINT32_MAX);
+    const auto generation = static_cast<uint32_t>(timerId >> 32U);
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (index >= MAX_NUMBER_OF_TIMERS)
+        {
+            return false;
+        }
+
+        auto& timer = m_timers[index];
+        if (timer.generation != generation || !timer.isActive)
+        {
+            return false;
+        }
+
+        timer.isActive = false;
+        if (m_executingTimer == index)
+        {
+            // the thread of the wheel releases the timer when the callback returns
+            if (std::this_thread::get_id() == m_threadId)
+            {
+                return true;
+            }
+            m_callbackFinished.wait(lock, [&] { return m_executingTimer != index; });
+        }
+        else
+        {
+            unlink(index);
+            release(index);
+        }
+    }
+
+    stopThreadIfIdle();
+    return true;
+}
+
+void TimingWheel::stopThreadIfIdle() noexcept
+{
+    // an idle wheel must not keep a thread alive, e.g. processes which fork expect to be single threaded then
+    std::lock_guard<std::mutex> threadLock(m_threadMutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_numberOfTimers != 0U || !m_thread.joinable())
+        {
+            return;
+        }
+        m_keepRunning = false;
+    }
+    m_wakeup.notify_one();
+    m_thread.join();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_keepRunning = true;
+}
+
+uint32_t TimingWheel::numberOfTimers() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numberOfTimers;
+}
+
+units::Duration TimingWheel::tickDuration() const noexcept
+{
+    return units::Duration(m_tickDuration);
+}
+
+void TimingWheel::run() noexcept
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_threadId = std::this_thread::get_id();
+    while (m_keepRunning && m_numberOfTimers != 0U)
+    {
+        // no predicate on purpose, a newly added timer wakes the thread up to recalculate the wakeup time
+        m_wakeup.wait_until(lock, timeOfTick(nextWakeupTick()));
+        if (!m_keepRunning)
+        {
+            break;
+        }
+
+        const uint64_t targetTick = elapsedTicks();
+        while (m_keepRunning && m_currentTick < targetTick && m_numberOfTimers != 0U)
+        {
+            advance();
+
+            const uint32_t slot = static_cast<uint32_t>(m_currentTick & SLOT_MASK);
+            while (m_keepRunning && m_slots[slot] != INVALID_INDEX)
+            {
+                const uint32_t index = m_slots[slot];
+                unlink(index);
+                fire(index, lock);
+            }
+        }
+    }
+    m_threadId = std::thread::id();
+    m_isThreadRunning = false;
+}
+
+void TimingWheel::advance() noexcept
+{
+    ++m_currentTick;
+
+    // cascade from the coarsest level down so that timers can fall through multiple levels within one tick
+    uint32_t highestLevel = 0U;
+    for (uint32_t level = 1U; level < NUMBER_OF_LEVELS; ++level)
+    {
+        if ((m_currentTick & ((1ULL << levelShift(level)) - 1U)) != 0U)
+        {
+            break;
+        }
+        highestLevel = level;
+    }
+
+    for (uint32_t level = highestLevel; level > 0U; --level)
+    {
+        cascade(level);
+    }
+}
+
+void TimingWheel::fire(const uint32_t index, std::unique_lock<std::mutex>& lock) noexcept
+{
+    auto& timer = m_timers[index];
+    m_executingTimer = index;
+
+    lock.unlock();
+    timer.callback();
+    lock.lock();
+
+    m_executingTimer = INVALID_INDEX;
+
+    if (timer.isActive && timer.periodInTicks != 0U)
+    {
+        // skip the periods which were missed due to a slow callback instead of firing them in a burst
+        timer.expirationTick += timer.periodInTicks;
+        if (timer.expirationTick <= m_currentTick)
+        {
+            timer.expirationTick = m_currentTick + timer.periodInTicks;
+        }
+        insert(index);
+    }
+    else
+    {
+        release(index);
+    }
+
+    m_callbackFinished.notify_all();
+}
+
+void TimingWheel::insert(const uint32_t index) noexcept
+{
+    auto& timer = m_timers[index];
+    const uint64_t expiration = std::max(timer.expirationTick, m_currentTick);
+
+    // a timer is placed on the finest level on which it shares the enclosing slot of the next coarser level with the
+    // current tick; it is then cascaded down exactly when the wheel enters its slot
+    uint32_t level = 0U;
+    uint64_t slotTick = expiration;
+    while (level < NUMBER_OF_LEVELS && (expiration >> levelShift(level + 1U)) != (m_currentTick >> levelShift(level + 1U)))
+    {
+        ++level;
+    }
+
+    if (level == NUMBER_OF_LEVELS)
+    {
+        // beyond the range of the wheel; park it in the next slot of the top level, it is reinserted from there
+        level = NUMBER_OF_LEVELS - 1U;
+        slotTick = ((m_currentTick >> levelShift(level)) + 1U) << levelShift(level);
+    }
+
+    const uint32_t slot =
+        level * SLOTS_PER_LEVEL + static_cast<uint32_t>((slotTick >> levelShift(level)) & SLOT_MASK);
+
+    timer.slot = slot;
+    timer.previous = INVALID_INDEX;
+    timer.next = m_slots[slot];
+    if (timer.next != INVALID_INDEX)
+    {
+        m_timers[timer.next].previous = index;
+    }
+    m_slots[slot] = index;
+}
+
+void TimingWheel::unlink(const uint32_t index) noexcept
+{
+    auto& timer = m_timers[index];
+    if (timer.slot == INVALID_INDEX)
+    {
+        return;
+    }
+
+    if (timer.previous != INVALID_INDEX)
+    {
+        m_timers[timer.previous].next = timer.next;
+    }
+    else
+    {
+        m_slots[timer.slot] = timer.next;
+    }
+
+    if (timer.next != INVALID_INDEX)
+    {
+        m_timers[timer.next].previous = timer.previous;
+    }
+
+    timer.slot = INVALID_INDEX;
+    timer.previous = INVALID_INDEX;
+    timer.next = INVALID_INDEX;
+}
+
+void TimingWheel::release(const uint32_t index) noexcept
+{
+    auto& timer = m_timers[index];
+    timer.callback = Callback_t();
+    timer.isActive = false;
+    ++timer.generation;
+    timer.next = m_freeListHead;
+    m_freeListHead = index;
+    --m_numberOfTimers;
+}
+
+void TimingWheel::cascade(const uint32_t level) noexcept
+{
+    const uint32_t slot = level * SLOTS_PER_LEVEL + static_cast<uint32_t>((m_currentTick >> levelShift(level)) & SLOT_MASK);
+    while (m_slots[slot] != INVALID_INDEX)
+    {
+        const uint32_t index = m_slots[slot];
+        unlink(index);
+        insert(index);
+    }
+}
+
+uint64_t TimingWheel::toTicks(const units::Duration duration) const noexcept
+{
+    const uint64_t tickInNanoseconds = static_cast<uint64_t>(m_tickDuration.count());
+    const uint64_t ticks = (duration.toNanoseconds() + tickInNanoseconds - 1U) / tickInNanoseconds;
+    return std::max<uint64_t>(ticks, 1U);
+}
+
+uint64_t TimingWheel::elapsedTicks() const noexcept
+{
+    const auto elapsed = std::chrono::steady_clock::now() - m_startTime;
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()
+                                 / m_tickDuration.count());
+}
+
+std::chrono::steady_clock::time_point TimingWheel::timeOfTick(const uint64_t tick) const noexcept
+{
+    return m_startTime + m_tickDuration * tick;
+}
+
+uint64_t TimingWheel::nextWakeupTick() const noexcept
+{
+    // the wheel has to wake up for the next occupied slot of the finest level, but at the latest when the finest
+    // level wraps around and the next cascade is due; empty ticks in between are skipped
+    const uint64_t nextWrapTick = ((m_currentTick >> SLOT_BITS) + 1U) << SLOT_BITS;
+    for (uint64_t tick = m_currentTick + 1U; tick < nextWrapTick; ++tick)
+    {
+        if (m_slots[tick & SLOT_MASK] != INVALID_INDEX)
+        {
+            return tick;
+        }
+    }
+    return nextWrapTick;
+}
+
+} // namespace concurrent
+} // namespace iox
@@ -0,0 +1,108 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/log/async_log_backend.hpp"
+
+#include "iceoryx_hoofs/log/logger.hpp"
+
+#include <string>
+
+namespace iox
+{
+namespace log
+{
+constexpr uint64_t AsyncLogBackend::QUEUE_CAPACITY;
+constexpr uint64_t AsyncLogBackend::MAX_MESSAGE_LENGTH;
+
+namespace
+{
+// constant initialized and trivially destructible, therefore still usable by static destructors which run after
+// the destructor of the backend
+std::atomic<bool> g_asyncLogBackendIsActive{false};
+} // namespace
+
+AsyncLogBackend& AsyncLogBackend::instance() noexcept
+{
+    static AsyncLogBackend backend;
+    return backend;
+}
+
+bool AsyncLogBackend::isActive() noexcept
+{
+    return g_asyncLogBackendIsActive.load(std::memory_order_acquire);
+}
+
+AsyncLogBackend::AsyncLogBackend() noexcept
+    : m_flushTask(concurrent::PeriodicTaskAutoStart,
+                  units::Duration::fromMilliseconds(10U),
+                  "LogFlush",
+                  *this,
+                  &AsyncLogBackend::flush)
+{
+    g_asyncLogBackendIsActive.store(true, std::memory_order_release);
+}
+
+AsyncLogBackend::~AsyncLogBackend() noexcept
+{
+    g_asyncLogBackendIsActive.store(false, std::memory_order_release);
+    m_flushTask.stop();
+    flush();
+}
+
+bool AsyncLogBackend::push(const LogEntry& entry) noexcept
+{
+    Entry asyncEntry;
+    asyncEntry.level = entry.level;
+    asyncEntry.time = entry.time;
+    asyncEntry.message = cxx::string<MAX_MESSAGE_LENGTH>(cxx::TruncateToCapacity, entry.message);
+
+    if (!m_queue.tryPush(std::move(asyncEntry)))
+    {
+        m_droppedEntries.fetch_add(1U, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+void AsyncLogBackend::flush() noexcept
+{
+    std::lock_guard<std::mutex> lock(m_flushMutex);
+
+    for (auto entry = m_queue.pop(); entry.has_value(); entry = m_queue.pop())
+    {
+        Logger::Print(entry->level, entry->time, entry->message.c_str());
+    }
+
+    auto droppedEntries = m_droppedEntries.load(std::memory_order_relaxed);
+    if (droppedEntries != m_reportedDroppedEntries)
+    {
+        auto timePoint = std::chrono::high_resolution_clock::now();
+        auto message = std::to_string(droppedEntries - m_reportedDroppedEntries)
+                       + " log entries were dropped since the log queue was full";
+        Logger::Print(LogLevel::kWarn,
+                      std::chrono::duration_cast<std::chrono::milliseconds>(timePoint.time_since_epoch()),
+                      message.c_str());
+        m_reportedDroppedEntries = droppedEntries;
+    }
+}
+
+uint64_t AsyncLogBackend::droppedEntries() const noexcept
+{
+    return m_droppedEntries.load(std::memory_order_relaxed);
+}
+
+} // namespace log
+} // namespace iox
@@ -17,7 +17,9 @@
 
 #include "iceoryx_hoofs/log/logger.hpp"
 
+#include "iceoryx_hoofs/internal/log/async_log_backend.hpp"
 #include "iceoryx_hoofs/log/logging.hpp"
+#include "iceoryx_hoofs/log/logmanager.hpp"
 #include "iceoryx_hoofs/log/logstream.hpp"
 
 #include "iceoryx_hoofs/cxx/attributes.hpp"
@@ -102,22 +104,21 @@ LogStream Logger::LogVerbose() noexcept
     return LogStream(*this, LogLevel::kVerbose);
 }
 
-void Logger::Print(const LogEntry entry) const
+void Logger::Print(const LogLevel level, const std::chrono::milliseconds time, const char* message) noexcept
 {
-    // as long as there is only this synchronous logger, buffer the output before using clog to prevent interleaving
-    // output because of threaded access
+    // buffer the output before using clog to prevent interleaving output because of threaded access in the
+    // synchronous dispatch mode
     std::stringstream buffer;
 
-    auto sec = std::chrono::duration_cast<std::chrono::seconds>(entry.time);
-    std::time_t time = sec.count();
+    auto sec = std::chrono::duration_cast<std::chrono::seconds>(time);
+    std::time_t timeInSeconds = sec.count();
 
-    auto timeInfo = std::localtime(&time);
+    auto timeInfo = std::localtime(&timeInSeconds);
 
     buffer << "\033[0;90m" << std::put_time(timeInfo, "%Y-%m-%d %H:%M:%S");
-    buffer << "." << std::right << std::setfill('0') << std::setw(3) << entry.time.count() % 1000 << " ";
-    buffer << LogLevelColor[cxx::enumTypeAsUnderlyingType(entry.level)]
-           << LogLevelText[cxx::enumTypeAsUnderlyingType(entry.level)];
-    buffer << "\033[m: " << entry.message << std::endl;
+    buffer << "." << std::right << std::setfill('0') << std::setw(3) << time.count() % 1000 << " ";
+    buffer << LogLevelColor[cxx::enumTypeAsUnderlyingType(level)] << LogLevelText[cxx::enumTypeAsUnderlyingType(level)];
+    buffer << "\033[m: " << message << std::endl;
     std::clog << buffer.str();
 }
 
@@ -132,7 +133,28 @@ void Logger::Log(const LogEntry& entry) const
     /// event if they are below the current log level and print them if case of kFatal?
     if (IsEnabled(entry.level))
     {
-        Print(entry);
+        // fall back to the synchronous output once the backend is shut down, e.g. when logging from a static
+        // destructor at process exit
+        if (LogManager::GetLogManager().DefaultLogDispatchMode() == LogDispatchMode::kAsynchronous
+            && AsyncLogBackend::isActive())
+        {
+            auto& backend = AsyncLogBackend::instance();
+            if (entry.level <= LogLevel::kError)
+            {
+                // errors are often followed by std::terminate, therefore they are printed right away; the queued
+                // entries are printed first to preserve the order
+                backend.flush();
+                Print(entry.level, entry.time, entry.message.c_str());
+            }
+            else
+            {
+                backend.push(entry);
+            }
+        }
+        else
+        {
+            Print(entry.level, entry.time, entry.message.c_str());
+        }
     }
 }
 
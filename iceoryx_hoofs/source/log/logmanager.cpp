@@ -19,6 +19,7 @@
 
 #include "iceoryx_hoofs/cxx/attributes.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/internal/log/async_log_backend.hpp"
 #include "iceoryx_hoofs/log/logger.hpp"
 #include "logging_internal.hpp"
 
@@ -100,5 +101,29 @@ void LogManager::SetDefaultLogMode(const LogMode logMode) noexcept
     }
 }
 
+LogDispatchMode LogManager::DefaultLogDispatchMode() const noexcept
+{
+    return m_defaultLogDispatchMode.load(std::memory_order_relaxed);
+}
+
+void LogManager::SetDefaultLogDispatchMode(const LogDispatchMode logDispatchMode) noexcept
+{
+    if (logDispatchMode == LogDispatchMode::kAsynchronous)
+    {
+        // create the backend before the first entry is pushed; once started it keeps flushing until the end of
+        // the process so that no entry gets stuck in the queue when switching back to synchronous mode
+        AsyncLogBackend::instance();
+    }
+
+    m_defaultLogDispatchMode.store(logDispatchMode, std::memory_order_relaxed);
+}
+
+uint64_t LogManager::DroppedLogEntries() const noexcept
+{
+    return (m_defaultLogDispatchMode.load(std::memory_order_relaxed) == LogDispatchMode::kAsynchronous)
+               ? AsyncLogBackend::instance().droppedEntries()
+               : 0U;
+}
+
 } // namespace log
 } // namespace iox
@@ -117,6 +117,38 @@ SharedMemoryObject::SharedMemoryObject(const SharedMemory::Name_t& name,
     }
 }
 
+SharedMemoryObject::SharedMemoryObject(CreateUnnamedSingleProcessMemory_t,
+                                       const uint64_t memorySizeInBytes,
+                                       const void* baseAddressHint)
+    : m_memorySizeInBytes(cxx::align(memorySizeInBytes, Allocator::MEMORY_ALIGNMENT))
+{
+    m_isInitialized = true;
+
+    // an anonymous mapping is zero initialized by the OS and the pages are only committed when they are touched
+    constexpr int32_t NO_FILE_DESCRIPTOR{-1};
+    MemoryMap::create(baseAddressHint,
+                      m_memorySizeInBytes,
+                      NO_FILE_DESCRIPTOR,
+                      AccessMode::READ_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS,
+                      0)
+        .and_then([this](auto& memoryMap) { m_memoryMap.emplace(std::move(memoryMap)); })
+        .or_else([this](auto) {
+            std::cerr << "Failed to map single process memory into process!" << std::endl;
+            m_isInitialized = false;
+            m_errorValue = SharedMemoryObjectError::MAPPING_SHARED_MEMORY_FAILED;
+        });
+
+    if (m_isInitialized == false)
+    {
+        std::cerr << "Unable to create a single process memory object with the following properties [ sizeInBytes = "
+                  << memorySizeInBytes << ", baseAddressHint = " << std::hex << baseAddressHint << " ]" << std::endl;
+        return;
+    }
+
+    m_allocator.emplace(m_memoryMap->getBaseAddress(), m_memorySizeInBytes);
+}
+
 void* SharedMemoryObject::allocate(const uint64_t size, const uint64_t alignment)
 {
     return m_allocator->allocate(size, alignment);
@@ -149,7 +181,12 @@ uint64_t SharedMemoryObject::getSizeInBytes() const
 
 int32_t SharedMemoryObject::getFileHandle() const
 {
-    return m_sharedMemory->getHandle();
+    return m_sharedMemory.has_value() ? m_sharedMemory->getHandle() : SharedMemory::INVALID_HANDLE;
+}
+
+bool SharedMemoryObject::isSingleProcessMemory() const
+{
+    return !m_sharedMemory.has_value();
 }
 
 } // namespace posix
@@ -0,0 +1,86 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/internal/concurrent/fifo.hpp"
+#include "iceoryx_hoofs/internal/concurrent/sofi.hpp"
+
+#include "benchmark_queue.hpp"
+
+namespace iox
+{
+namespace benchmarks
+{
+constexpr uint64_t FIFO_CAPACITY{1024U};
+using FiFo_t = concurrent::FiFo<uint64_t, FIFO_CAPACITY>;
+using SoFi_t = concurrent::SoFi<uint64_t, FIFO_CAPACITY>;
+
+template <>
+struct QueueOperations<FiFo_t>
+{
+    static FiFo_t* create() noexcept
+    {
+        return new FiFo_t();
+    }
+    static bool tryPush(FiFo_t& queue, const uint64_t value) noexcept
+    {
+        return queue.push(value);
+    }
+    static bool tryPop(FiFo_t& queue, uint64_t& value) noexcept
+    {
+        auto result = queue.pop();
+        if (result.has_value())
+        {
+            value = result.value();
+            return true;
+        }
+        return false;
+    }
+};
+
+template <>
+struct QueueOperations<SoFi_t>
+{
+    static SoFi_t* create() noexcept
+    {
+        return new SoFi_t();
+    }
+    static bool tryPush(SoFi_t& queue, const uint64_t value) noexcept
+    {
+        // the SoFi would overwrite the oldest value when full which would let the consumer wait forever; since there
+        // is only one producer the size cannot grow between the check and the push
+        if (queue.size() >= queue.capacity())
+        {
+            return false;
+        }
+        uint64_t overflowValue{0U};
+        queue.push(value, overflowValue);
+        return true;
+    }
+    static bool tryPop(SoFi_t& queue, uint64_t& value) noexcept
+    {
+        return queue.pop(value);
+    }
+};
+
+// FiFo and SoFi are single-producer single-consumer queues
+BENCHMARK_TEMPLATE(PushPop, FiFo_t)->Threads(1);
+BENCHMARK_TEMPLATE(ProducerConsumer, FiFo_t)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(PushPop, SoFi_t)->Threads(1);
+BENCHMARK_TEMPLATE(ProducerConsumer, SoFi_t)->Threads(2)->UseRealTime();
+
+} // namespace benchmarks
+} // namespace iox
@@ -0,0 +1,48 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_BENCHMARKS_BENCHMARK_HELPER_HPP
+#define IOX_HOOFS_BENCHMARKS_BENCHMARK_HELPER_HPP
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace iox
+{
+namespace benchmarks
+{
+/// @brief upper limit for the number of threads of the multi threaded benchmarks
+constexpr int MAX_NUMBER_OF_THREADS{16};
+
+/// @brief The multi threaded benchmarks are run with 1, 2, 4, ... up to this number of threads
+/// @return the number of hardware threads limited to MAX_NUMBER_OF_THREADS and rounded down to an even number but
+/// at least 2 in order to always have a producer and a consumer
+int maxNumberOfThreads() noexcept;
+
+/// @brief Enables the pinning of the benchmark threads
+/// @param[in] firstCpu the thread with index i is pinned to CPU (firstCpu + i) modulo the number of CPUs; a
+/// negative value disables the pinning
+void setFirstCpu(const int32_t firstCpu) noexcept;
+
+/// @brief Pins the calling benchmark thread according to setFirstCpu; does nothing if pinning is disabled
+/// @param[in] state of the running benchmark, provides the index of the calling thread
+void pinThisThread(const ::benchmark::State& state) noexcept;
+
+} // namespace benchmarks
+} // namespace iox
+
+#endif // IOX_HOOFS_BENCHMARKS_BENCHMARK_HELPER_HPP
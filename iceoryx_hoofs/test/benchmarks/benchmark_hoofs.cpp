@@ -0,0 +1,104 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "benchmark_helper.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace iox
+{
+namespace benchmarks
+{
+namespace
+{
+std::atomic<int32_t> g_firstCpu{-1};
+
+constexpr const char PIN_OPTION[]{"--iox_first_cpu="};
+} // namespace
+
+int maxNumberOfThreads() noexcept
+{
+    const auto numberOfCpus = static_cast<int>(std::thread::hardware_concurrency());
+    // an even number of threads is required to have a consumer for every producer
+    return std::max(2, std::min(numberOfCpus, MAX_NUMBER_OF_THREADS) & ~1);
+}
+
+void setFirstCpu(const int32_t firstCpu) noexcept
+{
+    g_firstCpu.store(firstCpu, std::memory_order_relaxed);
+}
+
+void pinThisThread(const ::benchmark::State& state) noexcept
+{
+    const auto firstCpu = g_firstCpu.load(std::memory_order_relaxed);
+    if (firstCpu < 0)
+    {
+        return;
+    }
+#ifdef __linux__
+    const auto numberOfCpus = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(static_cast<size_t>((firstCpu + state.thread_index()) % numberOfCpus), &cpuset);
+    auto retVal = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+    if (retVal != 0)
+    {
+        std::cerr << "Error calling pthread_setaffinity_np: " << retVal << std::endl;
+    }
+#else
+    static_cast<void>(state); // fix unused variable warning
+#endif
+}
+
+} // namespace benchmarks
+} // namespace iox
+
+int main(int argc, char** argv)
+{
+    // the pinning option has to be removed before google benchmark complains about an unknown argument
+    int remainingArgc{0};
+    for (int i = 0; i < argc; ++i)
+    {
+        if (std::strncmp(argv[i], iox::benchmarks::PIN_OPTION, sizeof(iox::benchmarks::PIN_OPTION) - 1U) == 0)
+        {
+            iox::benchmarks::setFirstCpu(
+                static_cast<int32_t>(std::atoi(argv[i] + sizeof(iox::benchmarks::PIN_OPTION) - 1U)));
+            continue;
+        }
+        argv[remainingArgc++] = argv[i];
+    }
+
+    ::benchmark::Initialize(&remainingArgc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(remainingArgc, argv))
+    {
+        std::cerr << "Additional option:\n  " << iox::benchmarks::PIN_OPTION
+                  << "<cpu>  pin the benchmark thread i to CPU <cpu> + i" << std::endl;
+        return EXIT_FAILURE;
+    }
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,179 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/concurrent/lockfree_queue.hpp"
+#include "iceoryx_hoofs/concurrent/resizeable_lockfree_queue.hpp"
+#include "iceoryx_hoofs/internal/concurrent/lockfree_queue/index_queue.hpp"
+
+#include "benchmark_queue.hpp"
+
+#include <vector>
+
+namespace iox
+{
+namespace benchmarks
+{
+constexpr uint64_t QUEUE_CAPACITY{1024U};
+using LockFreeQueue_t = concurrent::LockFreeQueue<uint64_t, QUEUE_CAPACITY>;
+using ResizeableLockFreeQueue_t = concurrent::ResizeableLockFreeQueue<uint64_t, QUEUE_CAPACITY>;
+using IndexQueue_t = concurrent::IndexQueue<QUEUE_CAPACITY>;
+
+template <typename Queue>
+struct LockFreeQueueOperations
+{
+    static Queue* create() noexcept
+    {
+        return new Queue();
+    }
+    static bool tryPush(Queue& queue, const uint64_t value) noexcept
+    {
+        return queue.tryPush(value);
+    }
+    static bool tryPop(Queue& queue, uint64_t& value) noexcept
+    {
+        auto result = queue.pop();
+        if (result.has_value())
+        {
+            value = result.value();
+            return true;
+        }
+        return false;
+    }
+};
+
+template <>
+struct QueueOperations<LockFreeQueue_t> : public LockFreeQueueOperations<LockFreeQueue_t>
+{
+};
+
+template <>
+struct QueueOperations<ResizeableLockFreeQueue_t> : public LockFreeQueueOperations<ResizeableLockFreeQueue_t>
+{
+};
+
+template <>
+struct QueueOperations<IndexQueue_t>
+{
+    static IndexQueue_t* create() noexcept
+    {
+        return new IndexQueue_t(IndexQueue_t::ConstructEmpty);
+    }
+    static bool tryPush(IndexQueue_t& queue, const uint64_t value) noexcept
+    {
+        // the IndexQueue must never be full when pushing, this holds since the number of elements in PushPop is
+        // limited by the number of threads
+        queue.push(value % QUEUE_CAPACITY);
+        return true;
+    }
+    static bool tryPop(IndexQueue_t& queue, uint64_t& value) noexcept
+    {
+        auto result = queue.pop();
+        if (result.has_value())
+        {
+            value = result.value();
+            return true;
+        }
+        return false;
+    }
+};
+
+/// @brief The IndexQueue is used in pairs by the LockFreeQueue, one queue holds the free indices and the other one
+/// the used indices. Producers move an index from the free to the used queue and consumers move it back, therefore
+/// no queue can overflow.
+void IndexQueueProducerConsumer(::benchmark::State& state)
+{
+    static std::unique_ptr<IndexQueue_t> freeIndices;
+    static std::unique_ptr<IndexQueue_t> usedIndices;
+
+    pinThisThread(state);
+    if (state.thread_index() == 0)
+    {
+        freeIndices.reset(new IndexQueue_t(IndexQueue_t::ConstructFull));
+        usedIndices.reset(new IndexQueue_t(IndexQueue_t::ConstructEmpty));
+    }
+
+    auto& source = ((state.thread_index() % 2) == 0) ? freeIndices : usedIndices;
+    auto& destination = ((state.thread_index() % 2) == 0) ? usedIndices : freeIndices;
+    for (auto _ : state)
+    {
+        cxx::optional<uint64_t> index;
+        do
+        {
+            index = source->pop();
+        } while (!index.has_value());
+        destination->push(index.value());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+    if (state.thread_index() == 0)
+    {
+        freeIndices.reset();
+        usedIndices.reset();
+    }
+}
+
+/// @brief Every thread pushes and pops the number of elements given by the benchmark argument at once
+template <typename Queue>
+void PushNPopN(::benchmark::State& state)
+{
+    static std::unique_ptr<Queue> queue;
+
+    pinThisThread(state);
+    if (state.thread_index() == 0)
+    {
+        queue.reset(new Queue());
+    }
+
+    const auto batchSize = static_cast<uint64_t>(state.range(0));
+    std::vector<uint64_t> values(batchSize);
+    for (auto _ : state)
+    {
+        uint64_t numberOfPushedValues{0U};
+        while (numberOfPushedValues < batchSize)
+        {
+            numberOfPushedValues +=
+                queue->tryPushN(values.data() + numberOfPushedValues, batchSize - numberOfPushedValues);
+        }
+        uint64_t numberOfPoppedValues{0U};
+        while (numberOfPoppedValues < batchSize)
+        {
+            numberOfPoppedValues += queue->popN(values.data() + numberOfPoppedValues, batchSize - numberOfPoppedValues);
+        }
+        ::benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(2 * static_cast<int64_t>(state.iterations() * batchSize));
+
+    if (state.thread_index() == 0)
+    {
+        queue.reset();
+    }
+}
+
+BENCHMARK_TEMPLATE(PushPop, LockFreeQueue_t)->ThreadRange(1, maxNumberOfThreads())->UseRealTime();
+BENCHMARK_TEMPLATE(ProducerConsumer, LockFreeQueue_t)->ThreadRange(2, maxNumberOfThreads())->UseRealTime();
+BENCHMARK_TEMPLATE(PushPop, ResizeableLockFreeQueue_t)->ThreadRange(1, maxNumberOfThreads())->UseRealTime();
+BENCHMARK_TEMPLATE(ProducerConsumer, ResizeableLockFreeQueue_t)->ThreadRange(2, maxNumberOfThreads())->UseRealTime();
+BENCHMARK_TEMPLATE(PushPop, IndexQueue_t)->ThreadRange(1, maxNumberOfThreads())->UseRealTime();
+BENCHMARK(IndexQueueProducerConsumer)->ThreadRange(2, maxNumberOfThreads())->UseRealTime();
+BENCHMARK_TEMPLATE(PushNPopN, LockFreeQueue_t)
+    ->RangeMultiplier(4)
+    ->Range(4, 64)
+    ->ThreadRange(1, maxNumberOfThreads())
+    ->UseRealTime();
+
+} // namespace benchmarks
+} // namespace iox
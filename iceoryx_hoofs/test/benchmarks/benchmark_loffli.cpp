@@ -0,0 +1,105 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
+
+#include "benchmark_helper.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace iox
+{
+namespace benchmarks
+{
+constexpr uint32_t LOFFLI_CAPACITY{1024U};
+
+struct LoFFLiWithMemory
+{
+    LoFFLiWithMemory() noexcept
+    {
+        loffli.init(memory, LOFFLI_CAPACITY);
+    }
+
+    concurrent::LoFFLi::Index_t memory[concurrent::LoFFLi::requiredIndexMemorySize(LOFFLI_CAPACITY)];
+    concurrent::LoFFLi loffli;
+};
+
+/// @brief Every thread acquires an index and releases it again like the MemPool does on every chunk allocation
+void LoFFLiPopPush(::benchmark::State& state)
+{
+    static std::unique_ptr<LoFFLiWithMemory> sut;
+
+    pinThisThread(state);
+    if (state.thread_index() == 0)
+    {
+        sut.reset(new LoFFLiWithMemory());
+    }
+
+    concurrent::LoFFLi::Index_t index{0U};
+    for (auto _ : state)
+    {
+        while (!sut->loffli.pop(index))
+        {
+        }
+        ::benchmark::DoNotOptimize(index);
+        sut->loffli.push(index);
+    }
+    state.SetItemsProcessed(2 * static_cast<int64_t>(state.iterations()));
+
+    if (state.thread_index() == 0)
+    {
+        sut.reset();
+    }
+}
+
+/// @brief Every thread acquires the number of indices given by the benchmark argument at once and releases them
+void LoFFLiPopNPushN(::benchmark::State& state)
+{
+    static std::unique_ptr<LoFFLiWithMemory> sut;
+
+    pinThisThread(state);
+    if (state.thread_index() == 0)
+    {
+        sut.reset(new LoFFLiWithMemory());
+    }
+
+    const auto batchSize = static_cast<uint32_t>(state.range(0));
+    std::vector<concurrent::LoFFLi::Index_t> indices(batchSize);
+    for (auto _ : state)
+    {
+        uint32_t numberOfIndices{0U};
+        while (numberOfIndices == 0U)
+        {
+            numberOfIndices = sut->loffli.popN(indices.data(), batchSize);
+        }
+        ::benchmark::DoNotOptimize(indices.data());
+        sut->loffli.pushN(indices.data(), numberOfIndices);
+    }
+    state.SetItemsProcessed(2 * static_cast<int64_t>(state.iterations()) * batchSize);
+
+    if (state.thread_index() == 0)
+    {
+        sut.reset();
+    }
+}
+
+BENCHMARK(LoFFLiPopPush)->ThreadRange(1, maxNumberOfThreads())->UseRealTime();
+BENCHMARK(LoFFLiPopNPushN)->RangeMultiplier(4)->Range(4, 64)->ThreadRange(1, maxNumberOfThreads())->UseRealTime();
+
+} // namespace benchmarks
+} // namespace iox
@@ -0,0 +1,118 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_BENCHMARKS_BENCHMARK_QUEUE_HPP
+#define IOX_HOOFS_BENCHMARKS_BENCHMARK_QUEUE_HPP
+
+#include "benchmark_helper.hpp"
+
+#include <cstdint>
+#include <memory>
+
+namespace iox
+{
+namespace benchmarks
+{
+/// @brief Maps the different push and pop signatures of the queues to a common interface. Every queue under test
+/// needs a specialization with
+///   - static Queue* create() which returns a new and empty queue
+///   - static bool tryPush(Queue& queue, const uint64_t value) which returns false if the queue is full
+///   - static bool tryPop(Queue& queue, uint64_t& value) which returns false if the queue is empty
+template <typename Queue>
+struct QueueOperations;
+
+/// @brief Every thread pushes a value and pops a value in every iteration, i.e. the time per iteration is the
+/// latency of a push-pop pair under contention with all other threads. Suitable for multi-producer multi-consumer
+/// queues only; single-producer single-consumer queues must be registered with one thread.
+template <typename Queue>
+void PushPop(::benchmark::State& state)
+{
+    using Operations = QueueOperations<Queue>;
+    static std::unique_ptr<Queue> queue;
+
+    pinThisThread(state);
+    if (state.thread_index() == 0)
+    {
+        queue.reset(Operations::create());
+    }
+
+    uint64_t value{0U};
+    // google benchmark synchronizes all threads before the first and after the last iteration
+    for (auto _ : state)
+    {
+        while (!Operations::tryPush(*queue, value))
+        {
+        }
+        while (!Operations::tryPop(*queue, value))
+        {
+        }
+        ::benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(2 * static_cast<int64_t>(state.iterations()));
+
+    if (state.thread_index() == 0)
+    {
+        queue.reset();
+    }
+}
+
+/// @brief Threads with an even index only push and threads with an odd index only pop, i.e. the items per second are
+/// the throughput of the queue. Since all threads run the same number of iterations, the benchmark must be
+/// registered with an even number of threads; with two threads it is also suitable for single-producer
+/// single-consumer queues.
+template <typename Queue>
+void ProducerConsumer(::benchmark::State& state)
+{
+    using Operations = QueueOperations<Queue>;
+    static std::unique_ptr<Queue> queue;
+
+    pinThisThread(state);
+    if (state.thread_index() == 0)
+    {
+        queue.reset(Operations::create());
+    }
+
+    const bool isProducer = (state.thread_index() % 2) == 0;
+    uint64_t value{0U};
+    for (auto _ : state)
+    {
+        if (isProducer)
+        {
+            while (!Operations::tryPush(*queue, value))
+            {
+            }
+            ++value;
+        }
+        else
+        {
+            while (!Operations::tryPop(*queue, value))
+            {
+            }
+            ::benchmark::DoNotOptimize(value);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+    if (state.thread_index() == 0)
+    {
+        queue.reset();
+    }
+}
+
+} // namespace benchmarks
+} // namespace iox
+
+#endif // IOX_HOOFS_BENCHMARKS_BENCHMARK_QUEUE_HPP
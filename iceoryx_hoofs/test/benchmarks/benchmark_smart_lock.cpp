@@ -0,0 +1,88 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/internal/concurrent/smart_lock.hpp"
+
+#include "benchmark_helper.hpp"
+
+#include <memory>
+
+namespace iox
+{
+namespace benchmarks
+{
+struct Counter
+{
+    void increment() noexcept
+    {
+        ++value;
+    }
+    uint64_t value{0U};
+};
+
+/// @brief Every thread modifies the shared object via the arrow operator which locks the mutex for the call
+void SmartLockModify(::benchmark::State& state)
+{
+    static std::unique_ptr<concurrent::smart_lock<Counter>> sut;
+
+    pinThisThread(state);
+    if (state.thread_index() == 0)
+    {
+        sut.reset(new concurrent::smart_lock<Counter>());
+    }
+
+    for (auto _ : state)
+    {
+        (*sut)->increment();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+    if (state.thread_index() == 0)
+    {
+        sut.reset();
+    }
+}
+
+/// @brief Every thread reads a copy of the shared object
+void SmartLockGetCopy(::benchmark::State& state)
+{
+    static std::unique_ptr<concurrent::smart_lock<Counter>> sut;
+
+    pinThisThread(state);
+    if (state.thread_index() == 0)
+    {
+        sut.reset(new concurrent::smart_lock<Counter>());
+    }
+
+    for (auto _ : state)
+    {
+        auto copy = sut->getCopy();
+        ::benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+    if (state.thread_index() == 0)
+    {
+        sut.reset();
+    }
+}
+
+BENCHMARK(SmartLockModify)->ThreadRange(1, maxNumberOfThreads())->UseRealTime();
+BENCHMARK(SmartLockGetCopy)->ThreadRange(1, maxNumberOfThreads())->UseRealTime();
+
+} // namespace benchmarks
+} // namespace iox
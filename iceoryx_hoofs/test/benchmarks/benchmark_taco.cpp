@@ -0,0 +1,103 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/internal/concurrent/taco.hpp"
+
+#include "benchmark_helper.hpp"
+
+#include <memory>
+
+namespace iox
+{
+namespace benchmarks
+{
+/// @brief the TACO requires one context per thread
+enum class ThreadContext : uint32_t
+{
+    END_OF_LIST = MAX_NUMBER_OF_THREADS
+};
+
+/// @brief larger than 64 bit, otherwise an atomic would be sufficient
+struct TacoData
+{
+    uint64_t sequenceNumber{0U};
+    uint64_t timestamp{0U};
+    uint64_t payload[2]{0U, 0U};
+};
+
+using Taco_t = concurrent::TACO<TacoData, ThreadContext>;
+
+/// @brief Every thread stores a value and takes the latest value in every iteration
+void TacoStoreTake(::benchmark::State& state)
+{
+    static std::unique_ptr<Taco_t> sut;
+
+    pinThisThread(state);
+    if (state.thread_index() == 0)
+    {
+        sut.reset(new Taco_t(concurrent::TACOMode::AccecptDataFromSameContext));
+    }
+
+    const auto context = static_cast<ThreadContext>(state.thread_index());
+    TacoData data;
+    for (auto _ : state)
+    {
+        ++data.sequenceNumber;
+        sut->store(data, context);
+        auto latest = sut->take(context);
+        ::benchmark::DoNotOptimize(latest);
+    }
+    state.SetItemsProcessed(2 * static_cast<int64_t>(state.iterations()));
+
+    if (state.thread_index() == 0)
+    {
+        sut.reset();
+    }
+}
+
+/// @brief Every thread exchanges its value with the stored one in every iteration
+void TacoExchange(::benchmark::State& state)
+{
+    static std::unique_ptr<Taco_t> sut;
+
+    pinThisThread(state);
+    if (state.thread_index() == 0)
+    {
+        sut.reset(new Taco_t(concurrent::TACOMode::AccecptDataFromSameContext));
+    }
+
+    const auto context = static_cast<ThreadContext>(state.thread_index());
+    TacoData data;
+    for (auto _ : state)
+    {
+        ++data.sequenceNumber;
+        auto previous = sut->exchange(data, context);
+        ::benchmark::DoNotOptimize(previous);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+    if (state.thread_index() == 0)
+    {
+        sut.reset();
+    }
+}
+
+BENCHMARK(TacoStoreTake)->ThreadRange(1, maxNumberOfThreads())->UseRealTime();
+BENCHMARK(TacoExchange)->ThreadRange(1, maxNumberOfThreads())->UseRealTime();
+
+} // namespace benchmarks
+} // namespace iox
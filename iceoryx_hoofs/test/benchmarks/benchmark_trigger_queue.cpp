@@ -0,0 +1,73 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/concurrent/lockfree_queue.hpp"
+#include "iceoryx_hoofs/concurrent/resizeable_lockfree_queue.hpp"
+#include "iceoryx_hoofs/internal/concurrent/trigger_queue.hpp"
+
+#include "benchmark_queue.hpp"
+
+namespace iox
+{
+namespace benchmarks
+{
+constexpr uint64_t TRIGGER_QUEUE_CAPACITY{1024U};
+using TriggerQueue_t = concurrent::TriggerQueue<uint64_t, TRIGGER_QUEUE_CAPACITY, concurrent::LockFreeQueue>;
+using ResizeableTriggerQueue_t =
+    concurrent::TriggerQueue<uint64_t, TRIGGER_QUEUE_CAPACITY, concurrent::ResizeableLockFreeQueue>;
+
+template <typename Queue>
+struct TriggerQueueOperations
+{
+    static Queue* create() noexcept
+    {
+        return new Queue();
+    }
+    static bool tryPush(Queue& queue, const uint64_t value) noexcept
+    {
+        // blocks while the queue is full
+        return queue.push(value);
+    }
+    static bool tryPop(Queue& queue, uint64_t& value) noexcept
+    {
+        auto result = queue.pop();
+        if (result.has_value())
+        {
+            value = result.value();
+            return true;
+        }
+        return false;
+    }
+};
+
+template <>
+struct QueueOperations<TriggerQueue_t> : public TriggerQueueOperations<TriggerQueue_t>
+{
+};
+
+template <>
+struct QueueOperations<ResizeableTriggerQueue_t> : public TriggerQueueOperations<ResizeableTriggerQueue_t>
+{
+};
+
+BENCHMARK_TEMPLATE(PushPop, TriggerQueue_t)->ThreadRange(1, maxNumberOfThreads())->UseRealTime();
+BENCHMARK_TEMPLATE(ProducerConsumer, TriggerQueue_t)->ThreadRange(2, maxNumberOfThreads())->UseRealTime();
+BENCHMARK_TEMPLATE(PushPop, ResizeableTriggerQueue_t)->ThreadRange(1, maxNumberOfThreads())->UseRealTime();
+BENCHMARK_TEMPLATE(ProducerConsumer, ResizeableTriggerQueue_t)->ThreadRange(2, maxNumberOfThreads())->UseRealTime();
+
+} // namespace benchmarks
+} // namespace iox
@@ -245,6 +245,47 @@ void work(Queue& queue, int id, std::atomic<bool>& run)
     }
 }
 
+// alternates between batch pop and batch push of a random number of elements
+template <typename Queue>
+void batchWork(Queue& queue, int id, std::atomic<bool>& run)
+{
+    constexpr uint64_t MAX_BATCH_SIZE{100U};
+    std::vector<Data> poppedValues(MAX_BATCH_SIZE);
+    uint64_t numberOfPoppedValues{0U};
+
+    std::default_random_engine rng{std::random_device()()};
+    std::uniform_int_distribution<uint64_t> dist{1U, MAX_BATCH_SIZE};
+
+    while (run)
+    {
+        if (numberOfPoppedValues == 0U)
+        {
+            numberOfPoppedValues = queue.popN(poppedValues.data(), dist(rng));
+        }
+        else
+        {
+            for (uint64_t i = 0U; i < numberOfPoppedValues; ++i)
+            {
+                poppedValues[i].id = id;
+            }
+            // push as many as possible and keep the remaining ones for the next push
+            auto numberOfPushedValues = queue.tryPushN(poppedValues.data(), numberOfPoppedValues);
+            std::move(poppedValues.begin() + static_cast<int64_t>(numberOfPushedValues),
+                      poppedValues.begin() + static_cast<int64_t>(numberOfPoppedValues),
+                      poppedValues.begin());
+            numberOfPoppedValues -= numberOfPushedValues;
+        }
+    }
+
+    // push the remaining items back into the queue
+    uint64_t numberOfPushedValues{0U};
+    while (numberOfPushedValues < numberOfPoppedValues)
+    {
+        numberOfPushedValues +=
+            queue.tryPushN(poppedValues.data() + numberOfPushedValues, numberOfPoppedValues - numberOfPushedValues);
+    }
+}
+
 // randomly chooses between push and pop
 // popProbability essentially controls whether the queue tends to be full or empty on average
 template <typename Queue>
@@ -522,6 +563,76 @@ TYPED_TEST(LockFreeQueueStressTest, DISABLED_timedMultiProducerMultiConsumer)
 }
 
 
+///@brief Tests concurrent operation of multiple hybrid producer/consumer threads with batch operations.
+/// Half of the threads uses tryPushN/popN with random batch sizes and the other half single element operations.
+/// Like in timedMultiProducerMultiConsumer the queue is initially full of distinct elements
+/// and it is checked that it still contains all of them afterwards.
+TYPED_TEST(LockFreeQueueStressTest, timedMultiProducerMultiConsumerWithBatches)
+{
+    using Queue = typename TestFixture::Queue;
+
+    auto& q = this->sut;
+    std::chrono::seconds runtime(1);
+    int numThreads = 8;
+
+    auto capacity = q.capacity();
+
+    // fill the queue
+    Data d;
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        d.count = i;
+        while (!q.tryPush(d))
+            ;
+    }
+
+    std::atomic<bool> run{true};
+
+    std::vector<std::thread> threads;
+
+    for (int id = 1; id <= numThreads; ++id)
+    {
+        if (id % 2 == 0)
+        {
+            threads.emplace_back(batchWork<Queue>, std::ref(q), id, std::ref(run));
+        }
+        else
+        {
+            threads.emplace_back(work<Queue>, std::ref(q), id, std::ref(run));
+        }
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(runtime));
+
+    run = false;
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // check whether all elements are there, but there is no specific ordering we can expect
+    std::vector<int> count(capacity, 0);
+    auto popped = q.pop();
+    while (popped.has_value())
+    {
+        count[popped.value().count]++;
+        popped = q.pop();
+    }
+
+    bool testResult = true;
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        if (count[i] != 1) // missing or duplicate elements indicate an error
+        {
+            testResult = false;
+            break;
+        }
+    }
+
+    EXPECT_EQ(testResult, true);
+}
+
 ///@brief Tests concurrent operation of multiple hybrid producer/consumer threads
 /// which use potentially overflowing pushes.
 /// The tests initializes a local list of distinct elements for each thread.
@@ -0,0 +1,185 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
+#include "test.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using iox::concurrent::LoFFLi;
+
+constexpr int NO_OWNER{0};
+
+/// @brief A small capacity and many threads let the same indices return to the head over and over again,
+/// which is the situation where a missing ABA protection hands out an index twice or loses it.
+/// Every worker registers as owner of each index it acquired; a failing registration detects an index
+/// which is owned twice.
+template <uint32_t Capacity>
+class LoFFLiStressTest : public Test
+{
+  public:
+    void SetUp() override
+    {
+        m_loffli.init(m_memory, Capacity);
+        for (auto& owner : m_owner)
+        {
+            owner.store(NO_OWNER);
+        }
+    }
+
+    bool acquire(const LoFFLi::Index_t index, const int id)
+    {
+        int expected{NO_OWNER};
+        return m_owner[index].compare_exchange_strong(expected, id);
+    }
+
+    bool release(const LoFFLi::Index_t index, const int id)
+    {
+        int expected{id};
+        return m_owner[index].compare_exchange_strong(expected, NO_OWNER);
+    }
+
+    /// @brief randomly chooses between single and batch operations, the indices are pushed in random order
+    void work(const int id, const bool useSingleOperations, const bool useBatchOperations)
+    {
+        std::default_random_engine rng{std::random_device()()};
+        std::uniform_int_distribution<uint32_t> batchSize{1U, Capacity};
+        std::bernoulli_distribution useBatch{0.5};
+
+        std::vector<LoFFLi::Index_t> indices(Capacity);
+        while (m_run.load(std::memory_order_relaxed))
+        {
+            const bool batch = useBatchOperations && (!useSingleOperations || useBatch(rng));
+
+            uint32_t numberOfIndices{0U};
+            if (batch)
+            {
+                numberOfIndices = m_loffli.popN(indices.data(), batchSize(rng));
+            }
+            else
+            {
+                numberOfIndices = m_loffli.pop(indices[0]) ? 1U : 0U;
+            }
+
+            for (uint32_t i = 0U; i < numberOfIndices; ++i)
+            {
+                if (!acquire(indices[i], id))
+                {
+                    m_errorDetected = true;
+                }
+            }
+
+            std::shuffle(indices.begin(), indices.begin() + numberOfIndices, rng);
+            for (uint32_t i = 0U; i < numberOfIndices; ++i)
+            {
+                if (!release(indices[i], id))
+                {
+                    m_errorDetected = true;
+                }
+            }
+
+            if (batch)
+            {
+                if (!m_loffli.pushN(indices.data(), numberOfIndices))
+                {
+                    m_errorDetected = true;
+                }
+            }
+            else
+            {
+                for (uint32_t i = 0U; i < numberOfIndices; ++i)
+                {
+                    if (!m_loffli.push(indices[i]))
+                    {
+                        m_errorDetected = true;
+                    }
+                }
+            }
+        }
+    }
+
+    void runWorkers(const bool useSingleOperations, const bool useBatchOperations)
+    {
+        constexpr int NUMBER_OF_THREADS{8};
+        constexpr std::chrono::milliseconds RUNTIME{1000};
+
+        std::vector<std::thread> threads;
+        for (int id = 1; id <= NUMBER_OF_THREADS; ++id)
+        {
+            threads.emplace_back([=] { work(id, useSingleOperations, useBatchOperations); });
+        }
+
+        std::this_thread::sleep_for(RUNTIME);
+        m_run = false;
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    void expectAllIndicesAreAvailableExactlyOnce()
+    {
+        EXPECT_FALSE(m_errorDetected.load());
+
+        std::vector<LoFFLi::Index_t> indices(Capacity + 1U);
+        ASSERT_THAT(m_loffli.popN(indices.data(), Capacity + 1U), Eq(Capacity));
+        indices.resize(Capacity);
+        std::sort(indices.begin(), indices.end());
+        for (uint32_t i = 0U; i < Capacity; ++i)
+        {
+            EXPECT_THAT(indices[i], Eq(i));
+        }
+    }
+
+    LoFFLi::Index_t m_memory[LoFFLi::requiredIndexMemorySize(Capacity)];
+    LoFFLi m_loffli;
+    std::atomic<int> m_owner[Capacity];
+    std::atomic<bool> m_run{true};
+    std::atomic<bool> m_errorDetected{false};
+};
+
+using LoFFLiStressTestWithSmallCapacity = LoFFLiStressTest<4U>;
+using LoFFLiStressTestWithLargeCapacity = LoFFLiStressTest<256U>;
+
+TEST_F(LoFFLiStressTestWithSmallCapacity, ConcurrentBatchOperationsNeverDuplicateOrLoseIndices)
+{
+    runWorkers(false, true);
+    expectAllIndicesAreAvailableExactlyOnce();
+}
+
+TEST_F(LoFFLiStressTestWithSmallCapacity, ConcurrentSingleAndBatchOperationsNeverDuplicateOrLoseIndices)
+{
+    runWorkers(true, true);
+    expectAllIndicesAreAvailableExactlyOnce();
+}
+
+TEST_F(LoFFLiStressTestWithLargeCapacity, ConcurrentSingleAndBatchOperationsNeverDuplicateOrLoseIndices)
+{
+    runWorkers(true, true);
+    expectAllIndicesAreAvailableExactlyOnce();
+}
+
+} // namespace
@@ -199,4 +199,131 @@ TYPED_TEST(LoFFLi_test, PushToUninitializedLoFFLi)
     decltype(this->m_loffli) loFFLi;
     EXPECT_THAT(loFFLi.push(0), Eq(false));
 }
+
+TYPED_TEST(LoFFLi_test, PopNReturnsRequestedNumberOfIndices)
+{
+    uint32_t indices[Size];
+    EXPECT_THAT(this->m_loffli.popN(indices, Size - 1), Eq(Size - 1));
+    for (uint32_t i = 0; i < Size - 1; i++)
+    {
+        EXPECT_THAT(indices[i], Eq(i));
+    }
+
+    uint32_t index;
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+    EXPECT_THAT(index, Eq(Size - 1));
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PopNReturnsRemainingIndicesWhenRequestingMore)
+{
+    uint32_t index;
+    this->m_loffli.pop(index);
+
+    uint32_t indices[Size + 1];
+    EXPECT_THAT(this->m_loffli.popN(indices, Size + 1), Eq(Size - 1));
+    EXPECT_THAT(this->m_loffli.popN(indices, Size + 1), Eq(0U));
+}
+
+TYPED_TEST(LoFFLi_test, PopNWithZeroIndicesReturnsNothing)
+{
+    uint32_t indices[Size];
+    EXPECT_THAT(this->m_loffli.popN(indices, 0), Eq(0U));
+
+    // all indices must still be available
+    EXPECT_THAT(this->m_loffli.popN(indices, Size), Eq(Size));
+}
+
+TYPED_TEST(LoFFLi_test, PopNFromUninitializedLoFFLi)
+{
+    uint32_t indices[Size];
+    decltype(this->m_loffli) loFFLi;
+    EXPECT_THAT(loFFLi.popN(indices, Size), Eq(0U));
+}
+
+TYPED_TEST(LoFFLi_test, PushNMakesAllIndicesAvailableAgain)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popN(indices, Size), Eq(Size));
+    std::reverse(std::begin(indices), std::end(indices));
+
+    EXPECT_THAT(this->m_loffli.pushN(indices, Size), Eq(true));
+
+    // the chain is spliced in the given order
+    uint32_t poppedIndices[Size];
+    ASSERT_THAT(this->m_loffli.popN(poppedIndices, Size), Eq(Size));
+    for (uint32_t i = 0; i < Size; i++)
+    {
+        EXPECT_THAT(poppedIndices[i], Eq(indices[i]));
+    }
+}
+
+TYPED_TEST(LoFFLi_test, PushNOfSubsetAndPushOfRemainingIndicesMakesAllIndicesAvailableAgain)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popN(indices, Size), Eq(Size));
+
+    EXPECT_THAT(this->m_loffli.pushN(indices, Size - 1), Eq(true));
+    EXPECT_THAT(this->m_loffli.push(indices[Size - 1]), Eq(true));
+
+    std::vector<uint32_t> poppedIndices;
+    uint32_t index;
+    while (this->m_loffli.pop(index))
+    {
+        poppedIndices.push_back(index);
+    }
+    std::sort(poppedIndices.begin(), poppedIndices.end());
+    EXPECT_THAT(poppedIndices, Eq(std::vector<uint32_t>(std::begin(indices), std::end(indices))));
+}
+
+TYPED_TEST(LoFFLi_test, PushNWithZeroIndicesSucceeds)
+{
+    uint32_t indices[Size];
+    EXPECT_THAT(this->m_loffli.pushN(indices, 0), Eq(true));
+}
+
+TYPED_TEST(LoFFLi_test, PushNWithDuplicateIndexFailsAndPushesNothing)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popN(indices, Size), Eq(Size));
+
+    uint32_t indicesWithDuplicate[] = {indices[0], indices[1], indices[0]};
+    EXPECT_THAT(this->m_loffli.pushN(indicesWithDuplicate, 3), Eq(false));
+
+    uint32_t index;
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+
+    // the indices must still be owned by the caller and therefore pushable
+    EXPECT_THAT(this->m_loffli.pushN(indices, Size), Eq(true));
+}
+
+TYPED_TEST(LoFFLi_test, PushNWithIndexWhichWasNotPoppedFailsAndPushesNothing)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popN(indices, Size - 1), Eq(Size - 1));
+
+    // the last index is still in the free-list
+    uint32_t indicesToPush[] = {indices[0], indices[1], Size - 1};
+    EXPECT_THAT(this->m_loffli.pushN(indicesToPush, 3), Eq(false));
+
+    uint32_t poppedIndices[Size];
+    EXPECT_THAT(this->m_loffli.popN(poppedIndices, Size), Eq(1U));
+    EXPECT_THAT(poppedIndices[0], Eq(Size - 1));
+    EXPECT_THAT(this->m_loffli.pushN(indices, Size - 1), Eq(true));
+}
+
+TYPED_TEST(LoFFLi_test, PushNWithOutOfBoundIndexFails)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popN(indices, Size), Eq(Size));
+
+    indices[Size - 1] = Size;
+    EXPECT_THAT(this->m_loffli.pushN(indices, Size), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PushNWhenFullFails)
+{
+    uint32_t indices[] = {0, 1};
+    EXPECT_THAT(this->m_loffli.pushN(indices, 2), Eq(false));
+}
 } // namespace
@@ -0,0 +1,302 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/concurrent/timing_wheel.hpp"
+#include "iceoryx_hoofs/internal/concurrent/timing_wheel_task.hpp"
+#include "iceoryx_hoofs/testing/timing_test.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::concurrent;
+using namespace iox::units::duration_literals;
+
+constexpr std::chrono::milliseconds SLEEP_TIME{100};
+constexpr units::Duration INTERVAL{10_ms};
+#if defined(__APPLE__)
+constexpr uint64_t MIN_RUNS{3U};
+constexpr uint64_t MAX_RUNS{17U};
+#else
+constexpr uint64_t MIN_RUNS{5U};
+constexpr uint64_t MAX_RUNS{15U};
+#endif
+
+class TimingWheel_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        callCounter = 0U;
+    }
+
+    TimingWheel::Callback_t incrementCallback()
+    {
+        return [this] { ++callCounter; };
+    }
+
+    std::atomic<uint64_t> callCounter{0U};
+    TimingWheel sut{1_ms, "TestWheel"};
+};
+
+TEST_F(TimingWheel_test, AddingTimerWithEmptyCallbackFails)
+{
+    auto result = sut.addTimer(INTERVAL, TimingWheelTimerMode::ONCE, TimingWheel::Callback_t());
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(TimingWheelError::INVALID_TIMER_CALLBACK));
+    EXPECT_THAT(sut.numberOfTimers(), Eq(0U));
+}
+
+TEST_F(TimingWheel_test, AddingMoreThanMaxNumberOfTimersFails)
+{
+    for (uint32_t i = 0U; i < TimingWheel::MAX_NUMBER_OF_TIMERS; ++i)
+    {
+        EXPECT_FALSE(sut.addTimer(100_s, TimingWheelTimerMode::ONCE, incrementCallback()).has_error());
+    }
+
+    auto result = sut.addTimer(100_s, TimingWheelTimerMode::ONCE, incrementCallback());
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(TimingWheelError::TIMER_LIMIT_REACHED));
+    EXPECT_THAT(sut.numberOfTimers(), Eq(TimingWheel::MAX_NUMBER_OF_TIMERS));
+}
+
+TEST_F(TimingWheel_test, RemovedTimerCanBeReused)
+{
+    std::vector<TimingWheel::TimerId> timerIds;
+    for (uint32_t i = 0U; i < TimingWheel::MAX_NUMBER_OF_TIMERS; ++i)
+    {
+        timerIds.emplace_back(sut.addTimer(100_s, TimingWheelTimerMode::ONCE, incrementCallback()).value());
+    }
+
+    EXPECT_TRUE(sut.removeTimer(timerIds.front()));
+
+    EXPECT_FALSE(sut.addTimer(100_s, TimingWheelTimerMode::ONCE, incrementCallback()).has_error());
+}
+
+TEST_F(TimingWheel_test, OnceTimerFiresExactlyOnce)
+{
+    ASSERT_FALSE(sut.addTimer(INTERVAL, TimingWheelTimerMode::ONCE, incrementCallback()).has_error());
+
+    std::this_thread::sleep_for(SLEEP_TIME);
+
+    EXPECT_THAT(callCounter.load(), Eq(1U));
+    EXPECT_THAT(sut.numberOfTimers(), Eq(0U));
+}
+
+TIMING_TEST_F(TimingWheel_test, PeriodicTimerFiresRepeatedly, Repeat(3), [&] {
+    callCounter = 0U;
+    auto timerId = sut.addTimer(INTERVAL, TimingWheelTimerMode::PERIODIC, incrementCallback());
+    ASSERT_FALSE(timerId.has_error());
+
+    std::this_thread::sleep_for(SLEEP_TIME);
+    EXPECT_TRUE(sut.removeTimer(timerId.value()));
+
+    TIMING_TEST_EXPECT_TRUE(callCounter.load() >= MIN_RUNS - 1U && callCounter.load() <= MAX_RUNS);
+});
+
+TEST_F(TimingWheel_test, PeriodicTimerWithInitialTimeoutFiresFirstAfterInitialTimeout)
+{
+    auto timerId = sut.addTimer(1_ms, 100_s, incrementCallback());
+    ASSERT_FALSE(timerId.has_error());
+
+    std::this_thread::sleep_for(SLEEP_TIME);
+
+    EXPECT_THAT(callCounter.load(), Eq(1U));
+    EXPECT_TRUE(sut.removeTimer(timerId.value()));
+}
+
+TEST_F(TimingWheel_test, RemovedTimerDoesNotFire)
+{
+    auto timerId = sut.addTimer(INTERVAL * 5, TimingWheelTimerMode::ONCE, incrementCallback());
+    ASSERT_FALSE(timerId.has_error());
+
+    EXPECT_TRUE(sut.removeTimer(timerId.value()));
+    std::this_thread::sleep_for(SLEEP_TIME);
+
+    EXPECT_THAT(callCounter.load(), Eq(0U));
+    EXPECT_THAT(sut.numberOfTimers(), Eq(0U));
+}
+
+TEST_F(TimingWheel_test, RemovingExpiredTimerFails)
+{
+    auto timerId = sut.addTimer(1_ms, TimingWheelTimerMode::ONCE, incrementCallback());
+    ASSERT_FALSE(timerId.has_error());
+
+    std::this_thread::sleep_for(SLEEP_TIME);
+
+    EXPECT_FALSE(sut.removeTimer(timerId.value()));
+}
+
+TEST_F(TimingWheel_test, StaleTimerIdDoesNotRemoveReusedTimer)
+{
+    auto staleTimerId = sut.addTimer(100_s, TimingWheelTimerMode::ONCE, incrementCallback());
+    ASSERT_FALSE(staleTimerId.has_error());
+    EXPECT_TRUE(sut.removeTimer(staleTimerId.value()));
+
+    auto timerId = sut.addTimer(100_s, TimingWheelTimerMode::ONCE, incrementCallback());
+    ASSERT_FALSE(timerId.has_error());
+
+    EXPECT_FALSE(sut.removeTimer(staleTimerId.value()));
+    EXPECT_THAT(sut.numberOfTimers(), Eq(1U));
+}
+
+TEST_F(TimingWheel_test, RemovingPeriodicTimerFromWithinCallbackStopsIt)
+{
+    std::atomic<TimingWheel::TimerId> timerId{0U};
+    std::atomic_bool isRegistered{false};
+    auto result = sut.addTimer(1_ms, TimingWheelTimerMode::PERIODIC, [&] {
+        ++callCounter;
+        if (isRegistered.load())
+        {
+            sut.removeTimer(timerId.load());
+        }
+    });
+    ASSERT_FALSE(result.has_error());
+    timerId = result.value();
+    isRegistered = true;
+
+    std::this_thread::sleep_for(SLEEP_TIME);
+    const uint64_t callsAfterRemoval = callCounter.load();
+    std::this_thread::sleep_for(SLEEP_TIME);
+
+    EXPECT_THAT(callCounter.load(), Eq(callsAfterRemoval));
+    EXPECT_THAT(sut.numberOfTimers(), Eq(0U));
+}
+
+TIMING_TEST_F(TimingWheel_test, TimerBeyondFirstLevelIsCascadedAndFires, Repeat(3), [&] {
+    callCounter = 0U;
+    ASSERT_FALSE(sut.addTimer(200_ms, TimingWheelTimerMode::ONCE, incrementCallback()).has_error());
+
+    std::this_thread::sleep_for(SLEEP_TIME);
+    TIMING_TEST_EXPECT_TRUE(callCounter.load() == 0U);
+
+    std::this_thread::sleep_for(SLEEP_TIME * 2);
+    TIMING_TEST_EXPECT_TRUE(callCounter.load() == 1U);
+});
+
+TEST_F(TimingWheel_test, TimerBeyondRangeOfWheelFires)
+{
+    // with a tick of 100ns the wheel covers 2^24 ticks, i.e. about 1.7s
+    TimingWheel wheel{units::Duration::fromNanoseconds(100U), "RangeWheel"};
+    ASSERT_FALSE(wheel.addTimer(2_s, TimingWheelTimerMode::ONCE, incrementCallback()).has_error());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+    EXPECT_THAT(callCounter.load(), Eq(0U));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+    EXPECT_THAT(callCounter.load(), Eq(1U));
+}
+
+TEST_F(TimingWheel_test, ManyTimersWithDifferentTimeoutsFireOnce)
+{
+    constexpr uint64_t NUMBER_OF_TIMERS{TimingWheel::MAX_NUMBER_OF_TIMERS};
+    for (uint64_t i = 0U; i < NUMBER_OF_TIMERS; ++i)
+    {
+        ASSERT_FALSE(sut.addTimer(units::Duration::fromMilliseconds(i), TimingWheelTimerMode::ONCE, incrementCallback())
+                         .has_error());
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(NUMBER_OF_TIMERS) + SLEEP_TIME);
+
+    EXPECT_THAT(callCounter.load(), Eq(NUMBER_OF_TIMERS));
+    EXPECT_THAT(sut.numberOfTimers(), Eq(0U));
+}
+
+class TimingWheelTask_test : public TimingWheel_test
+{
+  public:
+    struct Increment
+    {
+        Increment(std::atomic<uint64_t>& counter)
+            : counter(counter)
+        {
+        }
+
+        void operator()()
+        {
+            ++counter;
+        }
+
+        std::atomic<uint64_t>& counter;
+    };
+};
+
+TEST_F(TimingWheelTask_test, TaskIsInactiveAfterConstruction)
+{
+    TimingWheelTask<Increment> task{sut, callCounter};
+
+    EXPECT_FALSE(task.isActive());
+    EXPECT_THAT(sut.numberOfTimers(), Eq(0U));
+}
+
+TEST_F(TimingWheelTask_test, TaskIsActiveAfterStartAndInactiveAfterStop)
+{
+    TimingWheelTask<Increment> task{sut, callCounter};
+
+    EXPECT_TRUE(task.start(INTERVAL));
+    EXPECT_TRUE(task.isActive());
+    EXPECT_THAT(sut.numberOfTimers(), Eq(1U));
+
+    task.stop();
+    EXPECT_FALSE(task.isActive());
+    EXPECT_THAT(sut.numberOfTimers(), Eq(0U));
+}
+
+TEST_F(TimingWheelTask_test, RestartingTaskDoesNotAddAnotherTimer)
+{
+    TimingWheelTask<Increment> task{sut, callCounter};
+
+    EXPECT_TRUE(task.start(INTERVAL));
+    EXPECT_TRUE(task.start(INTERVAL * 2));
+
+    EXPECT_THAT(sut.numberOfTimers(), Eq(1U));
+}
+
+TEST_F(TimingWheelTask_test, DestroyingTaskRemovesTimer)
+{
+    {
+        TimingWheelTask<Increment> task{sut, callCounter};
+        EXPECT_TRUE(task.start(INTERVAL));
+    }
+
+    EXPECT_THAT(sut.numberOfTimers(), Eq(0U));
+}
+
+TIMING_TEST_F(TimingWheelTask_test, TaskExecutesCallableImmediatelyAndPeriodically, Repeat(3), [&] {
+    callCounter = 0U;
+    {
+        TimingWheelTask<Increment> task(sut, callCounter);
+        task.start(INTERVAL);
+
+        std::this_thread::sleep_for(SLEEP_TIME);
+    }
+    const uint64_t callsAfterStop = callCounter.load();
+    std::this_thread::sleep_for(SLEEP_TIME);
+
+    TIMING_TEST_EXPECT_TRUE(callsAfterStop >= MIN_RUNS && callsAfterStop <= MAX_RUNS);
+    TIMING_TEST_EXPECT_TRUE(callCounter.load() == callsAfterStop);
+});
+
+} // namespace
@@ -20,6 +20,7 @@
 
 
 #include <cstdint>
+#include <limits>
 namespace
 {
 using namespace ::testing;
@@ -365,4 +366,84 @@ TEST_F(convert_test, fromString_MinMaxUNSIGNED_Int)
     source = "-1";
     EXPECT_THAT(iox::cxx::convert::fromString(source.c_str(), destination), Eq(false));
 }
+
+TEST_F(convert_test, fromString_MinMaxInt64)
+{
+    std::string source = "9223372036854775807";
+    std::int64_t destination;
+    EXPECT_THAT(iox::cxx::convert::fromString(source.c_str(), destination), Eq(true));
+    EXPECT_THAT(destination, Eq(std::numeric_limits<std::int64_t>::max()));
+    source = "9223372036854775808";
+    EXPECT_THAT(iox::cxx::convert::fromString(source.c_str(), destination), Eq(false));
+    source = "-9223372036854775808";
+    EXPECT_THAT(iox::cxx::convert::fromString(source.c_str(), destination), Eq(true));
+    EXPECT_THAT(destination, Eq(std::numeric_limits<std::int64_t>::min()));
+    source = "-9223372036854775809";
+    EXPECT_THAT(iox::cxx::convert::fromString(source.c_str(), destination), Eq(false));
+}
+
+TEST_F(convert_test, fromString_MinMaxUNSIGNED_Int64)
+{
+    std::string source = "18446744073709551615";
+    std::uint64_t destination;
+    EXPECT_THAT(iox::cxx::convert::fromString(source.c_str(), destination), Eq(true));
+    EXPECT_THAT(destination, Eq(std::numeric_limits<std::uint64_t>::max()));
+    source = "18446744073709551616";
+    EXPECT_THAT(iox::cxx::convert::fromString(source.c_str(), destination), Eq(false));
+    source = "118446744073709551615";
+    EXPECT_THAT(iox::cxx::convert::fromString(source.c_str(), destination), Eq(false));
+}
+
+TEST_F(convert_test, fromString_SignWithoutDigitsFails)
+{
+    std::int32_t destination;
+    EXPECT_THAT(iox::cxx::convert::fromString("-", destination), Eq(false));
+    EXPECT_THAT(iox::cxx::convert::fromString("+", destination), Eq(false));
+}
+
+TEST_F(convert_test, fromString_PositiveSignAndLeadingZerosSucceed)
+{
+    std::int32_t destination;
+    EXPECT_THAT(iox::cxx::convert::fromString("+0042", destination), Eq(true));
+    EXPECT_THAT(destination, Eq(42));
+}
+
+TEST_F(convert_test, toString_MinMaxInt64)
+{
+    EXPECT_THAT(iox::cxx::convert::toString(std::numeric_limits<std::int64_t>::min()), Eq("-9223372036854775808"));
+    EXPECT_THAT(iox::cxx::convert::toString(std::numeric_limits<std::int64_t>::max()), Eq("9223372036854775807"));
+    EXPECT_THAT(iox::cxx::convert::toString(std::numeric_limits<std::uint64_t>::max()), Eq("18446744073709551615"));
+    EXPECT_THAT(iox::cxx::convert::toString(0), Eq("0"));
+}
+
+TEST_F(convert_test, toCxxString_Integer)
+{
+    auto sut = iox::cxx::convert::toCxxString<20>(-33331);
+    EXPECT_THAT(sut.c_str(), StrEq("-33331"));
+    EXPECT_THAT(sut.size(), Eq(6U));
+}
+
+TEST_F(convert_test, toCxxString_MinMaxInt8)
+{
+    EXPECT_THAT(iox::cxx::convert::toCxxString<4>(std::numeric_limits<std::int8_t>::min()).c_str(), StrEq("-128"));
+    EXPECT_THAT(iox::cxx::convert::toCxxString<4>(std::numeric_limits<std::int8_t>::max()).c_str(), StrEq("127"));
+    EXPECT_THAT(iox::cxx::convert::toCxxString<3>(std::numeric_limits<std::uint8_t>::max()).c_str(), StrEq("255"));
+}
+
+TEST_F(convert_test, toCxxString_MinMaxInt64)
+{
+    EXPECT_THAT(iox::cxx::convert::toCxxString<20>(std::numeric_limits<std::int64_t>::min()).c_str(),
+                StrEq("-9223372036854775808"));
+    EXPECT_THAT(iox::cxx::convert::toCxxString<20>(std::numeric_limits<std::uint64_t>::max()).c_str(),
+                StrEq("18446744073709551615"));
+}
+
+TEST_F(convert_test, toCxxStringAndFromStringRoundTrip)
+{
+    constexpr std::int64_t VALUE{-123456789012345};
+    std::int64_t destination{0};
+    EXPECT_THAT(iox::cxx::convert::fromString(iox::cxx::convert::toCxxString<20>(VALUE).c_str(), destination),
+                Eq(true));
+    EXPECT_THAT(destination, Eq(VALUE));
+}
 } // namespace
@@ -19,6 +19,9 @@
 
 #include "iceoryx_hoofs/internal/concurrent/lockfree_queue/index_queue.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -290,4 +293,92 @@ TYPED_TEST(IndexQueueTest, popIfSizeIsAtLeastCapacityReturnsNothingIfQueueIsNotF
     ASSERT_FALSE(index.has_value());
 }
 
+TYPED_TEST(IndexQueueTest, popNReturnsNothingWhenQueueIsEmpty)
+{
+    using index_t = typename TestFixture::index_t;
+    std::vector<index_t> indices(this->queue.capacity());
+    EXPECT_EQ(this->queue.popN(indices.data(), indices.size()), 0U);
+}
+
+TYPED_TEST(IndexQueueTest, popNReturnsAllElementsOfFullQueueInFifoOrder)
+{
+    using index_t = typename TestFixture::index_t;
+    const auto capacity = this->fullQueue.capacity();
+    std::vector<index_t> indices(capacity + 1U);
+
+    ASSERT_EQ(this->fullQueue.popN(indices.data(), indices.size()), capacity);
+    for (uint64_t i = 0U; i < capacity; ++i)
+    {
+        EXPECT_EQ(indices[i], i);
+    }
+    EXPECT_TRUE(this->fullQueue.empty());
+}
+
+TYPED_TEST(IndexQueueTest, popNReturnsAtMostRequestedNumberOfElements)
+{
+    using index_t = typename TestFixture::index_t;
+    const auto capacity = this->fullQueue.capacity();
+    const uint64_t requested = (capacity > 1U) ? capacity / 2U : 1U;
+    std::vector<index_t> indices(capacity);
+
+    ASSERT_EQ(this->fullQueue.popN(indices.data(), requested), requested);
+    auto index = this->fullQueue.pop();
+    if (requested < capacity)
+    {
+        ASSERT_TRUE(index.has_value());
+        EXPECT_EQ(index.value(), requested);
+    }
+    else
+    {
+        EXPECT_FALSE(index.has_value());
+    }
+}
+
+TYPED_TEST(IndexQueueTest, popNWithZeroElementsReturnsNothing)
+{
+    using index_t = typename TestFixture::index_t;
+    index_t index{0U};
+    EXPECT_EQ(this->fullQueue.popN(&index, 0U), 0U);
+    EXPECT_TRUE(this->fullQueue.popIfFull().has_value());
+}
+
+TYPED_TEST(IndexQueueTest, pushNInsertsInFifoOrder)
+{
+    using index_t = typename TestFixture::index_t;
+    auto& q = this->queue;
+    const auto capacity = q.capacity();
+    std::vector<index_t> indices(capacity);
+
+    ASSERT_EQ(this->fullQueue.popN(indices.data(), capacity), capacity);
+    std::reverse(indices.begin(), indices.end());
+    q.pushN(indices.data(), capacity);
+
+    for (uint64_t i = 0U; i < capacity; ++i)
+    {
+        auto popped = q.pop();
+        ASSERT_TRUE(popped.has_value());
+        EXPECT_EQ(popped.value(), indices[i]);
+    }
+    EXPECT_TRUE(q.empty());
+}
+
+TYPED_TEST(IndexQueueTest, popNAfterWrapAroundReturnsElementsOfBothCycles)
+{
+    using index_t = typename TestFixture::index_t;
+    auto& q = this->fullQueue;
+    const auto capacity = q.capacity();
+    std::vector<index_t> indices(capacity);
+
+    // move the read position to the middle, the pushed elements wrap around to the next cycle
+    const uint64_t offset = capacity / 2U;
+    ASSERT_EQ(q.popN(indices.data(), offset), offset);
+    q.pushN(indices.data(), offset);
+
+    ASSERT_EQ(q.popN(indices.data(), capacity), capacity);
+    for (uint64_t i = 0U; i < capacity; ++i)
+    {
+        EXPECT_EQ(indices[i], (i + offset) % capacity);
+    }
+}
+
 } // namespace
@@ -20,6 +20,8 @@
 #include "iceoryx_hoofs/concurrent/lockfree_queue.hpp"
 #include "iceoryx_hoofs/concurrent/resizeable_lockfree_queue.hpp"
 
+#include <vector>
+
 // We test the common functionality of LockFreeQueue and ResizableLockFreeQueue here
 // in typed tests to reduce code duplication.
 
@@ -347,4 +349,83 @@ TYPED_TEST(LockFreeQueueTest, checkEmptynessAfterFullQueueWasEmptied)
     EXPECT_EQ(q.size(), 0);
 }
 
+TYPED_TEST(LockFreeQueueTest, tryPushNUntilFullCapacityIsUsed)
+{
+    using element_t = typename TestFixture::Queue::element_t;
+    auto& q = this->queue;
+    const auto capacity = q.capacity();
+
+    std::vector<element_t> values;
+    for (uint64_t i = 0U; i <= capacity; ++i)
+    {
+        values.emplace_back(static_cast<int>(i));
+    }
+
+    EXPECT_EQ(q.tryPushN(values.data(), values.size()), capacity);
+    EXPECT_EQ(q.size(), capacity);
+    EXPECT_EQ(q.tryPushN(values.data(), 1U), 0U);
+}
+
+TYPED_TEST(LockFreeQueueTest, popNFromEmptyQueueReturnsNothing)
+{
+    using element_t = typename TestFixture::Queue::element_t;
+    element_t value{0};
+    EXPECT_EQ(this->queue.popN(&value, 1U), 0U);
+}
+
+TYPED_TEST(LockFreeQueueTest, popNReturnsElementsInFifoOrder)
+{
+    using element_t = typename TestFixture::Queue::element_t;
+    auto& q = this->queue;
+    const auto capacity = q.capacity();
+
+    int start{42};
+    this->fillQueue(start);
+
+    std::vector<element_t> values(capacity + 1U);
+    ASSERT_EQ(q.popN(values.data(), values.size()), capacity);
+    for (uint64_t i = 0U; i < capacity; ++i)
+    {
+        EXPECT_EQ(values[i], start + static_cast<int>(i));
+    }
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(q.size(), 0U);
+}
+
+TYPED_TEST(LockFreeQueueTest, tryPushNAndPopNAreCompatibleWithSingleElementOperations)
+{
+    using element_t = typename TestFixture::Queue::element_t;
+    auto& q = this->queue;
+    const auto capacity = q.capacity();
+
+    std::vector<element_t> values;
+    for (uint64_t i = 0U; i < capacity; ++i)
+    {
+        values.emplace_back(static_cast<int>(i));
+    }
+
+    // more than the internal batch size of the large queues is pushed and popped
+    for (int cycle = 0; cycle < 3; ++cycle)
+    {
+        ASSERT_EQ(q.tryPushN(values.data(), capacity), capacity);
+        for (uint64_t i = 0U; i < capacity; ++i)
+        {
+            auto popped = q.pop();
+            ASSERT_TRUE(popped.has_value());
+            EXPECT_EQ(popped.value(), values[i]);
+        }
+
+        for (auto& value : values)
+        {
+            ASSERT_TRUE(q.tryPush(value));
+        }
+        std::vector<element_t> poppedValues(capacity);
+        ASSERT_EQ(q.popN(poppedValues.data(), capacity), capacity);
+        for (uint64_t i = 0U; i < capacity; ++i)
+        {
+            EXPECT_EQ(poppedValues[i], values[i]);
+        }
+    }
+}
+
 } // namespace
@@ -16,8 +16,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/log/async_log_backend.hpp"
 #include "iceoryx_hoofs/log/logger.hpp"
 #include "iceoryx_hoofs/log/logging.hpp"
+#include "iceoryx_hoofs/log/logmanager.hpp"
 #include "test.hpp"
 
 #include <ctime>
@@ -122,6 +124,90 @@ TEST_F(IoxLogger_test, Output)
     EXPECT_THAT(output, Eq(expected));
 }
 
+TEST_F(IoxLogger_test, AsynchronousDispatchPrintsEntryAfterFlush)
+{
+    iox::log::LogEntry entry;
+    entry.level = iox::log::LogLevel::kWarn;
+    entry.message = "hypnotoad";
+
+    auto& logManager = iox::log::LogManager::GetLogManager();
+    logManager.SetDefaultLogDispatchMode(iox::log::LogDispatchMode::kAsynchronous);
+    m_sut.Log(entry);
+    iox::log::AsyncLogBackend::instance().flush();
+    logManager.SetDefaultLogDispatchMode(iox::log::LogDispatchMode::kSynchronous);
+
+    const std::string expected = formatDateTime(entry.time) + " [Warning]: hypnotoad\n";
+    std::string output = std::regex_replace(outBuffer.str(), colorCode, std::string(""));
+
+    EXPECT_THAT(output, Eq(expected));
+}
+
+TEST_F(IoxLogger_test, AsynchronousDispatchPrintsErrorWithoutFlushAfterQueuedEntries)
+{
+    iox::log::LogEntry queuedEntry;
+    queuedEntry.level = iox::log::LogLevel::kInfo;
+    queuedEntry.message = "all glory to";
+
+    iox::log::LogEntry errorEntry;
+    errorEntry.level = iox::log::LogLevel::kError;
+    errorEntry.message = "the hypnotoad";
+
+    auto& logManager = iox::log::LogManager::GetLogManager();
+    logManager.SetDefaultLogDispatchMode(iox::log::LogDispatchMode::kAsynchronous);
+    iox::log::AsyncLogBackend::instance().flush();
+    outBuffer.clear();
+    m_sut.Log(queuedEntry);
+    m_sut.Log(errorEntry);
+    // no flush, the error must not wait for the background task
+    std::string output = std::regex_replace(outBuffer.str(), colorCode, std::string(""));
+    logManager.SetDefaultLogDispatchMode(iox::log::LogDispatchMode::kSynchronous);
+
+    const std::string expected = formatDateTime(queuedEntry.time) + " [ Info  ]: all glory to\n"
+                                 + formatDateTime(errorEntry.time) + " [ Error ]: the hypnotoad\n";
+
+    EXPECT_THAT(output, Eq(expected));
+}
+
+TEST_F(IoxLogger_test, AsynchronousDispatchPrintsFatalWithoutFlush)
+{
+    iox::log::LogEntry entry;
+    entry.level = iox::log::LogLevel::kFatal;
+    entry.message = "hypnotoad";
+
+    auto& logManager = iox::log::LogManager::GetLogManager();
+    logManager.SetDefaultLogDispatchMode(iox::log::LogDispatchMode::kAsynchronous);
+    m_sut.Log(entry);
+    std::string output = std::regex_replace(outBuffer.str(), colorCode, std::string(""));
+    logManager.SetDefaultLogDispatchMode(iox::log::LogDispatchMode::kSynchronous);
+
+    EXPECT_THAT(output.find(" [ Fatal ]: hypnotoad\n"), Ne(std::string::npos));
+}
+
+TEST_F(IoxLogger_test, AsynchronousDispatchCountsDroppedEntries)
+{
+    iox::log::LogEntry entry;
+    entry.level = iox::log::LogLevel::kError;
+    entry.message = "the queue is full";
+
+    auto& backend = iox::log::AsyncLogBackend::instance();
+    const uint64_t droppedEntriesBefore = backend.droppedEntries();
+
+    uint64_t failedPushes{0U};
+    for (uint64_t i = 0U; i < 2U * iox::log::AsyncLogBackend::QUEUE_CAPACITY; ++i)
+    {
+        if (!backend.push(entry))
+        {
+            ++failedPushes;
+        }
+    }
+    backend.flush();
+
+    EXPECT_THAT(backend.droppedEntries() - droppedEntriesBefore, Eq(failedPushes));
+    if (failedPushes > 0U)
+    {
+        EXPECT_THAT(outBuffer.str().find("log entries were dropped"), Ne(std::string::npos));
+    }
+}
 
 class IoxLoggerLogLevel_test : public TestWithParam<iox::log::LogLevel>, public IoxLogger_testBase
 {
@@ -177,4 +177,42 @@ TEST_F(SharedMemoryObject_Test, OpeningSharedMemoryAndReadMultipleContents)
     EXPECT_THAT(*sutValue1, Eq(4557));
     EXPECT_THAT(*sutValue2, Eq(8912));
 }
+
+TEST_F(SharedMemoryObject_Test, CreateSingleProcessMemoryWorks)
+{
+    auto sut = iox::posix::SharedMemoryObject::create(iox::posix::CreateUnnamedSingleProcessMemory, 100);
+    ASSERT_THAT(sut.has_error(), Eq(false));
+    EXPECT_THAT(sut->isSingleProcessMemory(), Eq(true));
+    EXPECT_THAT(sut->getFileHandle(), Eq(iox::posix::SharedMemory::INVALID_HANDLE));
+    EXPECT_THAT(sut->getBaseAddress(), Ne(nullptr));
+    EXPECT_THAT(sut->getSizeInBytes(), Ge(100U));
+}
+
+TEST_F(SharedMemoryObject_Test, SharedMemoryIsNotSingleProcessMemory)
+{
+    auto sut = iox::posix::SharedMemoryObject::create("/shmNotSingleProcess",
+                                                      100,
+                                                      iox::posix::AccessMode::READ_WRITE,
+                                                      iox::posix::OpenMode::PURGE_AND_CREATE,
+                                                      iox::posix::SharedMemoryObject::NO_ADDRESS_HINT);
+    ASSERT_THAT(sut.has_error(), Eq(false));
+    EXPECT_THAT(sut->isSingleProcessMemory(), Eq(false));
+    EXPECT_THAT(sut->getFileHandle(), Ne(iox::posix::SharedMemory::INVALID_HANDLE));
+}
+
+TEST_F(SharedMemoryObject_Test, SingleProcessMemoryIsZeroInitializedAndCanBeAllocated)
+{
+    constexpr uint64_t MEMORY_SIZE{128U};
+    auto sut = iox::posix::SharedMemoryObject::create(iox::posix::CreateUnnamedSingleProcessMemory, MEMORY_SIZE);
+    ASSERT_THAT(sut.has_error(), Eq(false));
+
+    auto memory = static_cast<uint8_t*>(sut->allocate(MEMORY_SIZE, 1));
+    ASSERT_THAT(memory, Ne(nullptr));
+    for (uint64_t i = 0U; i < MEMORY_SIZE; ++i)
+    {
+        EXPECT_THAT(memory[i], Eq(0U));
+    }
+    memory[MEMORY_SIZE - 1U] = 73U;
+    EXPECT_THAT(memory[MEMORY_SIZE - 1U], Eq(73U));
+}
 } // namespace
@@ -0,0 +1,77 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/cxx/string.hpp"
+
+#include "benchmark.hpp"
+
+#include <cerrno>
+#include <cstdlib>
+#include <sstream>
+
+uint64_t globalCounter{0U};
+constexpr const char* NUMBER_STRING{"-1234567890123"};
+
+/// @brief the stringstream based conversion which was used by cxx::convert::toString before
+void toStringStringStream()
+{
+    std::stringstream ss;
+    ss << static_cast<int64_t>(globalCounter++);
+    globalCounter += ss.str().size();
+}
+
+void toStringConvert()
+{
+    globalCounter += iox::cxx::convert::toString(static_cast<int64_t>(globalCounter++)).size();
+}
+
+void toCxxStringConvert()
+{
+    globalCounter += iox::cxx::convert::toCxxString<20>(static_cast<int64_t>(globalCounter++)).size();
+}
+
+/// @brief the errno checked strtoll based conversion which was used by cxx::convert::fromString before
+void fromStringStrtoll()
+{
+    errno = 0;
+    auto value = strtoll(NUMBER_STRING, nullptr, 10);
+    if (errno == 0)
+    {
+        globalCounter += static_cast<uint64_t>(value);
+    }
+}
+
+void fromStringConvert()
+{
+    int64_t value{0};
+    if (iox::cxx::convert::fromString(NUMBER_STRING, value))
+    {
+        globalCounter += static_cast<uint64_t>(value);
+    }
+}
+
+int main()
+{
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    BENCHMARK(toStringStringStream, timeout);
+    BENCHMARK(toStringConvert, timeout);
+    BENCHMARK(toCxxStringConvert, timeout);
+    BENCHMARK(fromStringStrtoll, timeout);
+    BENCHMARK(fromStringConvert, timeout);
+}
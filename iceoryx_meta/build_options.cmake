@@ -19,6 +19,7 @@ cmake_minimum_required(VERSION 3.5)
 ## please add new entries alphabetically sorted
 option(BINDING_C "Builds the C language bindings" ON)
 option(BUILD_ALL "Build with all extensions and all tests" OFF)
+option(BUILD_BENCHMARK "Build the google-benchmark based micro-benchmarks of the concurrent primitives" OFF)
 option(BUILD_DOC "Build and generate documentation" OFF)
 option(BUILD_SHARED_LIBS "Build iceoryx as shared libraries" OFF)
 option(BUILD_STRICT "Build is performed with '-Werror'" OFF)
@@ -75,6 +76,7 @@ function(show_config_options)
   message("       iceoryx Options")
   message("          BINDING_C............................: " ${BINDING_C})
   message("          BUILD_ALL............................: " ${BUILD_ALL})
+  message("          BUILD_BENCHMARK......................: " ${BUILD_BENCHMARK})
   message("          BUILD_DOC............................: " ${BUILD_DOC})
   message("          BUILD_SHARED_LIBS....................: " ${BUILD_SHARED_LIBS})
   message("          BUILD_STRICT.........................: " ${BUILD_STRICT})
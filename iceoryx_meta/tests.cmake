@@ -81,3 +81,7 @@ if (BUILD_TEST)
     )
 
 endif()
+
+if(BUILD_BENCHMARK)
+    add_subdirectory(${CMAKE_CURRENT_SOURCE_DIR}/../cmake/googlebenchmark ${CMAKE_BINARY_DIR}/dependencies/googlebenchmark/prebuild)
+endif()
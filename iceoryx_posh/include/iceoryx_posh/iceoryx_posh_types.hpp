@@ -122,6 +122,10 @@ constexpr uint32_t CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT{8U};
 constexpr uint32_t CHUNK_NO_USER_HEADER_SIZE{0U};
 constexpr uint32_t CHUNK_NO_USER_HEADER_ALIGNMENT{1U};
 
+/// @brief the size of a cache line of the supported platforms; shared memory structures which are written by
+/// different processes are aligned to it to prevent false sharing
+constexpr uint64_t CACHE_LINE_SIZE{64U};
+
 // Message Queue
 constexpr uint32_t ROUDI_MAX_MESSAGES = 5U;
 constexpr uint32_t ROUDI_MESSAGE_SIZE = 512U;
@@ -216,6 +220,17 @@ enum class MonitoringMode
 };
 
 iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const MonitoringMode& mode);
+
+/// @brief Defines which processes take part in the communication of a RouDi instance
+/// MULTI_PROCESS - the management and payload memory is POSIX shared memory and the applications may run in other
+///                 processes than RouDi
+/// SINGLE_PROCESS - RouDi and all applications run in one process, e.g. with the PoshRuntimeSingleProcess; the memory
+///                  is process-local and the condition variables use process-private semaphores
+enum class ProcessScope
+{
+    MULTI_PROCESS,
+    SINGLE_PROCESS
+};
 } // namespace roudi
 
 namespace mepoo
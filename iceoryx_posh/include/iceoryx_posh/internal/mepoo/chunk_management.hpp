@@ -29,6 +29,7 @@ namespace iox
 namespace mepoo
 {
 class MemPool;
+class ChunkQuotaUsage;
 struct ChunkHeader;
 
 struct ChunkManagement
@@ -46,6 +47,9 @@ struct ChunkManagement
     /// @todo optimization: check if this can be replaced by an offset relative to the this pointer
     iox::rp::RelativePointer<MemPool> m_mempool;
     iox::rp::RelativePointer<MemPool> m_chunkManagementPool;
+    /// @brief the quota the chunk is accounted to or a logical nullptr if the chunk was acquired without quota
+    iox::rp::RelativePointer<ChunkQuotaUsage> m_chunkQuotaUsage;
+    bool m_isReservedChunk{false};
 };
 } // namespace mepoo
 } // namespace iox
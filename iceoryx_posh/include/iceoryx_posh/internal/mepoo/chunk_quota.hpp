@@ -0,0 +1,111 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_CHUNK_QUOTA_HPP
+#define IOX_POSH_MEPOO_CHUNK_QUOTA_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+class MemPool;
+
+/// @brief The limits for the chunks which a single user of a MemoryManager, e.g. a publisher, can acquire from every
+/// MemPool of the MemoryManager
+struct ChunkQuotaSettings
+{
+    /// @brief the maximum number of chunks per MemPool which are in use at the same time, including the chunks which
+    /// are still held by others; 0 means unlimited
+    uint32_t m_maxChunksInUse{0U};
+    /// @brief the number of chunks per MemPool which are reserved for the user and cannot be acquired by others; the
+    /// reservation is made with the first chunk request from a MemPool
+    uint32_t m_reservedChunks{0U};
+};
+
+enum class ChunkRequestError
+{
+    INVALID_STATE,
+    CHUNK_QUOTA_EXCEEDED,
+    RUNNING_OUT_OF_CHUNKS,
+};
+
+/// @brief A chunk which was acquired by a ChunkQuotaUsage
+struct QuotaChunk
+{
+    void* m_chunk{nullptr};
+    /// @brief true if the chunk was taken from the reservation of the quota
+    bool m_isReserved{false};
+};
+
+/// @brief The usage of one MemPool by one quota. The chunks are only acquired by the owner of the quota but they are
+/// released by whichever process drops the last reference, therefore all counters are atomic and outlive the owner.
+class ChunkQuotaUsage
+{
+  public:
+    ChunkQuotaUsage() noexcept = default;
+
+    ChunkQuotaUsage(const ChunkQuotaUsage&) = delete;
+    ChunkQuotaUsage(ChunkQuotaUsage&&) = delete;
+    ChunkQuotaUsage& operator=(const ChunkQuotaUsage&) = delete;
+    ChunkQuotaUsage& operator=(ChunkQuotaUsage&&) = delete;
+
+    /// @brief Acquires a chunk from the MemPool within the limits of the quota; must only be called by the owner of
+    /// the quota
+    /// @param[in] memPool from which the chunk is acquired
+    /// @param[in] settings the limits of the quota
+    /// @return the acquired chunk or the reason why no chunk could be acquired
+    cxx::expected<QuotaChunk, ChunkRequestError> acquireChunk(MemPool& memPool,
+                                                               const ChunkQuotaSettings& settings) noexcept;
+
+    /// @brief Returns a chunk which was acquired with acquireChunk to the MemPool
+    /// @param[in] memPool the chunk was acquired from
+    /// @param[in] chunk which shall be released
+    /// @param[in] isReserved whether the chunk was taken from the reservation
+    void releaseChunk(MemPool& memPool, const void* chunk, const bool isReserved) noexcept;
+
+    /// @brief Returns the reserved chunks which are not in use to the MemPool; the reserved chunks which are still in
+    /// use are returned when they are released
+    void releaseReservation(MemPool& memPool) noexcept;
+
+    /// @brief the number of chunks which were acquired and not yet released
+    uint32_t getChunksInUse() const noexcept;
+
+    /// @brief Prepares the usage for a new owner; must only be called if there are no chunks in use
+    void reset() noexcept;
+
+  private:
+    static constexpr uint32_t RESERVATION_NOT_REQUESTED{0U};
+    static constexpr uint32_t RESERVATION_GRANTED{1U};
+    static constexpr uint32_t RESERVATION_DENIED{2U};
+    static constexpr uint64_t RESERVED_CHUNKS_SHIFT{32U};
+    static constexpr uint64_t RESERVED_CHUNKS_IN_USE_MASK{(1ULL << RESERVED_CHUNKS_SHIFT) - 1U};
+
+    std::atomic<uint32_t> m_chunksInUse{0U};
+    std::atomic<uint32_t> m_reservationState{RESERVATION_NOT_REQUESTED};
+    /// @brief the number of reserved chunks in the upper and the number of reserved chunks in use in the lower 32 bit;
+    /// a combined value in order to release the reservation without a race with the release of reserved chunks
+    std::atomic<uint64_t> m_reservation{0U};
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_QUOTA_HPP
@@ -18,12 +18,16 @@
 #define IOX_POSH_MEPOO_MEM_POOL_HPP
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool_overflow.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool_profiler.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 
 
@@ -36,12 +40,14 @@ struct MemPoolInfo
     MemPoolInfo(const uint32_t usedChunks,
                 const uint32_t minFreeChunks,
                 const uint32_t numChunks,
-                const uint32_t chunkSize) noexcept;
+                const uint32_t chunkSize,
+                const uint64_t exhaustionCount = 0U) noexcept;
 
     uint32_t m_usedChunks{0};
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
+    uint64_t m_exhaustionCount{0};
 };
 
 class MemPool
@@ -49,6 +55,11 @@ class MemPool
   public:
     using freeList_t = concurrent::LoFFLi;
     static constexpr uint64_t CHUNK_MEMORY_ALIGNMENT = 8U; // default alignment for 64 bit
+    /// @brief the minimal time between two reports of an exhausted mempool
+    static constexpr std::chrono::nanoseconds EXHAUSTION_REPORT_INTERVAL{std::chrono::seconds(1)};
+    /// @brief the maximum number of chunk ranges an exhausted MemPool can acquire from a MemPoolOverflow; every
+    ///        extension has at most the number of chunks the MemPool was created with
+    static constexpr uint32_t MAX_NUMBER_OF_EXTENSIONS{4U};
 
     MemPool(const cxx::greater_or_equal<uint32_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
             const cxx::greater_or_equal<uint32_t, 1> numberOfChunks,
@@ -60,16 +71,88 @@ class MemPool
     MemPool& operator=(const MemPool&) = delete;
     MemPool& operator=(MemPool&&) = delete;
 
+    /// @brief Acquires a chunk which is not reserved
+    /// @return the chunk or nullptr if all chunks which are not reserved are in use
     void* getChunk() noexcept;
     uint32_t getChunkSize() const noexcept;
+    /// @brief returns the number of chunks including the chunks of the extensions
     uint32_t getChunkCount() const noexcept;
     uint32_t getUsedChunks() const noexcept;
     uint32_t getMinFree() const noexcept;
     MemPoolInfo getInfo() const noexcept;
 
+    /// @brief returns how often getChunk failed since the mempool was created
+    uint64_t getExhaustionCount() const noexcept;
+
+    /// @brief rate limits the reporting of an exhausted mempool to once per EXHAUSTION_REPORT_INTERVAL,
+    ///        independent of the process which is calling getChunk
+    /// @return the number of failed getChunk calls since the last report if the caller shall report the
+    ///         exhaustion, otherwise cxx::nullopt
+    cxx::optional<uint64_t> tryAcquireExhaustionReport() noexcept;
+
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief Reserves chunks which can only be acquired with getReservedChunk
+    /// @param[in] numberOfChunks the number of chunks to reserve
+    /// @return true if enough chunks are neither in use nor reserved, otherwise false and nothing is reserved
+    bool tryToReserveChunks(const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Makes reserved chunks available for getChunk again; the chunks must not be in use
+    /// @param[in] numberOfChunks the number of chunks which are no longer reserved
+    void releaseReservedChunks(const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Acquires one of the reserved chunks; the caller has to ensure that it does not acquire more chunks than
+    ///        it has reserved
+    void* getReservedChunk() noexcept;
+
+    /// @brief Releases a chunk which was acquired with getReservedChunk, the chunk stays reserved
+    void freeReservedChunk(const void* chunk) noexcept;
+
+    /// @brief returns the number of reserved chunks including the ones which are in use
+    uint32_t getReservedChunks() const noexcept;
+
+    /// @brief Reports the release of every chunk to the profiler; the chunks of the MemPool must be used for
+    ///        ChunkHeader and the MemPool must not have chunks in use when the profiler is set
+    /// @param[in] profiler which also records the allocations of the chunks
+    void setProfiler(MemPoolProfiler* const profiler) noexcept;
+
+    /// @brief Allows the MemPool to grow when it is exhausted by acquiring additional chunk ranges from the overflow;
+    ///        must be called before the first chunk is acquired
+    /// @param[in] overflow the reserve of chunk memory, which must outlive the MemPool
+    /// @param[in] managementAllocator provides the memory for the free lists of the extensions, see
+    ///            requiredExtensionManagementMemorySize
+    void enableExtensions(MemPoolOverflow* const overflow, posix::Allocator& managementAllocator) noexcept;
+
+    /// @brief returns the number of chunk ranges which were acquired from the overflow
+    uint32_t getNumberOfExtensions() const noexcept;
+
+    /// @brief the management memory which is required by enableExtensions
+    /// @param[in] numberOfChunks the number of chunks the MemPool is created with
+    static uint64_t requiredExtensionManagementMemorySize(const uint32_t numberOfChunks) noexcept;
+
   private:
+    /// @brief A chunk range which was acquired from the overflow. The state of an extension only ever advances from
+    ///        UNUSED to either FAILED or via INITIALIZING to READY
+    struct Extension
+    {
+        static constexpr uint32_t UNUSED{0U};
+        static constexpr uint32_t INITIALIZING{1U};
+        static constexpr uint32_t READY{2U};
+        static constexpr uint32_t FAILED{3U};
+
+        std::atomic<uint32_t> m_state{UNUSED};
+        rp::RelativePointer<uint8_t> m_rawMemory;
+        uint32_t m_numberOfChunks{0U};
+        rp::RelativePointer<freeList_t::Index_t> m_freeIndicesMemory;
+        freeList_t m_freeIndices;
+    };
+
+    static constexpr uint64_t RESERVED_CHUNKS_SHIFT{32U};
+    static constexpr uint64_t USED_CHUNKS_MASK{(1ULL << RESERVED_CHUNKS_SHIFT) - 1U};
+
+    void* popChunk() noexcept;
+    void pushChunk(const void* chunk) noexcept;
+    bool tryToExtend() noexcept;
     void adjustMinFree() noexcept;
     bool isMultipleOfAlignment(const uint32_t value) const noexcept;
 
@@ -81,11 +164,25 @@ class MemPool
     uint32_t m_numberOfChunks{0U};
 
     /// @todo: put this into one struct and in a separate class in concurrent.
-    std::atomic<uint32_t> m_usedChunks{0U};
+    /// @brief the number of used chunks which are not reserved in the lower and the number of reserved chunks in the
+    ///        upper 32 bit; combined in order to reserve chunks without a race with getChunk
+    std::atomic<uint64_t> m_usedAndReservedChunks{0U};
+    std::atomic<uint32_t> m_usedReservedChunks{0U};
     std::atomic<uint32_t> m_minFree{0U};
     /// @todo: end
 
+    std::atomic<uint64_t> m_exhaustionCount{0U};
+    std::atomic<uint64_t> m_reportedExhaustionCount{0U};
+    std::atomic<int64_t> m_nextExhaustionReportTime{0};
+
     freeList_t m_freeIndices;
+    rp::RelativePointer<MemPoolProfiler> m_profiler;
+
+    rp::RelativePointer<MemPoolOverflow> m_overflow;
+    Extension m_extensions[MAX_NUMBER_OF_EXTENSIONS];
+    /// @brief the extensions with a lower index are READY
+    std::atomic<uint32_t> m_numberOfExtensions{0U};
+    std::atomic<uint32_t> m_numberOfExtensionChunks{0U};
 };
 
 } // namespace mepoo
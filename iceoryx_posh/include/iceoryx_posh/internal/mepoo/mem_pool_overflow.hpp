@@ -0,0 +1,71 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_MEM_POOL_OVERFLOW_HPP
+#define IOX_POSH_MEPOO_MEM_POOL_OVERFLOW_HPP
+
+#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief A reserve of chunk memory in a shared memory segment which is shared by all mempools of a MemoryManager.
+/// An exhausted MemPool carves an additional chunk range out of this reserve instead of failing the chunk request.
+/// The memory is handed out with a lock-free bump allocation and is never returned, i.e. the extensions of the
+/// mempools live as long as the segment.
+class MemPoolOverflow
+{
+  public:
+    MemPoolOverflow() noexcept = default;
+
+    MemPoolOverflow(const MemPoolOverflow&) = delete;
+    MemPoolOverflow(MemPoolOverflow&&) = delete;
+    MemPoolOverflow& operator=(const MemPoolOverflow&) = delete;
+    MemPoolOverflow& operator=(MemPoolOverflow&&) = delete;
+
+    /// @brief Hands the reserved memory to the overflow; must be called before any allocation
+    /// @param[in] memory the reserved chunk memory, aligned to MemPool::CHUNK_MEMORY_ALIGNMENT
+    /// @param[in] size of the reserved memory in bytes
+    void init(void* const memory, const uint64_t size) noexcept;
+
+    /// @brief Allocates memory for up to maxNumberOfChunks chunks; if the remaining memory is not sufficient for
+    /// maxNumberOfChunks, the memory for as many chunks as possible is allocated
+    /// @param[in] chunkSize the size of one chunk
+    /// @param[in] maxNumberOfChunks the maximum number of chunks to allocate the memory for
+    /// @param[out] numberOfChunks the number of chunks the allocated memory is sufficient for
+    /// @return a pointer to the allocated memory or nullptr if not even a single chunk fits into the remaining memory
+    void* allocate(const uint32_t chunkSize, const uint32_t maxNumberOfChunks, uint32_t& numberOfChunks) noexcept;
+
+    /// @brief the size of the reserved memory in bytes
+    uint64_t getSize() const noexcept;
+
+    /// @brief the size of the memory in bytes which was already handed out to the mempools
+    uint64_t getUsedSize() const noexcept;
+
+  private:
+    rp::RelativePointer<uint8_t> m_memory;
+    uint64_t m_size{0U};
+    std::atomic<uint64_t> m_usedSize{0U};
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_MEM_POOL_OVERFLOW_HPP
@@ -0,0 +1,98 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_MEM_POOL_PROFILER_HPP
+#define IOX_POSH_MEPOO_MEM_POOL_PROFILER_HPP
+
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief The statistics of the chunk requests of one size class
+struct ChunkRequestStatistics
+{
+    /// @brief the largest required chunk size of a request in this size class
+    uint32_t m_maxRequiredChunkSize{0U};
+    uint64_t m_numberOfRequests{0U};
+    /// @brief the maximum number of chunks of this size class which were in use at the same time
+    uint32_t m_peakNumberOfUsedChunks{0U};
+};
+
+/// @brief Records the distribution of the required chunk sizes of the successful chunk requests of a MemoryManager and
+///        how many chunks of each size class were in use at the same time. The required chunk sizes are grouped into
+///        size classes with a relative width of at most 1/8, i.e. every power of two is split into 8 classes.
+///        All counters are atomics since chunks are acquired and released concurrently by all processes which use
+///        the MemoryManager.
+class MemPoolProfiler
+{
+  public:
+    static constexpr uint32_t SUB_CLASS_BITS{4U};
+    static constexpr uint32_t HALF_SUB_CLASS_COUNT{1U << (SUB_CLASS_BITS - 1U)};
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASSES{(32U - SUB_CLASS_BITS + 1U) * HALF_SUB_CLASS_COUNT
+                                                     + HALF_SUB_CLASS_COUNT};
+    static constexpr uint32_t DEFAULT_HEADROOM_IN_PERCENT{20U};
+
+    MemPoolProfiler() noexcept = default;
+    MemPoolProfiler(const MemPoolProfiler&) = delete;
+    MemPoolProfiler(MemPoolProfiler&&) = delete;
+    MemPoolProfiler& operator=(const MemPoolProfiler&) = delete;
+    MemPoolProfiler& operator=(MemPoolProfiler&&) = delete;
+
+    /// @brief Records a successful chunk request
+    /// @param[in] chunkHeader of the acquired chunk
+    void recordAllocation(const ChunkHeader& chunkHeader) noexcept;
+
+    /// @brief Records the release of a chunk which was recorded with recordAllocation
+    /// @param[in] chunkHeader of the released chunk; must be called before the chunk is returned to its MemPool
+    void recordRelease(const ChunkHeader& chunkHeader) noexcept;
+
+    /// @brief Returns the statistics of all size classes which had at least one request, sorted by increasing size
+    cxx::vector<ChunkRequestStatistics, NUMBER_OF_SIZE_CLASSES> getChunkRequestStatistics() const noexcept;
+
+    /// @brief Creates the mempool configuration which needs the least memory to serve the recorded peak usage of every
+    ///        size class with the given headroom. If there are more size classes than MAX_NUMBER_OF_MEMPOOLS, adjacent
+    ///        size classes are merged such that the overall memory is minimal.
+    /// @param[in] headroomInPercent additional chunks on top of the recorded peak usage
+    /// @return the mempool configuration; empty if nothing was recorded
+    MePooConfig suggestMePooConfig(const uint32_t headroomInPercent = DEFAULT_HEADROOM_IN_PERCENT) const noexcept;
+
+    /// @brief Maps a required chunk size to its size class
+    static uint32_t sizeClassOf(const uint32_t requiredChunkSize) noexcept;
+
+  private:
+    static uint32_t requiredChunkSizeOf(const ChunkHeader& chunkHeader) noexcept;
+
+    struct SizeClass
+    {
+        std::atomic<uint64_t> m_numberOfRequests{0U};
+        std::atomic<uint32_t> m_usedChunks{0U};
+        std::atomic<uint32_t> m_peakUsedChunks{0U};
+        std::atomic<uint32_t> m_maxRequiredChunkSize{0U};
+    };
+
+    SizeClass m_sizeClasses[NUMBER_OF_SIZE_CLASSES];
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_MEM_POOL_PROFILER_HPP
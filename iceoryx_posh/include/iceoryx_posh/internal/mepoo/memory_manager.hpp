@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_quota.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
@@ -46,6 +47,11 @@ class MemoryManager
     using MaxChunkPayloadSize_t = cxx::range<uint32_t, 1, std::numeric_limits<uint32_t>::max() - sizeof(ChunkHeader)>;
 
   public:
+    /// @brief the chunk quota of a chunk request without quota
+    static constexpr uint32_t NO_CHUNK_QUOTA{std::numeric_limits<uint32_t>::max()};
+    /// @brief every publisher can have its own chunk quota
+    static constexpr uint32_t MAX_NUMBER_OF_CHUNK_QUOTAS{MAX_PUBLISHERS};
+
     MemoryManager() noexcept = default;
     MemoryManager(const MemoryManager&) = delete;
     MemoryManager(MemoryManager&&) = delete;
@@ -59,16 +65,41 @@ class MemoryManager
 
     SharedChunk getChunk(const ChunkSettings& chunkSettings) noexcept;
 
+    /// @brief Acquires a chunk within the limits of a chunk quota; must only be called by the owner of the quota
+    /// @param[in] chunkSettings for the requested chunk
+    /// @param[in] chunkQuota which was acquired with acquireChunkQuota or NO_CHUNK_QUOTA
+    /// @return the chunk or the reason why no chunk could be acquired
+    cxx::expected<SharedChunk, ChunkRequestError> getChunk(const ChunkSettings& chunkSettings,
+                                                           const uint32_t chunkQuota) noexcept;
+
+    /// @brief Acquires a chunk quota which limits the chunks the owner can have in use from every MemPool; an unset
+    ///        limit is replaced by the one of the MePooConfig
+    /// @param[in] settings the limits of the quota
+    /// @return the chunk quota for getChunk or NO_CHUNK_QUOTA if there are no limits or all chunk quotas are in use
+    uint32_t acquireChunkQuota(const ChunkQuotaSettings& settings) noexcept;
+
+    /// @brief Releases a chunk quota whose owner will not acquire chunks anymore; the chunks which are still in use are
+    ///        accounted to the quota until they are released
+    /// @param[in] chunkQuota which was acquired with acquireChunkQuota
+    void releaseChunkQuota(const uint32_t chunkQuota) noexcept;
+
     uint32_t getNumberOfMemPools() const noexcept;
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
 
+    /// @brief Access to the recorded chunk requests
+    /// @return the profiler if the MemoryManager was configured with MePooConfig::m_profileChunkRequests, otherwise
+    ///         cxx::nullopt
+    cxx::optional<const MemPoolProfiler*> getProfiler() const noexcept;
+
     static uint64_t requiredChunkMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredManagementMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredFullMemorySize(const MePooConfig& mePooConfig) noexcept;
 
   private:
     static uint32_t sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept;
+    static uint32_t maxNumberOfExtensionChunks(const MePooConfig& mePooConfig) noexcept;
+    ChunkQuotaUsage& chunkQuotaUsage(const uint32_t chunkQuota, const uint32_t memPoolIndex) noexcept;
 
     void printMemPoolVector(log::LogStream& log) const noexcept;
     void addMemPool(posix::Allocator& managementAllocator,
@@ -79,10 +110,24 @@ class MemoryManager
 
   private:
     bool m_denyAddMemPool{false};
+    bool m_profileChunkRequests{false};
     uint32_t m_totalNumberOfChunks{0};
 
     cxx::vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     cxx::vector<MemPool, 1> m_chunkManagementPool;
+    MemPoolProfiler m_profiler;
+    MemPoolOverflow m_overflow;
+
+    /// @brief the settings of the quotas are only accessed by RouDi and the owner of the quota
+    struct ChunkQuota
+    {
+        ChunkQuotaSettings m_settings;
+        bool m_isAcquired{false};
+    };
+    ChunkQuota m_chunkQuotas[MAX_NUMBER_OF_CHUNK_QUOTAS];
+    ChunkQuotaSettings m_defaultChunkQuota;
+    /// @brief MAX_NUMBER_OF_CHUNK_QUOTAS usages for every MemPool
+    rp::RelativePointer<ChunkQuotaUsage> m_chunkQuotaUsages;
 };
 
 } // namespace mepoo
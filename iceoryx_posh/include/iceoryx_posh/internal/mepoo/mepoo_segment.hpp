@@ -21,6 +21,7 @@
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
@@ -37,7 +38,8 @@ class MePooSegment
                  posix::Allocator& managementAllocator,
                  const posix::PosixGroup& readerGroup,
                  const posix::PosixGroup& writerGroup,
-                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept;
+                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                 const roudi::ProcessScope processScope = roudi::ProcessScope::MULTI_PROCESS) noexcept;
 
     posix::PosixGroup getWriterGroup() const noexcept;
     posix::PosixGroup getReaderGroup() const noexcept;
@@ -48,7 +50,10 @@ class MePooSegment
 
   protected:
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& mempoolConfig,
-                                                    const posix::PosixGroup& writerGroup) noexcept;
+                                                    const posix::PosixGroup& writerGroup,
+                                                    const roudi::ProcessScope processScope) noexcept;
+
+    void applyAccessRights(const posix::PosixGroup& readerGroup, const posix::PosixGroup& writerGroup) noexcept;
 
   protected:
     SharedMemoryObjectType m_sharedMemoryObject;
@@ -33,11 +33,27 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     posix::Allocator& managementAllocator,
     const posix::PosixGroup& readerGroup,
     const posix::PosixGroup& writerGroup,
-    const iox::mepoo::MemoryInfo& memoryInfo) noexcept
-    : m_sharedMemoryObject(std::move(createSharedMemoryObject(mempoolConfig, writerGroup)))
+    const iox::mepoo::MemoryInfo& memoryInfo,
+    const roudi::ProcessScope processScope) noexcept
+    : m_sharedMemoryObject(std::move(createSharedMemoryObject(mempoolConfig, writerGroup, processScope)))
     , m_readerGroup(readerGroup)
     , m_writerGroup(writerGroup)
     , m_memoryInfo(memoryInfo)
+{
+    // the access rights are only required for the shared memory which is opened by other processes
+    if (processScope == roudi::ProcessScope::MULTI_PROCESS)
+    {
+        applyAccessRights(readerGroup, writerGroup);
+    }
+
+    m_memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, *m_sharedMemoryObject.getAllocator());
+    m_sharedMemoryObject.finalizeAllocation();
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline void
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::applyAccessRights(const posix::PosixGroup& readerGroup,
+                                                                           const posix::PosixGroup& writerGroup) noexcept
 {
     using namespace posix;
     AccessController accessController;
@@ -56,14 +72,13 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     {
         errorHandler(Error::kMEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
     }
-
-    m_memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, *m_sharedMemoryObject.getAllocator());
-    m_sharedMemoryObject.finalizeAllocation();
 }
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createSharedMemoryObject(
-    const MePooConfig& mempoolConfig, const posix::PosixGroup& writerGroup) noexcept
+    const MePooConfig& mempoolConfig,
+    const posix::PosixGroup& writerGroup,
+    const roudi::ProcessScope processScope) noexcept
 {
     // we let the OS decide where to map the shm segments
     constexpr void* BASE_ADDRESS_HINT{nullptr};
@@ -72,13 +87,19 @@ inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManager
     constexpr char SHARED_MEMORY_NAME_PREFIX[] = "/";
     posix::SharedMemory::Name_t shmName = SHARED_MEMORY_NAME_PREFIX + writerGroup.getName();
 
+    const auto memorySize = MemoryManager::requiredChunkMemorySize(mempoolConfig);
+    auto maybeSharedMemoryObject =
+        (processScope == roudi::ProcessScope::SINGLE_PROCESS)
+            ? SharedMemoryObjectType::create(posix::CreateUnnamedSingleProcessMemory, memorySize, BASE_ADDRESS_HINT)
+            : SharedMemoryObjectType::create(shmName,
+                                             memorySize,
+                                             posix::AccessMode::READ_WRITE,
+                                             posix::OpenMode::PURGE_AND_CREATE,
+                                             BASE_ADDRESS_HINT,
+                                             static_cast<mode_t>(S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP));
+
     return std::move(
-        SharedMemoryObjectType::create(shmName,
-                                       MemoryManager::requiredChunkMemorySize(mempoolConfig),
-                                       posix::AccessMode::READ_WRITE,
-                                       posix::OpenMode::PURGE_AND_CREATE,
-                                       BASE_ADDRESS_HINT,
-                                       static_cast<mode_t>(S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP))
+        maybeSharedMemoryObject
             .and_then([this](auto& sharedMemoryObject) {
                 this->setSegmentId(iox::rp::BaseRelativePointer::registerPtr(sharedMemoryObject.getBaseAddress(),
                                                                              sharedMemoryObject.getSizeInBytes()));
@@ -28,6 +28,8 @@
 #include "iceoryx_posh/internal/mepoo/mepoo_segment.hpp"
 #include "iceoryx_posh/mepoo/segment_config.hpp"
 
+#include <string>
+
 namespace iox
 {
 namespace roudi
@@ -42,7 +44,9 @@ template <typename SegmentType = MePooSegment<>>
 class SegmentManager
 {
   public:
-    SegmentManager(const SegmentConfig& segmentConfig, posix::Allocator* managementAllocator) noexcept;
+    SegmentManager(const SegmentConfig& segmentConfig,
+                   posix::Allocator* managementAllocator,
+                   const roudi::ProcessScope processScope = roudi::ProcessScope::MULTI_PROCESS) noexcept;
     ~SegmentManager() noexcept = default;
 
     SegmentManager(const SegmentManager& rhs) = delete;
@@ -89,6 +93,14 @@ class SegmentManager
     SegmentMappingContainer getSegmentMappings(const posix::PosixUser& user) noexcept;
     SegmentUserInformation getSegmentInformationWithWriteAccessForUser(const posix::PosixUser& user) noexcept;
 
+    /// @brief Creates a RouDi config file in the TOML format. The segments which are configured with
+    ///        MePooConfig::m_profileChunkRequests get the mempools which are suggested by their MemPoolProfiler, all
+    ///        other segments and profiled segments without any recorded chunk request keep their current mempools.
+    /// @param[in] headroomInPercent additional chunks on top of the recorded peak usage
+    /// @return the content of the config file or cxx::nullopt if no segment is profiled
+    cxx::optional<std::string>
+    suggestConfig(const uint32_t headroomInPercent = MemPoolProfiler::DEFAULT_HEADROOM_IN_PERCENT) noexcept;
+
     static uint64_t requiredManagementMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredChunkMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredFullMemorySize(const SegmentConfig& config) noexcept;
@@ -101,6 +113,7 @@ class SegmentManager
     friend class roudi::MemPoolIntrospection;
 
     posix::Allocator* m_managementAllocator;
+    roudi::ProcessScope m_processScope;
     cxx::vector<SegmentType, MAX_SHM_SEGMENTS> m_segmentContainer;
     bool m_createInterfaceEnabled{true};
 };
@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_MEPOO_SEGMENT_MANAGER_INL
 #define IOX_POSH_MEPOO_SEGMENT_MANAGER_INL
 
+#include "iceoryx_hoofs/cxx/convert.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
@@ -28,8 +29,10 @@ namespace mepoo
 {
 template <typename SegmentType>
 inline SegmentManager<SegmentType>::SegmentManager(const SegmentConfig& segmentConfig,
-                                                   posix::Allocator* managementAllocator) noexcept
+                                                   posix::Allocator* managementAllocator,
+                                                   const roudi::ProcessScope processScope) noexcept
     : m_managementAllocator(managementAllocator)
+    , m_processScope(processScope)
 {
     cxx::Expects(segmentConfig.m_sharedMemorySegments.capacity() <= m_segmentContainer.capacity());
     for (const auto& segmentEntry : segmentConfig.m_sharedMemorySegments)
@@ -43,8 +46,12 @@ inline void SegmentManager<SegmentType>::createSegment(const SegmentConfig::Segm
 {
     auto readerGroup = iox::posix::PosixGroup(segmentEntry.m_readerGroup);
     auto writerGroup = iox::posix::PosixGroup(segmentEntry.m_writerGroup);
-    m_segmentContainer.emplace_back(
-        segmentEntry.m_mempoolConfig, *m_managementAllocator, readerGroup, writerGroup, segmentEntry.m_memoryInfo);
+    m_segmentContainer.emplace_back(segmentEntry.m_mempoolConfig,
+                                    *m_managementAllocator,
+                                    readerGroup,
+                                    writerGroup,
+                                    segmentEntry.m_memoryInfo,
+                                    m_processScope);
 }
 
 template <typename SegmentType>
@@ -130,6 +137,55 @@ SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const p
     return segmentInfo;
 }
 
+template <typename SegmentType>
+inline cxx::optional<std::string>
+SegmentManager<SegmentType>::suggestConfig(const uint32_t headroomInPercent) noexcept
+{
+    auto appendMemPool = [](std::string& config, const uint64_t chunkPayloadSize, const uint64_t chunkCount) {
+        config += "\n[[segment.mempool]]\nsize = " + cxx::convert::toString(chunkPayloadSize)
+                  + "\ncount = " + cxx::convert::toString(chunkCount) + "\n";
+    };
+
+    bool isAnySegmentProfiled{false};
+    std::string config{"[general]\nversion = 1\n"};
+    for (auto& segment : m_segmentContainer)
+    {
+        config += "\n[[segment]]\nreader = \"" + std::string(segment.getReaderGroup().getName().c_str())
+                  + "\"\nwriter = \"" + std::string(segment.getWriterGroup().getName().c_str()) + "\"\n";
+
+        auto& memoryManager = segment.getMemoryManager();
+        MePooConfig suggestedConfig;
+        auto profiler = memoryManager.getProfiler();
+        if (profiler.has_value())
+        {
+            isAnySegmentProfiled = true;
+            suggestedConfig = profiler.value()->suggestMePooConfig(headroomInPercent);
+        }
+
+        if (!suggestedConfig.m_mempoolConfig.empty())
+        {
+            for (const auto& entry : suggestedConfig.m_mempoolConfig)
+            {
+                appendMemPool(config, entry.m_size, entry.m_chunkCount);
+            }
+        }
+        else
+        {
+            for (uint32_t i = 0U; i < memoryManager.getNumberOfMemPools(); ++i)
+            {
+                const auto info = memoryManager.getMemPoolInfo(i);
+                appendMemPool(config, info.m_chunkSize - sizeof(ChunkHeader), info.m_numChunks);
+            }
+        }
+    }
+
+    if (!isAnySegmentProfiled)
+    {
+        return cxx::nullopt;
+    }
+    return config;
+}
+
 template <typename SegmentType>
 uint64_t SegmentManager<SegmentType>::requiredManagementMemorySize(const SegmentConfig& config) noexcept
 {
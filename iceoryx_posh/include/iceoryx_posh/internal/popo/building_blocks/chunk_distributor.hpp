@@ -18,6 +18,7 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
@@ -96,12 +97,33 @@ class ChunkDistributor
     bool hasStoredQueues() const noexcept;
 
     /// @brief Deliver the provided shared chunk to all the stored chunk queues. The chunk will be added to the chunk
-    /// history
+    /// history. Queues whose user-header filter does not match the chunk or whose delivery rate limit is reached are
+    /// skipped
     /// @param[in] shared chunk to be delivered
     void deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Deliver the provided shared chunk only to the stored chunk queue with the provided unique id. The chunk
+    /// will NOT be added to the chunk history. If the queue is still stored at lastKnownQueueIndex this is O(1),
+    /// otherwise the stored queues are searched
+    /// @param[in] uniqueQueueId, the unique id of the chunk queue to which this chunk shall be delivered
+    /// @param[in] lastKnownQueueIndex, the index of the chunk queue in the stored queues the last time it was looked up
+    /// @param[in] shared chunk to be delivered
+    /// @return success if the queue is stored, otherwise ChunkDistributorError::QUEUE_NOT_IN_CONTAINER; a queue
+    /// overflow is signaled to the queue as lost chunk
+    cxx::expected<ChunkDistributorError> deliverToQueue(const typename ChunkQueueData_t::UniqueId_t uniqueQueueId,
+                                                        const uint32_t lastKnownQueueIndex,
+                                                        mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief Get the index of a stored chunk queue which can be used as lastKnownQueueIndex for deliverToQueue
+    /// @param[in] uniqueQueueId, the unique id of the chunk queue
+    /// @param[in] lastKnownQueueIndex, the index of the chunk queue the last time it was looked up; is checked first
+    /// @return the index of the chunk queue if it is stored, otherwise an empty optional
+    cxx::optional<uint32_t> getQueueIndex(const typename ChunkQueueData_t::UniqueId_t uniqueQueueId,
+                                          const uint32_t lastKnownQueueIndex) const noexcept;
+
     /// @brief Deliver the provided shared chunk to the provided chunk queue. The chunk will NOT be added to the chunk
-    /// history
+    /// history. A chunk which does not match the user-header filter of the queue is not delivered; the delivery rate
+    /// limit of the queue does not apply
     /// @param[in] chunk queue to which this chunk shall be delivered
     /// @param[in] shared chunk to be delivered
     /// @return false if a queue overflow occured, otherwise true
@@ -130,6 +152,16 @@ class ChunkDistributor
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+  private:
+    /// @pre the lock of the chunk distributor data is held
+    cxx::optional<uint32_t> findQueueIndex(const typename ChunkQueueData_t::UniqueId_t uniqueQueueId,
+                                           const uint32_t lastKnownQueueIndex) const noexcept;
+
+    /// @pre the lock of the chunk distributor data is held and index is less than the history capacity
+    /// @param[in] index position in the history, 0 is the oldest chunk
+    /// @return the history slot at the position
+    mepoo::ShmSafeUnmanagedChunk& historyAt(const uint64_t index) noexcept;
+
   private:
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
@@ -62,7 +62,7 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueue
             // PRQA S 3804 1 # we checked the capacity, so pushing will be fine
             getMembers()->m_queues.push_back(rp::RelativePointer<ChunkQueueData_t>(queueToAdd));
 
-            const auto currChunkHistorySize = getMembers()->m_history.size();
+            const auto currChunkHistorySize = getMembers()->m_historySize;
 
             if (requestedHistory > getMembers()->m_historyCapacity)
             {
@@ -76,7 +76,7 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueue
                 (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
             for (auto i = startIndex; i < currChunkHistorySize; ++i)
             {
-                deliverToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
+                deliverToQueue(queueToAdd, historyAt(i).cloneToSharedChunk());
             }
 
             return cxx::success<void>();
@@ -142,10 +142,18 @@ inline void ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues
         // send to all the queues
         for (auto& queue : getMembers()->m_queues)
         {
+            // the rate limit is only applied here since a retried delivery to a blocking queue must not count the
+            // chunk again
+            if (!queue->m_userHeaderFilter.matches(*chunk.getChunkHeader())
+                || !queue->m_deliveryRateLimiter.isNextChunkDue())
+            {
+                continue;
+            }
+
             bool isBlockingQueue =
                 (willWaitForSubscriber && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PUBLISHER);
 
-            if (!deliverToQueue(queue.get(), chunk))
+            if (!ChunkQueuePusher_t(queue.get()).push(chunk))
             {
                 if (isBlockingQueue)
                 {
@@ -200,10 +208,74 @@ inline void ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues
     addToHistoryWithoutDelivery(chunk);
 }
 
+template <typename ChunkDistributorDataType>
+inline cxx::expected<ChunkDistributorError>
+ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const typename ChunkQueueData_t::UniqueId_t uniqueQueueId,
+                                                           const uint32_t lastKnownQueueIndex,
+                                                           mepoo::SharedChunk chunk) noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+
+    // the queue must be looked up since its owner could already be disconnected and the queue memory be reused
+    auto queueIndex = findQueueIndex(uniqueQueueId, lastKnownQueueIndex);
+    if (!queueIndex.has_value())
+    {
+        return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
+    }
+
+    auto queue = getMembers()->m_queues[queueIndex.value()].get();
+    if (!deliverToQueue(queue, chunk))
+    {
+        ChunkQueuePusher_t(queue).lostAChunk();
+    }
+
+    return cxx::success<void>();
+}
+
+template <typename ChunkDistributorDataType>
+inline cxx::optional<uint32_t>
+ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const typename ChunkQueueData_t::UniqueId_t uniqueQueueId,
+                                                          const uint32_t lastKnownQueueIndex) const noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+
+    return findQueueIndex(uniqueQueueId, lastKnownQueueIndex);
+}
+
+template <typename ChunkDistributorDataType>
+inline cxx::optional<uint32_t>
+ChunkDistributor<ChunkDistributorDataType>::findQueueIndex(const typename ChunkQueueData_t::UniqueId_t uniqueQueueId,
+                                                           const uint32_t lastKnownQueueIndex) const noexcept
+{
+    const auto& queues = getMembers()->m_queues;
+
+    // the index only changes when a queue with a lower index is removed
+    if (lastKnownQueueIndex < queues.size() && queues[lastKnownQueueIndex]->m_uniqueId == uniqueQueueId)
+    {
+        return lastKnownQueueIndex;
+    }
+
+    for (uint32_t i = 0U; i < queues.size(); ++i)
+    {
+        if (queues[i]->m_uniqueId == uniqueQueueId)
+        {
+            return i;
+        }
+    }
+
+    return cxx::nullopt_t();
+}
+
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(cxx::not_null<ChunkQueueData_t* const> queue,
                                                                        mepoo::SharedChunk chunk) noexcept
 {
+    // a chunk which is filtered out counts as delivered, the queue neither loses it nor blocks the publisher
+    const auto& userHeaderFilter = static_cast<ChunkQueueData_t*>(queue)->m_userHeaderFilter;
+    if (!userHeaderFilter.matches(*chunk.getChunkHeader()))
+    {
+        return true;
+    }
     return ChunkQueuePusher_t(queue).push(chunk);
 }
 
@@ -214,15 +286,19 @@ inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDeliv
 
     if (0u < getMembers()->m_historyCapacity)
     {
-        if (getMembers()->m_history.size() >= getMembers()->m_historyCapacity)
+        if (getMembers()->m_historySize >= getMembers()->m_historyCapacity)
         {
-            auto chunkToRemove = getMembers()->m_history.begin();
-            chunkToRemove->releaseToSharedChunk();
-            // PRQA S 3804 1 # we are not iterating here, so return value can be ignored
-            getMembers()->m_history.erase(chunkToRemove);
+            // the slot of the oldest chunk is reused for the new chunk which then becomes the youngest one
+            auto& oldestChunk = historyAt(0U);
+            oldestChunk.releaseToSharedChunk();
+            oldestChunk = mepoo::ShmSafeUnmanagedChunk(chunk);
+            getMembers()->m_historyStart = (getMembers()->m_historyStart + 1U) % getMembers()->m_historyCapacity;
+        }
+        else
+        {
+            historyAt(getMembers()->m_historySize) = mepoo::ShmSafeUnmanagedChunk(chunk);
+            ++getMembers()->m_historySize;
         }
-        // PRQA S 3804 1 # we ensured that there is space in the history, so return value can be ignored
-        getMembers()->m_history.push_back(chunk); // PRQA S 3804
     }
 }
 
@@ -231,7 +307,7 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::getHistorySize() noe
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    return getMembers()->m_history.size();
+    return getMembers()->m_historySize;
 }
 
 template <typename ChunkDistributorDataType>
@@ -245,12 +321,19 @@ inline void ChunkDistributor<ChunkDistributorDataType>::clearHistory() noexcept
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    for (auto& unmanagedChunk : getMembers()->m_history)
+    for (uint64_t i = 0U; i < getMembers()->m_historySize; ++i)
     {
-        unmanagedChunk.releaseToSharedChunk();
+        historyAt(i).releaseToSharedChunk();
     }
 
-    getMembers()->m_history.clear();
+    getMembers()->m_historyStart = 0U;
+    getMembers()->m_historySize = 0U;
+}
+
+template <typename ChunkDistributorDataType>
+inline mepoo::ShmSafeUnmanagedChunk& ChunkDistributor<ChunkDistributorDataType>::historyAt(const uint64_t index) noexcept
+{
+    return getMembers()->m_history[(getMembers()->m_historyStart + index) % getMembers()->m_historyCapacity];
 }
 
 template <typename ChunkDistributorDataType>
@@ -52,13 +52,13 @@ struct ChunkDistributorData : public LockingPolicy
         cxx::vector<rp::RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
     QueueContainer_t m_queues;
 
-    /// @todo If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
-    /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
+    /// @brief The history is a ring buffer of which only the first m_historyCapacity slots are used, therefore
+    /// replacing the oldest chunk of a full history is O(1). m_historyStart is the slot of the oldest chunk.
     /// Using ShmSafeUnmanagedChunk since RouDi must access this list to cleanup the chunks in case of an application
     /// crash.
-    using HistoryContainer_t =
-        cxx::vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
-    HistoryContainer_t m_history;
+    mepoo::ShmSafeUnmanagedChunk m_history[ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY];
+    uint64_t m_historyStart{0U};
+    uint64_t m_historySize{0U};
     const SubscriberTooSlowPolicy m_subscriberTooSlowPolicy;
 };
 
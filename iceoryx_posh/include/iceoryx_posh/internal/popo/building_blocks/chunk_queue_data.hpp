@@ -24,7 +24,10 @@
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/delivery_rate_limiter.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/typed_unique_id.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
+#include "iceoryx_posh/popo/user_header_filter.hpp"
 
 namespace iox
 {
@@ -36,6 +39,7 @@ struct ChunkQueueData : public LockingPolicy
     using ThisType_t = ChunkQueueData<ChunkQueueDataProperties, LockingPolicy>;
     using LockGuard_t = std::lock_guard<const ThisType_t>;
     using ChunkQueueDataProperties_t = ChunkQueueDataProperties;
+    using UniqueId_t = TypedUniqueId<ThisType_t>;
 
     ChunkQueueData(const QueueFullPolicy policy, const cxx::VariantQueueTypes queueType) noexcept;
 
@@ -45,7 +49,18 @@ struct ChunkQueueData : public LockingPolicy
 
     rp::RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     cxx::optional<uint64_t> m_conditionVariableNotificationIndex;
+    /// @brief guards m_conditionVariableDataPtr and m_conditionVariableNotificationIndex for the pushers without a
+    /// lock; they are only read while the flag is set and the reader is registered in m_numberOfNotifyingPushers
+    std::atomic_bool m_isConditionVariableSet{false};
+    /// @brief number of pushers which are currently notifying the condition variable; detaching waits for zero
+    std::atomic<uint64_t> m_numberOfNotifyingPushers{0U};
     const QueueFullPolicy m_queueFullPolicy;
+    /// @brief only the chunks which pass this filter are pushed into the queue
+    UserHeaderFilter m_userHeaderFilter;
+    /// @brief downsamples the chunks which passed the filter before they are pushed into the queue
+    DeliveryRateLimiter m_deliveryRateLimiter;
+    /// @brief identifies the queue independent of its address, which could be reused by another queue
+    const UniqueId_t m_uniqueId{};
 };
 
 } // namespace popo
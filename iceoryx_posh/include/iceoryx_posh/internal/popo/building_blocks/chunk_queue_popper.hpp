@@ -97,6 +97,10 @@ class ChunkQueuePopper
     MemberType_t* getMembers() noexcept;
 
   private:
+    /// @brief clears the condition variable flag and waits until no pusher is notifying the condition variable anymore
+    /// @pre the lock of the chunk queue data is held
+    void detachConditionVariableFromPushers() noexcept;
+
     MemberType_t* m_chunkQueueDataPtr;
 };
 
@@ -18,6 +18,7 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_POPPER_INL
 
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include <thread>
 
 namespace iox
 {
@@ -129,8 +130,10 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::setConditionVariable(Condition
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    detachConditionVariableFromPushers();
     getMembers()->m_conditionVariableDataPtr = &conditionVariableDataRef;
     getMembers()->m_conditionVariableNotificationIndex.emplace(notificationIndex);
+    getMembers()->m_isConditionVariableSet.store(true, std::memory_order_release);
 }
 
 template <typename ChunkQueueDataType>
@@ -138,10 +141,22 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::unsetConditionVariable() noexc
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    detachConditionVariableFromPushers();
     getMembers()->m_conditionVariableDataPtr = nullptr;
     getMembers()->m_conditionVariableNotificationIndex.reset();
 }
 
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::detachConditionVariableFromPushers() noexcept
+{
+    getMembers()->m_isConditionVariableSet.store(false, std::memory_order_seq_cst);
+    // a pusher which registered before the flag was cleared may still notify; the window is only a few instructions
+    while (getMembers()->m_numberOfNotifyingPushers.load(std::memory_order_seq_cst) != 0U)
+    {
+        std::this_thread::yield();
+    }
+}
+
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::isConditionVariableSet() const noexcept
 {
@@ -57,14 +57,19 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
         hasQueueOverflow = true;
     }
 
+    // no lock here; with many publishers feeding one subscriber the queue lock would serialize all of them. The
+    // registration in m_numberOfNotifyingPushers keeps the popper from detaching the condition variable while it is
+    // notified, see ChunkQueuePopper::unsetConditionVariable
+    if (getMembers()->m_isConditionVariableSet.load(std::memory_order_relaxed))
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
-        if (getMembers()->m_conditionVariableDataPtr)
+        getMembers()->m_numberOfNotifyingPushers.fetch_add(1U, std::memory_order_seq_cst);
+        if (getMembers()->m_isConditionVariableSet.load(std::memory_order_seq_cst))
         {
             ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
                               *getMembers()->m_conditionVariableNotificationIndex)
                 .notify();
         }
+        getMembers()->m_numberOfNotifyingPushers.fetch_sub(1U, std::memory_order_release);
     }
 
     return !hasQueueOverflow;
@@ -24,6 +24,7 @@
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_writer.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/typed_unique_id.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 
@@ -37,6 +38,7 @@ enum class AllocationError
     RUNNING_OUT_OF_CHUNKS,
     TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL,
     INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER,
+    CHUNK_QUOTA_EXCEEDED,
 };
 
 /// @brief The ChunkSender is a building block of the shared memory communication infrastructure. It extends
@@ -80,10 +82,20 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
 
-    /// @brief Send an allocated chunk to all connected ChunkQueuePopper
+    /// @brief Send an allocated chunk to all connected ChunkQueuePopper and make it the latest value if it is provided
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send
     void send(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send an allocated chunk only to the stored ChunkQueuePopper with the provided unique id. The chunk is
+    /// neither added to the history nor kept as previous chunk
+    /// @param[in] chunkHeader, pointer to the ChunkHeader to send
+    /// @param[in] uniqueQueueId, the unique id of the chunk queue to which the chunk shall be delivered
+    /// @param[in] lastKnownQueueIndex, the index of the chunk queue the last time it was looked up, see getQueueIndex
+    /// @return true if the queue is stored and the chunk was delivered, false if the chunk was discarded
+    bool sendToQueue(mepoo::ChunkHeader* const chunkHeader,
+                     const typename Base_t::ChunkQueueData_t::UniqueId_t uniqueQueueId,
+                     const uint32_t lastKnownQueueIndex) noexcept;
+
     /// @brief Push an allocated chunk to the history without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to push to the history
     void pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -104,6 +116,10 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return true if there was a matching chunk with this header, false if not
     bool getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader, mepoo::SharedChunk& chunk) noexcept;
 
+    /// @brief Makes the chunk the latest value which subscribers can peek
+    /// @param[in] chunk that was sent last
+    void updateLatestValue(const mepoo::SharedChunk& chunk) noexcept;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 };
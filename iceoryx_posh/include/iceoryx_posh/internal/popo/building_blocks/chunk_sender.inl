@@ -85,8 +85,14 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     {
         // BEGIN of critical section, chunk will be lost if process gets hard terminated in between
         // get a new chunk
-        mepoo::SharedChunk chunk = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+        auto maybeChunk = getMembers()->m_memoryMgr->getChunk(chunkSettings, getMembers()->m_chunkQuota);
+        if (maybeChunk.has_error() && maybeChunk.get_error() == mepoo::ChunkRequestError::CHUNK_QUOTA_EXCEEDED)
+        {
+            return cxx::error<AllocationError>(AllocationError::CHUNK_QUOTA_EXCEEDED);
+        }
 
+        mepoo::SharedChunk chunk;
+        maybeChunk.and_then([&](mepoo::SharedChunk& acquiredChunk) { chunk = std::move(acquiredChunk); });
         if (chunk)
         {
             // if the application allocated too much chunks, return no more chunks
@@ -129,6 +135,7 @@ inline void ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const chu
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
         this->deliverToAllStoredQueues(chunk);
+        updateLatestValue(chunk);
 
         getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
         getMembers()->m_lastChunkUnmanaged = chunk;
@@ -136,6 +143,22 @@ inline void ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const chu
     // END of critical section, chunk will be lost if process gets hard terminated in between
 }
 
+template <typename ChunkSenderDataType>
+inline bool
+ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* const chunkHeader,
+                                              const typename Base_t::ChunkQueueData_t::UniqueId_t uniqueQueueId,
+                                              const uint32_t lastKnownQueueIndex) noexcept
+{
+    mepoo::SharedChunk chunk(nullptr);
+    // BEGIN of critical section, chunk will be lost if process gets hard terminated in between
+    if (getChunkReadyForSend(chunkHeader, chunk))
+    {
+        return !this->deliverToQueue(uniqueQueueId, lastKnownQueueIndex, chunk).has_error();
+    }
+    // END of critical section, chunk will be lost if process gets hard terminated in between
+    return false;
+}
+
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -144,6 +167,7 @@ inline void ChunkSender<ChunkSenderDataType>::pushToHistory(mepoo::ChunkHeader*
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
         this->addToHistoryWithoutDelivery(chunk);
+        updateLatestValue(chunk);
 
         getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
         getMembers()->m_lastChunkUnmanaged = chunk;
@@ -170,6 +194,7 @@ inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
     getMembers()->m_chunksInUse.cleanup();
     this->cleanup();
     getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+    LatestValueWriter(&getMembers()->m_latestValue).releaseAll();
 }
 
 template <typename ChunkSenderDataType>
@@ -188,6 +213,16 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
     }
 }
 
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::updateLatestValue(const mepoo::SharedChunk& chunk) noexcept
+{
+    if (getMembers()->m_isLatestValueProvided)
+    {
+        // if all other slots are still used by readers the previous value stays the latest one
+        LatestValueWriter(&getMembers()->m_latestValue).update(chunk);
+    }
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -22,6 +22,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_data.hpp"
 #include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 
@@ -44,6 +45,9 @@ struct ChunkSenderData : public ChunkDistributorDataType
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
+    uint32_t m_chunkQuota{mepoo::MemoryManager::NO_CHUNK_QUOTA};
+    bool m_isLatestValueProvided{false};
+    LatestValueData m_latestValue;
 };
 
 } // namespace popo
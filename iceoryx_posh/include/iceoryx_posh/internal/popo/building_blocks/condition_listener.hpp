@@ -20,6 +20,9 @@
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iceoryx_posh/popo/wait_options.hpp"
+
+#include <chrono>
 
 namespace iox
 {
@@ -32,7 +35,9 @@ class ConditionListener
     using NotificationVector_t = cxx::vector<cxx::BestFittingType_t<MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE>,
                                              MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE>;
 
-    explicit ConditionListener(ConditionVariableData& condVarData) noexcept;
+    /// @param[in] condVarData the condition variable to wait on
+    /// @param[in] waitOptions defines whether the notifications are polled before or instead of blocking
+    explicit ConditionListener(ConditionVariableData& condVarData, const WaitOptions& waitOptions = WaitOptions()) noexcept;
     ~ConditionListener() noexcept = default;
     ConditionListener(const ConditionListener& rhs) = delete;
     ConditionListener(ConditionListener&& rhs) noexcept = delete;
@@ -71,12 +76,16 @@ class ConditionListener
 
   private:
     void reset(const uint64_t index) noexcept;
+    bool hasActiveNotification() const noexcept;
     void resetSemaphore() noexcept;
+    bool spinUntilNotified(const std::chrono::steady_clock::time_point& deadline) const noexcept;
 
-    NotificationVector_t waitImpl(const cxx::function_ref<bool()>& waitCall) noexcept;
+    NotificationVector_t waitImpl(const cxx::function_ref<bool()>& waitCall,
+                                  const std::chrono::steady_clock::time_point& spinDeadline) noexcept;
 
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
+    WaitOptions m_waitOptions;
     std::atomic_bool m_toBeDestroyed{false};
 };
 
@@ -31,6 +31,9 @@ struct ConditionVariableData
 {
     ConditionVariableData() noexcept;
     ConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
+    /// @brief Creates the ConditionVariableData with a process-private semaphore for ProcessScope::SINGLE_PROCESS
+    /// and with a semaphore which can be shared between processes for ProcessScope::MULTI_PROCESS
+    ConditionVariableData(const RuntimeName_t& runtimeName, const roudi::ProcessScope processScope) noexcept;
 
     ConditionVariableData(const ConditionVariableData& rhs) = delete;
     ConditionVariableData(ConditionVariableData&& rhs) = delete;
@@ -38,18 +41,17 @@ struct ConditionVariableData
     ConditionVariableData& operator=(ConditionVariableData&& rhs) = delete;
     ~ConditionVariableData() = default;
 
-    posix::Semaphore m_semaphore =
-        std::move(posix::Semaphore::create(posix::CreateUnnamedSharedMemorySemaphore, 0u)
-                      .or_else([](posix::SemaphoreError&) {
-                          errorHandler(Error::kPOPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE,
-                                       nullptr,
-                                       ErrorLevel::FATAL);
-                      })
-                      .value());
+    posix::Semaphore m_semaphore;
 
     RuntimeName_t m_runtimeName;
     std::atomic_bool m_toBeDestroyed{false};
     std::atomic_bool m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE];
+    /// @brief number of ConditionListeners which are about to block on or are blocked on m_semaphore; a
+    /// ConditionNotifier only posts the semaphore when this is not zero
+    std::atomic<uint64_t> m_numberOfSleepingWaiters{0U};
+
+  private:
+    static posix::Semaphore createSemaphore(const roudi::ProcessScope processScope) noexcept;
 };
 
 } // namespace popo
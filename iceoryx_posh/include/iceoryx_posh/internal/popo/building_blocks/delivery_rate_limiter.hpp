@@ -0,0 +1,66 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DELIVERY_RATE_LIMITER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DELIVERY_RATE_LIMITER_HPP
+
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Downsamples the chunks which are pushed into a chunk queue. It is located in the chunk queue and decided by
+/// the pushers, i.e. the chunks which are not due are never pushed and cost the publisher no further work. With
+/// multiple pushers the limits apply to the combined stream of chunks.
+class DeliveryRateLimiter
+{
+  public:
+    DeliveryRateLimiter() noexcept = default;
+
+    DeliveryRateLimiter(const DeliveryRateLimiter&) = delete;
+    DeliveryRateLimiter(DeliveryRateLimiter&&) = delete;
+    DeliveryRateLimiter& operator=(const DeliveryRateLimiter&) = delete;
+    DeliveryRateLimiter& operator=(DeliveryRateLimiter&&) = delete;
+    ~DeliveryRateLimiter() noexcept = default;
+
+    /// @brief Sets the limits, must be called before the first pusher uses the limiter
+    /// @param[in] deliverEveryNthChunk only the first of every n chunks is delivered; 0 and 1 disable the decimation
+    /// @param[in] minDeliveryInterval at most one chunk per interval is delivered; zero disables the limit
+    void setLimits(const uint64_t deliverEveryNthChunk, const units::Duration minDeliveryInterval) noexcept;
+
+    /// @brief checks whether any limit is set
+    /// @return true if chunks are dropped by the limiter
+    bool isEnabled() const noexcept;
+
+    /// @brief Decides whether the next chunk is delivered; every call counts as one offered chunk
+    /// @return true if the chunk shall be delivered, false if it shall be dropped
+    bool isNextChunkDue() noexcept;
+
+  private:
+    uint64_t m_deliverEveryNthChunk{1U};
+    int64_t m_minDeliveryIntervalNs{0};
+    std::atomic<uint64_t> m_numberOfOfferedChunks{0U};
+    std::atomic<int64_t> m_nextDeliveryTimeNs{0};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DELIVERY_RATE_LIMITER_HPP
@@ -0,0 +1,50 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_DATA_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_DATA_HPP
+
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The latest chunk of a single writer which can be read by any number of readers without a queue. The chunk
+/// is stored in one of several slots; a reader registers at the current slot while it clones the chunk and the
+/// writer only reuses slots without registered readers.
+struct LatestValueData
+{
+    /// @brief one slot is the current one, the others are free for the next value or still used by slow readers
+    static constexpr uint32_t NUMBER_OF_SLOTS{4U};
+
+    struct Slot
+    {
+        mepoo::ShmSafeUnmanagedChunk m_chunk;
+        std::atomic<uint64_t> m_numberOfReaders{0U};
+    };
+
+    Slot m_slots[NUMBER_OF_SLOTS];
+    std::atomic<uint32_t> m_currentSlot{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_DATA_HPP
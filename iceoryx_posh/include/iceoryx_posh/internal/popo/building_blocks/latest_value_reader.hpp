@@ -0,0 +1,60 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_READER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_READER_HPP
+
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_data.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The LatestValueReader provides the latest chunk of a LatestValueData. In contrast to a ChunkReceiver
+/// there is no queue, no bookkeeping of the chunks in use and no notification; any number of readers can peek
+/// concurrently.
+class LatestValueReader
+{
+  public:
+    using MemberType_t = LatestValueData;
+
+    explicit LatestValueReader(cxx::not_null<MemberType_t* const> latestValueDataPtr) noexcept;
+
+    LatestValueReader(const LatestValueReader& other) = delete;
+    LatestValueReader& operator=(const LatestValueReader&) = delete;
+    LatestValueReader(LatestValueReader&& rhs) = delete;
+    LatestValueReader& operator=(LatestValueReader&& rhs) = delete;
+    ~LatestValueReader() noexcept = default;
+
+    /// @brief Acquires a reference to the latest value; the chunk stays valid as long as the returned SharedChunk
+    /// exists even if the writer replaces the value in the meantime
+    /// @return the latest chunk or an empty SharedChunk if there is no value
+    mepoo::SharedChunk peek() noexcept;
+
+  protected:
+    const MemberType_t* getMembers() const noexcept;
+    MemberType_t* getMembers() noexcept;
+
+  private:
+    MemberType_t* m_latestValueDataPtr;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_READER_HPP
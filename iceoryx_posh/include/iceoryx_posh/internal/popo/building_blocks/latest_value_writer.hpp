@@ -0,0 +1,66 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_WRITER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_WRITER_HPP
+
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_data.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The LatestValueWriter replaces the chunk of a LatestValueData. Replacing the value does not depend on the
+/// number of readers. There must be only one writer per LatestValueData at a time.
+class LatestValueWriter
+{
+  public:
+    using MemberType_t = LatestValueData;
+
+    explicit LatestValueWriter(cxx::not_null<MemberType_t* const> latestValueDataPtr) noexcept;
+
+    LatestValueWriter(const LatestValueWriter& other) = delete;
+    LatestValueWriter& operator=(const LatestValueWriter&) = delete;
+    LatestValueWriter(LatestValueWriter&& rhs) = delete;
+    LatestValueWriter& operator=(LatestValueWriter&& rhs) = delete;
+    ~LatestValueWriter() noexcept = default;
+
+    /// @brief Makes a chunk the latest value; the LatestValueData holds a reference to the chunk until it is
+    /// replaced and the readers of the previous value are done
+    /// @param[in] chunk the new latest value, an empty SharedChunk clears the latest value
+    /// @return false if every other slot is still used by a reader, the latest value is then unchanged
+    bool update(const mepoo::SharedChunk& chunk) noexcept;
+
+    /// @brief Clears the latest value and releases all chunks which are not used by a reader; the chunk of a slot
+    /// whose reader died while it cloned the chunk is never released
+    void releaseAll() noexcept;
+
+  protected:
+    const MemberType_t* getMembers() const noexcept;
+    MemberType_t* getMembers() noexcept;
+
+  private:
+    void releaseUnusedChunks() noexcept;
+
+    MemberType_t* m_latestValueDataPtr;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_WRITER_HPP
@@ -45,6 +45,14 @@ class ApplicationPort : public BasePort
     /// @param[in] caProMessage
     void dispatchCaProMessage(const capro::CaproMessage& caProMessage) noexcept;
 
+    /// @brief signals the liveliness of the application to RouDi by storing the current time in the shared memory
+    void sendHeartbeat() noexcept;
+
+    /// @brief get the time of the last heartbeat of the application
+    /// @return the point in time of the last call to sendHeartbeat or the creation time of the port if there was
+    /// no heartbeat so far
+    mepoo::TimePointNs_t getLastHeartbeat() const noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
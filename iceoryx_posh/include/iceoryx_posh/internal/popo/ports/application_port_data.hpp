@@ -21,6 +21,8 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port_data.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 namespace popo
@@ -31,6 +33,10 @@ struct ApplicationPortData : public BasePortData
     explicit ApplicationPortData(const RuntimeName_t& runtimeName) noexcept;
 
     concurrent::FiFo<capro::CaproMessage, MAX_APPLICATION_CAPRO_FIFO_SIZE> m_caproMessageFiFo;
+    /// @brief the time since epoch of mepoo::BaseClock_t in nanoseconds when the runtime signaled its liveliness the
+    /// last time; RouDi reads it directly from the shared memory to monitor the process
+    std::atomic<mepoo::DurationNs_t::rep> m_heartbeat{
+        mepoo::DurationNs_t(mepoo::BaseClock_t::now().time_since_epoch()).count()};
 };
 
 } // namespace popo
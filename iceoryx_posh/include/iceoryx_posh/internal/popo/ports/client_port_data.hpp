@@ -44,6 +44,11 @@ struct ClientPortData : public BasePortData
     ClientChunkReceiverData_t m_chunkReceiverData;
     std::atomic_bool m_connectRequested{false};
     std::atomic<ConnectionState> m_connectionState{ConnectionState::NOT_CONNECTED};
+    /// @brief sequence number of the next request; only accessed from the user side
+    int64_t m_sequenceNumber{0};
+    /// @brief index of the response queue in the server, taken from the last response; only accessed from the user
+    /// side
+    uint32_t m_lastKnownClientQueueIndex{RPCBaseHeader::UNKNOWN_CLIENT_QUEUE_INDEX};
 };
 
 } // namespace popo
@@ -59,6 +59,8 @@ class ClientPortRouDi : public BasePort
     void releaseAllChunks() noexcept;
 
   private:
+    capro::CaproMessage createConnectMessage(const capro::CaproMessageType type) noexcept;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
@@ -50,18 +50,22 @@ class ClientPortUser : public BasePort
     ~ClientPortUser() = default;
 
     /// @brief Allocate a chunk, the ownerhip of the SharedChunk remains in the ClientPortUser for being able to
-    /// cleanup if the user process disappears
+    /// cleanup if the user process disappears. The RequestHeader is placed in the user-header of the chunk and gets
+    /// the next sequence number of this client
     /// @param[in] userPayloadSize, size of the user-paylaod without additional headers
-    /// @return on success pointer to a ChunkHeader which can be used to access the chunk-header, user-header and
+    /// @param[in] userPayloadAlignment, alignment of the user-payload
+    /// @return on success pointer to a RequestHeader which can be used to access the chunk-header and the
     /// user-payload fields, error if not
-    cxx::expected<RequestHeader*, AllocationError> allocateRequest(const uint32_t userPayloadSize) noexcept;
+    cxx::expected<RequestHeader*, AllocationError> allocateRequest(const uint32_t userPayloadSize,
+                                                                   const uint32_t userPayloadAlignment) noexcept;
 
     /// @brief Free an allocated request without sending it
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to free
+    /// @param[in] requestHeader, pointer to the RequestHeader to free
     void freeRequest(RequestHeader* const requestHeader) noexcept;
 
-    /// @brief Send an allocated request chunk to the server port
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to send
+    /// @brief Send an allocated request chunk to the server port. Without a connection to a server the request is
+    /// discarded
+    /// @param[in] requestHeader, pointer to the RequestHeader to send
     void sendRequest(RequestHeader* const requestHeader) noexcept;
 
     /// @brief try to connect to the server Caution: There can be delays between calling connect and a change
@@ -88,8 +92,8 @@ class ClientPortUser : public BasePort
     /// ChunkReceiveResult on error
     cxx::expected<cxx::optional<const ResponseHeader*>, ChunkReceiveResult> getResponse() noexcept;
 
-    /// @brief Release a response that was obtained with getResponseChunk
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to release
+    /// @brief Release a response that was obtained with getResponse
+    /// @param[in] responseHeader, pointer to the ResponseHeader to release
     void releaseResponse(const ResponseHeader* const responseHeader) noexcept;
 
     /// @brief check if there are responses in the queue
@@ -121,4 +125,4 @@ class ClientPortUser : public BasePort
 } // namespace popo
 } // namespace iox
 
-#endif // IOX_POSH_POPO_PORTS_PUBLISHER_PORT_USER_HPP
+#endif // IOX_POSH_POPO_PORTS_CLIENT_PORT_USER_HPP
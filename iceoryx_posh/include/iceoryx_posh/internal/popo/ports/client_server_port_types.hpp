@@ -21,8 +21,10 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
 
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
@@ -68,11 +70,24 @@ using ClientChunkSenderData_t = ChunkSenderData<MAX_REQUESTS_ALLOCATED_SIMULTANE
 
 using ServerChunkSenderData_t = ChunkSenderData<MAX_RESPONSES_ALLOCATED_SIMULTANEOUSLY, ServerChunkDistributorData_t>;
 
+/// @brief Common part of the user-header of request and response chunks. It is placed in the user-header of the chunk
+/// and carries the information which is needed to route a response back to the requesting client. Besides the unique
+/// id of the client queue it carries the index of this queue in the server, which makes the routing of a response
+/// O(1) in the number of clients; the client learns the index from the responses and passes it with the next request
 class RPCBaseHeader
 {
   public:
-    explicit RPCBaseHeader(cxx::not_null<ClientChunkQueueData_t* const> chunkQueueDataPtr, const int64_t sequenceNumber)
+    using UniqueClientQueueId_t = ClientChunkQueueData_t::UniqueId_t;
+
+    static constexpr uint32_t UNKNOWN_CLIENT_QUEUE_INDEX{std::numeric_limits<uint32_t>::max()};
+
+    RPCBaseHeader(cxx::not_null<ClientChunkQueueData_t* const> chunkQueueDataPtr,
+                  const UniqueClientQueueId_t uniqueClientQueueId,
+                  const uint32_t lastKnownClientQueueIndex,
+                  const int64_t sequenceNumber) noexcept
         : m_clientQueueDataPtr(chunkQueueDataPtr)
+        , m_uniqueClientQueueId(uniqueClientQueueId)
+        , m_lastKnownClientQueueIndex(lastKnownClientQueueIndex)
         , m_sequenceNumber(sequenceNumber)
     {
     }
@@ -88,16 +103,60 @@ class RPCBaseHeader
         return m_sequenceNumber;
     }
 
+    /// @brief Returns the response queue of the client which issued the request
+    ClientChunkQueueData_t* getClientQueueData() const noexcept
+    {
+        return m_clientQueueDataPtr.get();
+    }
+
+    /// @brief Returns the unique id of the response queue of the client which issued the request
+    UniqueClientQueueId_t getUniqueClientQueueId() const noexcept
+    {
+        return m_uniqueClientQueueId;
+    }
+
+    /// @brief Returns the index of the client queue in the server when it was looked up the last time
+    uint32_t getLastKnownClientQueueIndex() const noexcept
+    {
+        return m_lastKnownClientQueueIndex;
+    }
+
+    mepoo::ChunkHeader* getChunkHeader() noexcept
+    {
+        return mepoo::ChunkHeader::fromUserHeader(this);
+    }
+
+    const mepoo::ChunkHeader* getChunkHeader() const noexcept
+    {
+        return mepoo::ChunkHeader::fromUserHeader(this);
+    }
+
+    void* getUserPayload() noexcept
+    {
+        return getChunkHeader()->userPayload();
+    }
+
+    const void* getUserPayload() const noexcept
+    {
+        return getChunkHeader()->userPayload();
+    }
+
   protected:
     rp::RelativePointer<ClientChunkQueueData_t> m_clientQueueDataPtr;
+    UniqueClientQueueId_t m_uniqueClientQueueId;
+    uint32_t m_lastKnownClientQueueIndex{UNKNOWN_CLIENT_QUEUE_INDEX};
     int64_t m_sequenceNumber{0};
 };
 
 class RequestHeader : public RPCBaseHeader
 {
   public:
-    explicit RequestHeader(cxx::not_null<ClientChunkQueueData_t* const> chunkQueueDataPtr) noexcept
-        : RPCBaseHeader(chunkQueueDataPtr, 0)
+    RequestHeader(cxx::not_null<ClientChunkQueueData_t* const> chunkQueueDataPtr,
+                  const uint32_t lastKnownClientQueueIndex) noexcept
+        : RPCBaseHeader(chunkQueueDataPtr,
+                        static_cast<ClientChunkQueueData_t*>(chunkQueueDataPtr)->m_uniqueId,
+                        lastKnownClientQueueIndex,
+                        0)
     {
     }
 
@@ -117,15 +176,9 @@ class RequestHeader : public RPCBaseHeader
         m_isFireAndForget = fireAndForget;
     }
 
-    mepoo::ChunkHeader* getChunkHeader() const noexcept
-    {
-        /// todo
-        return nullptr;
-    }
-    void* getUserPayload() noexcept
+    bool isFireAndForget() const noexcept
     {
-        /// todo
-        return nullptr;
+        return m_isFireAndForget;
     }
 
   private:
@@ -136,8 +189,10 @@ class ResponseHeader : public RPCBaseHeader
 {
   public:
     ResponseHeader(cxx::not_null<ClientChunkQueueData_t* const> chunkQueueDataPtr,
+                   const UniqueClientQueueId_t uniqueClientQueueId,
+                   const uint32_t lastKnownClientQueueIndex,
                    const int64_t sequenceNumber) noexcept
-        : RPCBaseHeader(chunkQueueDataPtr, sequenceNumber)
+        : RPCBaseHeader(chunkQueueDataPtr, uniqueClientQueueId, lastKnownClientQueueIndex, sequenceNumber)
     {
     }
 
@@ -157,17 +212,6 @@ class ResponseHeader : public RPCBaseHeader
         return m_hasServerError;
     }
 
-    const mepoo::ChunkHeader* getChunkHeader() const noexcept
-    {
-        /// todo
-        return nullptr;
-    }
-    const void* getUserPayload() const noexcept
-    {
-        /// todo
-        return nullptr;
-    }
-
   private:
     bool m_hasServerError{false};
 };
@@ -67,6 +67,9 @@ class PublisherPortRouDi : public BasePort
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+    cxx::optional<capro::CaproMessage>
+    dispatchLatestValueSubscription(const capro::CaproMessage& caProMessage) noexcept;
+
     ChunkSender<PublisherPortData::ChunkSenderData_t> m_chunkSender;
 };
 
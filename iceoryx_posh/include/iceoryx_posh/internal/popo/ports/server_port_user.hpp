@@ -56,7 +56,7 @@ class ServerPortUser : public BasePort
     cxx::expected<cxx::optional<const RequestHeader*>, ChunkReceiveResult> getRequest() noexcept;
 
     /// @brief Release a request that was obtained with getRequest
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to release
+    /// @param[in] requestHeader, pointer to the RequestHeader to release
     void releaseRequest(const RequestHeader* const requestHeader) noexcept;
 
     /// @brief check if there are requests in the queue
@@ -68,19 +68,26 @@ class ServerPortUser : public BasePort
     bool hasLostRequestsSinceLastCall() noexcept;
 
     /// @brief Allocate a response, the ownerhip of the SharedChunk remains in the ServerPortUser for being able to
-    /// cleanup if the user process disappears
+    /// cleanup if the user process disappears. The ResponseHeader is placed in the user-header of the chunk and
+    /// addresses the client and the sequence number of the provided request
+    /// @param[in] requestHeader, the request which shall be answered
     /// @param[in] userPayloadSize, size of the user user-paylaod without additional headers
-    /// @return on success pointer to a ChunkHeader which can be used to access the chunk-header, user-header and
+    /// @param[in] userPayloadAlignment, alignment of the user-payload
+    /// @return on success pointer to a ResponseHeader which can be used to access the chunk-header and the
     /// user-payload fields, error if not
-    cxx::expected<ResponseHeader*, AllocationError> allocateResponse(const uint32_t userPayloadSize) noexcept;
+    cxx::expected<ResponseHeader*, AllocationError> allocateResponse(const RequestHeader* const requestHeader,
+                                                                     const uint32_t userPayloadSize,
+                                                                     const uint32_t userPayloadAlignment) noexcept;
 
     /// @brief Free an allocated response without sending it
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to free
+    /// @param[in] responseHeader, pointer to the ResponseHeader to free
     void freeResponse(ResponseHeader* const responseHeader) noexcept;
 
-    /// @brief Send an allocated request chunk to the server port
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to send
-    void sendResponse(ResponseHeader* const responseHeader) noexcept;
+    /// @brief Send an allocated response chunk only to the client which issued the request
+    /// @param[in] responseHeader, pointer to the ResponseHeader to send
+    /// @return true if the response was delivered, false if the client is not connected anymore and the response was
+    /// discarded
+    bool sendResponse(ResponseHeader* const responseHeader) noexcept;
 
     /// @brief offer this server port in the system
     void offer() noexcept;
@@ -118,4 +125,4 @@ class ServerPortUser : public BasePort
 } // namespace popo
 } // namespace iox
 
-#endif // IOX_POSH_POPO_PORTS_PUBLISHER_PORT_USER_HPP
+#endif // IOX_POSH_POPO_PORTS_SERVER_PORT_USER_HPP
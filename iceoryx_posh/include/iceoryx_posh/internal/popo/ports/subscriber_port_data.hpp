@@ -19,9 +19,11 @@
 #define IOX_POSH_POPO_PORTS_SUBSCRIBER_PORT_DATA_HPP
 
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
+#include "iceoryx_hoofs/internal/relocatable_pointer/atomic_relocatable_pointer.hpp"
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port_data.hpp"
 
@@ -48,6 +50,12 @@ struct SubscriberPortData : public BasePortData
     const uint64_t m_historyRequest;
     std::atomic_bool m_subscribeRequested{false};
     std::atomic<SubscribeState> m_subscriptionState{SubscribeState::NOT_SUBSCRIBED};
+    const bool m_isLatestValueOnly;
+    /// @brief the latest value of the publisher which acknowledged the subscription if m_isLatestValueOnly is set
+    rp::AtomicRelocatablePointer<LatestValueData> m_latestValue;
+    /// @brief number of peeks of m_latestValue in progress; the LatestValueData is part of the publisher port,
+    /// therefore RouDi keeps a destroyed publisher port until the subscribers which could still use it are done
+    std::atomic<uint64_t> m_numberOfLatestValuePeeks{0U};
 };
 
 } // namespace popo
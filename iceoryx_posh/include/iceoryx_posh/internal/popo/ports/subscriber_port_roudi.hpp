@@ -63,10 +63,28 @@ class SubscriberPortRouDi : public BasePort
     /// Caution: Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
+    /// @brief Checks whether the user side currently peeks a latest value; a latest value which was disconnected
+    /// before this call is no longer used once this returns false
+    /// @return true if a peek is in progress, otherwise false
+    bool isPeekingLatestValue() const noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+    /// @brief Creates a SUB or UNSUB message for this subscriber; subscribers which only read the latest value use
+    /// the FIELD sub type
+    /// @param[in] type of the message
+    /// @return the CaPro message
+    capro::CaproMessage createSubscriptionMessage(const capro::CaproMessageType type) noexcept;
+
+    /// @brief Stores the latest value which a publisher hands out with the ACK to a FIELD subscription
+    /// @param[in] caProMessage the ACK of the publisher
+    void connectLatestValue(const capro::CaproMessage& caProMessage) noexcept;
+
+    /// @brief Forgets the latest value; further peeks return no value until a publisher acknowledges a subscription
+    void disconnectLatestValue() noexcept;
+
     ChunkReceiver<SubscriberPortData::ChunkReceiverData_t> m_chunkReceiver;
 };
 
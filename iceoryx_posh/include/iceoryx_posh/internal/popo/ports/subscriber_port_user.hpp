@@ -22,6 +22,7 @@
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
@@ -83,6 +84,12 @@ class SubscriberPortUser : public BasePort
     /// @return true if the underlying queue overflowed since last call of this method, otherwise false
     bool hasLostChunksSinceLastCall() noexcept;
 
+    /// @brief Acquires the latest chunk of the publisher this subscriber is connected to without using the queue. This
+    /// requires a subscriber with SubscriberOptions::latestValueOnly and a publisher with
+    /// PublisherOptions::provideLatestValue
+    /// @return the latest chunk or an empty SharedChunk if there is no publisher or no value yet
+    mepoo::SharedChunk peekLatestChunk() noexcept;
+
     /// @brief attach a condition variable (via its pointer) to subscriber
     void setConditionVariable(ConditionVariableData& conditionVariableData, const uint64_t notificationIndex) noexcept;
 
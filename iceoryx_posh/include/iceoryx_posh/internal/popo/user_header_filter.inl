@@ -0,0 +1,56 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_USER_HEADER_FILTER_INL
+#define IOX_POSH_POPO_USER_HEADER_FILTER_INL
+
+#include <cstring>
+#include <type_traits>
+
+namespace iox
+{
+namespace popo
+{
+template <typename T>
+inline UserHeaderFilter UserHeaderFilter::fieldEquals(const uint32_t offset, const T& value) noexcept
+{
+    // all bits of the field are compared; the mask is created byte wise to be independent of the endianness
+    uint8_t mask[sizeof(T)];
+    std::memset(mask, 0xFF, sizeof(T));
+    T fieldMask;
+    std::memcpy(&fieldMask, mask, sizeof(T));
+    return fieldEquals(offset, value, fieldMask);
+}
+
+template <typename T>
+inline UserHeaderFilter UserHeaderFilter::fieldEquals(const uint32_t offset, const T& value, const T& mask) noexcept
+{
+    static_assert(std::is_trivially_copyable<T>::value, "The field type must be trivially copyable!");
+    static_assert(sizeof(T) <= MAX_FIELD_SIZE, "The field must not be larger than MAX_FIELD_SIZE!");
+
+    UserHeaderFilter filter;
+    filter.m_offset = offset;
+    filter.m_size = static_cast<uint32_t>(sizeof(T));
+    std::memcpy(&filter.m_value, &value, sizeof(T));
+    std::memcpy(&filter.m_mask, &mask, sizeof(T));
+    filter.m_value &= filter.m_mask;
+    return filter;
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_USER_HEADER_FILTER_INL
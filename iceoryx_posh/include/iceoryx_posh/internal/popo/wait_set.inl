@@ -23,14 +23,20 @@ namespace popo
 {
 template <uint64_t Capacity>
 inline WaitSet<Capacity>::WaitSet() noexcept
-    : WaitSet(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable())
+    : WaitSet(WaitOptions())
 {
 }
 
 template <uint64_t Capacity>
-inline WaitSet<Capacity>::WaitSet(ConditionVariableData& condVarData) noexcept
+inline WaitSet<Capacity>::WaitSet(const WaitOptions& waitOptions) noexcept
+    : WaitSet(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), waitOptions)
+{
+}
+
+template <uint64_t Capacity>
+inline WaitSet<Capacity>::WaitSet(ConditionVariableData& condVarData, const WaitOptions& waitOptions) noexcept
     : m_conditionVariableDataPtr(&condVarData)
-    , m_conditionListener(condVarData)
+    , m_conditionListener(condVarData, waitOptions)
 {
     for (uint64_t i = 0U; i < Capacity; ++i)
     {
@@ -17,7 +17,7 @@
 #define IOX_POSH_ROUDI_INTROSPECTION_MEMPOOL_INTROSPECTION_HPP
 
 #include "iceoryx_hoofs/cxx/method_callback.hpp"
-#include "iceoryx_hoofs/internal/concurrent/periodic_task.hpp"
+#include "iceoryx_hoofs/internal/concurrent/timing_wheel_task.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
@@ -87,8 +87,8 @@ class MemPoolIntrospection
 
   private:
     units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
-    concurrent::PeriodicTask<cxx::MethodCallback<void>> m_publishingTask{
-        concurrent::PeriodicTaskManualStart, "MemPoolIntr", *this, &MemPoolIntrospection::send};
+    concurrent::TimingWheelTask<cxx::MethodCallback<void>> m_publishingTask{
+        concurrent::TimingWheel::sharedInstance(), *this, &MemPoolIntrospection::send};
 };
 
 /// @brief typedef for the templated mempool introspection class that is used by RouDi for the
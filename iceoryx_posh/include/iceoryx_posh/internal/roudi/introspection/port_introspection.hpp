@@ -20,7 +20,7 @@
 #include "fixed_size_container.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/method_callback.hpp"
-#include "iceoryx_hoofs/internal/concurrent/periodic_task.hpp"
+#include "iceoryx_hoofs/internal/concurrent/timing_wheel_task.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
@@ -321,8 +321,8 @@ class PortIntrospection
     PortData m_portData;
 
     units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
-    concurrent::PeriodicTask<cxx::MethodCallback<void>> m_publishingTask{
-        concurrent::PeriodicTaskManualStart, "PortIntr", *this, &PortIntrospection::send};
+    concurrent::TimingWheelTask<cxx::MethodCallback<void>> m_publishingTask{
+        concurrent::TimingWheel::sharedInstance(), *this, &PortIntrospection::send};
 };
 
 /// @brief typedef for the templated port introspection class that is used by RouDi for the
@@ -19,7 +19,7 @@
 
 #include "iceoryx_hoofs/cxx/list.hpp"
 #include "iceoryx_hoofs/cxx/method_callback.hpp"
-#include "iceoryx_hoofs/internal/concurrent/periodic_task.hpp"
+#include "iceoryx_hoofs/internal/concurrent/timing_wheel_task.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
@@ -101,8 +101,8 @@ class ProcessIntrospection
     std::mutex m_mutex;
 
     units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
-    concurrent::PeriodicTask<cxx::MethodCallback<void>> m_publishingTask{
-        concurrent::PeriodicTaskManualStart, "ProcessIntr", *this, &ProcessIntrospection::send};
+    concurrent::TimingWheelTask<cxx::MethodCallback<void>> m_publishingTask{
+        concurrent::TimingWheel::sharedInstance(), *this, &ProcessIntrospection::send};
 };
 
 /// @brief typedef for the templated process introspection class that is used by RouDi for the
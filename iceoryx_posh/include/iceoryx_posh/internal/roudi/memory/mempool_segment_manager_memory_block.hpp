@@ -33,7 +33,8 @@ namespace roudi
 class MemPoolSegmentManagerMemoryBlock : public MemoryBlock
 {
   public:
-    MemPoolSegmentManagerMemoryBlock(const mepoo::SegmentConfig& segmentConfig) noexcept;
+    MemPoolSegmentManagerMemoryBlock(const mepoo::SegmentConfig& segmentConfig,
+                                     const ProcessScope processScope = ProcessScope::MULTI_PROCESS) noexcept;
     ~MemPoolSegmentManagerMemoryBlock() noexcept;
 
     MemPoolSegmentManagerMemoryBlock(const MemPoolSegmentManagerMemoryBlock&) = delete;
@@ -65,6 +66,7 @@ class MemPoolSegmentManagerMemoryBlock : public MemoryBlock
   private:
     mepoo::SegmentManager<>* m_segmentManager{nullptr};
     mepoo::SegmentConfig m_segmentConfig;
+    ProcessScope m_processScope;
 };
 
 } // namespace roudi
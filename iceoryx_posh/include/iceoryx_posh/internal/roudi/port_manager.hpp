@@ -19,6 +19,7 @@
 
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/type_traits.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/iceoryx_posh_config.hpp"
@@ -108,6 +109,19 @@ class PortManager
 
     void destroySubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
 
+    /// @brief Checks whether a subscriber could still use the latest value of a publisher port
+    /// @param[in] publisherPortData of the stopped publisher
+    /// @return true if a subscriber of the same service peeks a latest value, otherwise false
+    bool hasSubscribersPeekingLatestValue(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept;
+
+    /// @brief Removes the destroyed publisher ports whose latest value is no longer peeked by any subscriber
+    void removePublisherPortsWithoutPeekingSubscribers() noexcept;
+
+    /// @brief Checks whether a publisher port was destroyed but is kept for a peeking subscriber
+    /// @param[in] portData of the publisher
+    /// @return true if the port waits for its removal, otherwise false
+    bool isPublisherPortPendingRemoval(const PublisherPortRouDiType::MemberType_t* const portData) const noexcept;
+
     void handlePublisherPorts() noexcept;
 
     void doDiscoveryForPublisherPort(PublisherPortRouDiType& publisherPort) noexcept;
@@ -148,6 +162,8 @@ class PortManager
     PortPool* m_portPool{nullptr};
     ServiceRegistry m_serviceRegistry;
     PortIntrospectionType m_portIntrospection;
+    /// @brief destroyed publisher ports which stay in the port pool until no subscriber peeks their latest value
+    cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS> m_publisherPortsPendingRemoval;
 };
 } // namespace roudi
 } // namespace iox
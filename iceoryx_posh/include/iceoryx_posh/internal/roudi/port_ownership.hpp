@@ -0,0 +1,112 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_PORT_OWNERSHIP_HPP
+#define IOX_POSH_ROUDI_PORT_OWNERSHIP_HPP
+
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/roudi/runtime_name_index.hpp"
+
+#include <cstdint>
+#include <limits>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief every registered process and RouDi itself can own ports
+constexpr uint32_t MAX_PORT_OWNERS{MAX_PROCESS_NUMBER + 1U};
+
+/// @brief Assigns a small id to every runtime which owns ports. The ids are used as index for the heads of the
+///        PortOwnershipLists and are reference counted, i.e. an id is released when the last port of the runtime is
+///        removed.
+class PortOwnerRegistry
+{
+  public:
+    using owner_t = uint32_t;
+    /// @brief owner of the ports of runtimes which got no id since all ids were in use
+    static constexpr owner_t UNTRACKED_OWNER{MAX_PORT_OWNERS};
+
+    PortOwnerRegistry() noexcept;
+
+    /// @brief Acquires a reference to the id of a runtime; a new id is assigned if the runtime has no ports yet
+    /// @param[in] runtimeName of the runtime which owns a new port
+    /// @return the id of the runtime or UNTRACKED_OWNER if all ids are in use
+    owner_t acquire(const RuntimeName_t& runtimeName) noexcept;
+
+    /// @brief Releases a reference to an owner id which was acquired with acquire
+    /// @param[in] owner id of the runtime which removed a port
+    void release(const owner_t owner) noexcept;
+
+    /// @brief Looks up the id of a runtime
+    /// @param[in] runtimeName of the runtime
+    /// @return the id of the runtime or nullopt if the runtime owns no tracked ports
+    cxx::optional<owner_t> find(const RuntimeName_t& runtimeName) const noexcept;
+
+  private:
+    RuntimeNameIndex<owner_t, MAX_PORT_OWNERS> m_ownerIndex;
+    cxx::vector<owner_t, MAX_PORT_OWNERS> m_freeOwners;
+    RuntimeName_t m_ownerNames[MAX_PORT_OWNERS];
+    uint64_t m_numberOfReferences[MAX_PORT_OWNERS];
+};
+
+/// @brief Links the slots of a FixedPositionContainer to one intrusive doubly linked list per owner, therefore adding
+///        and removing a slot is O(1) and the slots of one owner can be visited in insertion order without touching
+///        the slots of the other owners.
+/// @tparam NumberOfSlots capacity of the FixedPositionContainer
+template <uint64_t NumberOfSlots>
+class PortOwnershipList
+{
+  public:
+    using index_t = uint32_t;
+    using owner_t = PortOwnerRegistry::owner_t;
+    static constexpr index_t INVALID_INDEX{std::numeric_limits<index_t>::max()};
+    static constexpr owner_t NO_OWNER{std::numeric_limits<owner_t>::max()};
+
+    PortOwnershipList() noexcept;
+
+    /// @brief Assigns a slot to an owner
+    /// @param[in] owner id of the runtime which owns the slot, may be PortOwnerRegistry::UNTRACKED_OWNER
+    /// @param[in] slot index of the slot in the FixedPositionContainer
+    void add(const owner_t owner, const index_t slot) noexcept;
+
+    /// @brief Removes the assignment of a slot
+    /// @param[in] slot index of the slot in the FixedPositionContainer
+    /// @return the owner of the slot or NO_OWNER if the slot was not assigned
+    owner_t remove(const index_t slot) noexcept;
+
+    /// @brief Calls the callable with the index of every slot of the owner
+    /// @param[in] owner id of the runtime
+    /// @param[in] callable which is called with the index of the slot
+    template <typename Callable>
+    void forEachSlotOf(const owner_t owner, const Callable& callable) const noexcept;
+
+  private:
+    static constexpr uint64_t NUMBER_OF_OWNERS{MAX_PORT_OWNERS + 1U};
+
+    index_t m_head[NUMBER_OF_OWNERS];
+    index_t m_tail[NUMBER_OF_OWNERS];
+    owner_t m_owner[NumberOfSlots];
+    index_t m_next[NumberOfSlots];
+    index_t m_previous[NumberOfSlots];
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/port_ownership.inl"
+
+#endif // IOX_POSH_ROUDI_PORT_OWNERSHIP_HPP
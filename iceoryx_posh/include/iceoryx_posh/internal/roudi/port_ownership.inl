@@ -0,0 +1,117 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_PORT_OWNERSHIP_INL
+#define IOX_POSH_ROUDI_PORT_OWNERSHIP_INL
+
+namespace iox
+{
+namespace roudi
+{
+template <uint64_t NumberOfSlots>
+constexpr typename PortOwnershipList<NumberOfSlots>::index_t PortOwnershipList<NumberOfSlots>::INVALID_INDEX;
+template <uint64_t NumberOfSlots>
+constexpr typename PortOwnershipList<NumberOfSlots>::owner_t PortOwnershipList<NumberOfSlots>::NO_OWNER;
+
+template <uint64_t NumberOfSlots>
+PortOwnershipList<NumberOfSlots>::PortOwnershipList() noexcept
+{
+    for (uint64_t i = 0U; i < NUMBER_OF_OWNERS; ++i)
+    {
+        m_head[i] = INVALID_INDEX;
+        m_tail[i] = INVALID_INDEX;
+    }
+    for (uint64_t i = 0U; i < NumberOfSlots; ++i)
+    {
+        m_owner[i] = NO_OWNER;
+        m_next[i] = INVALID_INDEX;
+        m_previous[i] = INVALID_INDEX;
+    }
+}
+
+template <uint64_t NumberOfSlots>
+void PortOwnershipList<NumberOfSlots>::add(const owner_t owner, const index_t slot) noexcept
+{
+    if (owner >= NUMBER_OF_OWNERS || slot >= NumberOfSlots || m_owner[slot] != NO_OWNER)
+    {
+        return;
+    }
+
+    m_owner[slot] = owner;
+    m_previous[slot] = m_tail[owner];
+    m_next[slot] = INVALID_INDEX;
+    if (m_tail[owner] != INVALID_INDEX)
+    {
+        m_next[m_tail[owner]] = slot;
+    }
+    else
+    {
+        m_head[owner] = slot;
+    }
+    m_tail[owner] = slot;
+}
+
+template <uint64_t NumberOfSlots>
+typename PortOwnershipList<NumberOfSlots>::owner_t
+PortOwnershipList<NumberOfSlots>::remove(const index_t slot) noexcept
+{
+    if (slot >= NumberOfSlots || m_owner[slot] == NO_OWNER)
+    {
+        return NO_OWNER;
+    }
+
+    const owner_t owner = m_owner[slot];
+    if (m_previous[slot] != INVALID_INDEX)
+    {
+        m_next[m_previous[slot]] = m_next[slot];
+    }
+    else
+    {
+        m_head[owner] = m_next[slot];
+    }
+    if (m_next[slot] != INVALID_INDEX)
+    {
+        m_previous[m_next[slot]] = m_previous[slot];
+    }
+    else
+    {
+        m_tail[owner] = m_previous[slot];
+    }
+
+    m_owner[slot] = NO_OWNER;
+    m_next[slot] = INVALID_INDEX;
+    m_previous[slot] = INVALID_INDEX;
+    return owner;
+}
+
+template <uint64_t NumberOfSlots>
+template <typename Callable>
+void PortOwnershipList<NumberOfSlots>::forEachSlotOf(const owner_t owner, const Callable& callable) const noexcept
+{
+    if (owner >= NUMBER_OF_OWNERS)
+    {
+        return;
+    }
+
+    for (index_t slot = m_head[owner]; slot != INVALID_INDEX; slot = m_next[slot])
+    {
+        callable(slot);
+    }
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_PORT_OWNERSHIP_INL
@@ -27,17 +27,31 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 
+#include <limits>
+#include <type_traits>
+
 namespace iox
 {
 namespace roudi
 {
-/// @brief workaround container until we have a fixed list with the needed functionality
+/// @brief Container with stable element addresses which is suitable to be placed in shared memory. Free and used
+///        slots are tracked with index lists, therefore insert and erase are O(1) and iterating over the content only
+///        touches the used slots, in insertion order. Every slot starts at a cache line, therefore the elements,
+///        e.g. the queues of unrelated ports, never share a cache line.
 template <typename T, uint64_t Capacity>
 class FixedPositionContainer
 {
   public:
     static constexpr uint64_t FIRST_ELEMENT = std::numeric_limits<uint64_t>::max();
 
+    FixedPositionContainer() noexcept;
+    ~FixedPositionContainer() noexcept;
+
+    FixedPositionContainer(const FixedPositionContainer&) = delete;
+    FixedPositionContainer(FixedPositionContainer&&) = delete;
+    FixedPositionContainer& operator=(const FixedPositionContainer&) = delete;
+    FixedPositionContainer& operator=(FixedPositionContainer&&) = delete;
+
     bool hasFreeSpace();
 
     template <typename... Targs>
@@ -47,8 +61,34 @@ class FixedPositionContainer
 
     cxx::vector<T*, Capacity> content();
 
+    uint64_t size() const noexcept;
+
+    using index_t = uint32_t;
+    static constexpr index_t INVALID_INDEX{std::numeric_limits<index_t>::max()};
+    static_assert(Capacity < INVALID_INDEX, "Capacity exceeds the range of the internal index type");
+
+    /// @brief Access to the element in a slot, the slot must be in use
+    /// @param[in] index of the slot
+    /// @return pointer to the element in the slot
+    T* elementAt(const index_t index) noexcept;
+
+    /// @brief Finds the slot of an element
+    /// @param[in] element which was returned by insert
+    /// @return the index of the slot or nullopt if the element is not in use in this container
+    cxx::optional<index_t> indexOf(const T* const element) const noexcept;
+
   private:
-    cxx::vector<cxx::optional<T>, Capacity> m_data;
+    static constexpr uint64_t SLOT_ALIGNMENT{alignof(T) > CACHE_LINE_SIZE ? alignof(T) : CACHE_LINE_SIZE};
+    using element_t = typename std::aligned_storage<sizeof(T), SLOT_ALIGNMENT>::type;
+    element_t m_data[Capacity];
+    /// @brief singly linked for the free list, doubly linked together with m_previous for the used list
+    index_t m_next[Capacity];
+    index_t m_previous[Capacity];
+    bool m_isUsed[Capacity];
+    index_t m_freeHead{0U};
+    index_t m_usedHead{INVALID_INDEX};
+    index_t m_usedTail{INVALID_INDEX};
+    uint64_t m_size{0U};
 };
 
 struct PortPoolData
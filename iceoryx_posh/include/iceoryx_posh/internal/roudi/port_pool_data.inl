@@ -21,69 +21,137 @@ namespace iox
 namespace roudi
 {
 template <typename T, uint64_t Capacity>
-bool FixedPositionContainer<T, Capacity>::hasFreeSpace()
+FixedPositionContainer<T, Capacity>::FixedPositionContainer() noexcept
 {
-    if (m_data.capacity() > m_data.size())
+    for (uint64_t i = 0U; i < Capacity; ++i)
     {
-        return true;
+        m_next[i] = (i + 1U < Capacity) ? static_cast<index_t>(i + 1U) : INVALID_INDEX;
+        m_previous[i] = INVALID_INDEX;
+        m_isUsed[i] = false;
     }
+}
 
-    for (auto& e : m_data)
+template <typename T, uint64_t Capacity>
+FixedPositionContainer<T, Capacity>::~FixedPositionContainer() noexcept
+{
+    for (index_t index = m_usedHead; index != INVALID_INDEX; index = m_next[index])
     {
-        if (!e.has_value())
-        {
-            return true;
-        }
+        elementAt(index)->~T();
     }
+}
 
-    return false;
+template <typename T, uint64_t Capacity>
+bool FixedPositionContainer<T, Capacity>::hasFreeSpace()
+{
+    return m_freeHead != INVALID_INDEX;
 }
 
 template <typename T, uint64_t Capacity>
 template <typename... Targs>
 T* FixedPositionContainer<T, Capacity>::insert(Targs&&... args)
 {
-    for (auto& e : m_data)
+    if (m_freeHead == INVALID_INDEX)
     {
-        if (!e.has_value())
-        {
-            e.emplace(std::forward<Targs>(args)...);
-            return &e.value();
-        }
+        return nullptr;
     }
 
-    m_data.emplace_back();
-    m_data.back().emplace(std::forward<Targs>(args)...);
-    return &m_data.back().value();
+    const index_t index = m_freeHead;
+    m_freeHead = m_next[index];
+
+    new (&m_data[index]) T(std::forward<Targs>(args)...);
+    m_isUsed[index] = true;
+
+    m_previous[index] = m_usedTail;
+    m_next[index] = INVALID_INDEX;
+    if (m_usedTail != INVALID_INDEX)
+    {
+        m_next[m_usedTail] = index;
+    }
+    else
+    {
+        m_usedHead = index;
+    }
+    m_usedTail = index;
+    ++m_size;
+
+    return elementAt(index);
 }
 
 template <typename T, uint64_t Capacity>
 void FixedPositionContainer<T, Capacity>::erase(T* const element)
 {
-    for (auto& e : m_data)
-    {
-        if (e.has_value() && &e.value() == element)
+    indexOf(element).and_then([&](const index_t index) {
+        elementAt(index)->~T();
+        m_isUsed[index] = false;
+
+        if (m_previous[index] != INVALID_INDEX)
         {
-            e.reset();
-            return;
+            m_next[m_previous[index]] = m_next[index];
         }
-    }
+        else
+        {
+            m_usedHead = m_next[index];
+        }
+
+        if (m_next[index] != INVALID_INDEX)
+        {
+            m_previous[m_next[index]] = m_previous[index];
+        }
+        else
+        {
+            m_usedTail = m_previous[index];
+        }
+
+        m_previous[index] = INVALID_INDEX;
+        m_next[index] = m_freeHead;
+        m_freeHead = index;
+        --m_size;
+    });
 }
 
 template <typename T, uint64_t Capacity>
 cxx::vector<T*, Capacity> FixedPositionContainer<T, Capacity>::content()
 {
     cxx::vector<T*, Capacity> returnValue;
-    for (auto& e : m_data)
+    for (index_t index = m_usedHead; index != INVALID_INDEX; index = m_next[index])
     {
-        if (e.has_value())
-        {
-            returnValue.emplace_back(&e.value());
-        }
+        returnValue.emplace_back(elementAt(index));
     }
     return returnValue;
 }
 
+template <typename T, uint64_t Capacity>
+uint64_t FixedPositionContainer<T, Capacity>::size() const noexcept
+{
+    return m_size;
+}
+
+template <typename T, uint64_t Capacity>
+T* FixedPositionContainer<T, Capacity>::elementAt(const index_t index) noexcept
+{
+    return reinterpret_cast<T*>(&m_data[index]);
+}
+
+template <typename T, uint64_t Capacity>
+cxx::optional<typename FixedPositionContainer<T, Capacity>::index_t>
+FixedPositionContainer<T, Capacity>::indexOf(const T* const element) const noexcept
+{
+    const auto address = reinterpret_cast<uintptr_t>(element);
+    const auto begin = reinterpret_cast<uintptr_t>(&m_data[0]);
+    if (address < begin || (address - begin) % sizeof(element_t) != 0U)
+    {
+        return cxx::nullopt;
+    }
+
+    const uint64_t index = (address - begin) / sizeof(element_t);
+    if (index >= Capacity || !m_isUsed[index])
+    {
+        return cxx::nullopt;
+    }
+
+    return static_cast<index_t>(index);
+}
+
 } // namespace roudi
 } // namespace iox
 
@@ -71,8 +71,14 @@ class Process
 
     void setTimestamp(const mepoo::TimePointNs_t timestamp) noexcept;
 
+    /// @brief The point in time when the process was alive the last time
+    /// @return the later one of the timestamp set with setTimestamp and the last heartbeat in the ApplicationPortData
     mepoo::TimePointNs_t getTimestamp() noexcept;
 
+    /// @brief Sets the ApplicationPortData which contains the heartbeat of the process
+    /// @param [in] applicationPortData of the process
+    void setApplicationPortData(popo::ApplicationPortData* const applicationPortData) noexcept;
+
     posix::PosixUser getUser() const noexcept;
 
     bool isMonitored() const noexcept;
@@ -81,6 +87,7 @@ class Process
     const uint32_t m_pid{0U};
     runtime::IpcInterfaceUser m_ipcChannel;
     mepoo::TimePointNs_t m_timestamp;
+    popo::ApplicationPortData* m_applicationPortData{nullptr};
     posix::PosixUser m_user;
     bool m_isMonitored{true};
     std::atomic<uint64_t> m_sessionId{0U};
@@ -24,6 +24,7 @@
 #include "iceoryx_posh/internal/roudi/introspection/process_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
 #include "iceoryx_posh/internal/roudi/process.hpp"
+#include "iceoryx_posh/internal/roudi/runtime_name_index.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
@@ -105,8 +106,6 @@ class ProcessManager : public ProcessManagerInterface
     /// @brief Tries to gracefully terminate all registered processes
     void requestShutdownOfAllProcesses() noexcept;
 
-    void updateLivelinessOfProcess(const RuntimeName_t& name) noexcept;
-
     void findServiceForProcess(const RuntimeName_t& name, const capro::ServiceDescription& service) noexcept;
 
     void
@@ -213,6 +212,9 @@ class ProcessManager : public ProcessManagerInterface
     mepoo::MemoryManager* m_introspectionMemoryManager{nullptr};
     rp::BaseRelativePointer::id_t m_mgmtSegmentId{rp::BaseRelativePointer::NULL_POINTER_ID};
     ProcessList_t m_processList;
+    /// @brief hashed lookup of the processes in m_processList; the iterators of the cxx::list stay valid until the
+    /// element is erased
+    RuntimeNameIndex<ProcessList_t::iterator, MAX_PROCESS_NUMBER> m_processIndex;
     ProcessIntrospectionType* m_processIntrospection{nullptr};
     version::CompatibilityCheckLevel m_compatibilityCheckLevel;
 };
@@ -34,6 +34,7 @@
 
 #include <cstdint>
 #include <cstdio>
+#include <mutex>
 #include <thread>
 
 namespace iox
@@ -127,6 +128,8 @@ class RouDi
   private:
     void processRuntimeMessages();
 
+    void processRuntimeMessage(const runtime::IpcMessage& message) noexcept;
+
     void monitorAndDiscoveryUpdate();
 
     cxx::GenericRAII m_unregisterRelativePtr{[] {}, [] { rp::BaseRelativePointer::unregisterAll(); }};
@@ -136,6 +139,10 @@ class RouDi
 
     const units::Duration m_runtimeMessagesThreadTimeout{100_ms};
 
+    // serializes the messages from the IPC channel and the ones from a PoshRuntimeSingleProcess in the same process
+    std::mutex m_runtimeMessageMutex;
+    bool m_isRequestHandlerRegistered{false};
+
   protected:
     RouDiMemoryInterface* m_roudiMemoryInterface{nullptr};
     /// @note destroy the memory right at the end of the dTor, since the memory is not needed anymore and we know that
@@ -0,0 +1,96 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_RUNTIME_NAME_INDEX_HPP
+#define IOX_POSH_ROUDI_RUNTIME_NAME_INDEX_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+namespace internal
+{
+/// @brief the smallest power of two which is greater than or equal to value
+constexpr uint64_t ceilToPowerOfTwo(const uint64_t value) noexcept
+{
+    return (value <= 1U) ? 1U : 2U * ceilToPowerOfTwo((value + 1U) / 2U);
+}
+} // namespace internal
+
+/// @brief Hash table with a fixed capacity which maps a runtime name to a value. It uses open addressing with linear
+///        probing and is never filled more than half, therefore insert, find and erase need on average only a few
+///        string compares, independent of the number of stored runtimes.
+/// @tparam T type of the value, must be copyable
+/// @tparam Capacity maximum number of stored runtime names
+template <typename T, uint64_t Capacity>
+class RuntimeNameIndex
+{
+  public:
+    RuntimeNameIndex() noexcept = default;
+
+    /// @brief Stores the value for the runtime name
+    /// @param[in] name of the runtime
+    /// @param[in] value which shall be found with the runtime name
+    /// @return false if there is already a value for this name or the capacity is exhausted, otherwise true
+    bool insert(const RuntimeName_t& name, const T& value) noexcept;
+
+    /// @brief Looks up the value of a runtime name
+    /// @param[in] name of the runtime
+    /// @return the value if the name is stored, otherwise nullopt
+    cxx::optional<T> find(const RuntimeName_t& name) const noexcept;
+
+    /// @brief Removes the value of a runtime name
+    /// @param[in] name of the runtime
+    /// @return true if the name was stored, otherwise false
+    bool erase(const RuntimeName_t& name) noexcept;
+
+    /// @brief Removes all values
+    void clear() noexcept;
+
+    /// @brief Returns the number of stored runtime names
+    uint64_t size() const noexcept;
+
+    /// @brief FNV-1a hash of the runtime name
+    static uint64_t hash(const RuntimeName_t& name) noexcept;
+
+  private:
+    // keeps the load factor at or below 0.5
+    static constexpr uint64_t NUMBER_OF_BUCKETS{internal::ceilToPowerOfTwo(2U * Capacity)};
+
+    struct Bucket
+    {
+        uint64_t hash{0U};
+        RuntimeName_t name;
+        cxx::optional<T> value;
+    };
+
+    cxx::optional<uint64_t> bucketOf(const RuntimeName_t& name, const uint64_t nameHash) const noexcept;
+    static uint64_t homeBucket(const uint64_t nameHash) noexcept;
+
+    Bucket m_buckets[NUMBER_OF_BUCKETS];
+    uint64_t m_size{0U};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/runtime_name_index.inl"
+
+#endif // IOX_POSH_ROUDI_RUNTIME_NAME_INDEX_HPP
@@ -0,0 +1,144 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_RUNTIME_NAME_INDEX_INL
+#define IOX_POSH_ROUDI_RUNTIME_NAME_INDEX_INL
+
+namespace iox
+{
+namespace roudi
+{
+template <typename T, uint64_t Capacity>
+constexpr uint64_t RuntimeNameIndex<T, Capacity>::NUMBER_OF_BUCKETS;
+
+template <typename T, uint64_t Capacity>
+uint64_t RuntimeNameIndex<T, Capacity>::hash(const RuntimeName_t& name) noexcept
+{
+    constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037U};
+    constexpr uint64_t FNV_PRIME{1099511628211U};
+
+    uint64_t nameHash{FNV_OFFSET_BASIS};
+    const char* const characters = name.c_str();
+    for (uint64_t i = 0U; i < name.size(); ++i)
+    {
+        nameHash ^= static_cast<uint64_t>(static_cast<uint8_t>(characters[i]));
+        nameHash *= FNV_PRIME;
+    }
+    return nameHash;
+}
+
+template <typename T, uint64_t Capacity>
+uint64_t RuntimeNameIndex<T, Capacity>::homeBucket(const uint64_t nameHash) noexcept
+{
+    return nameHash & (NUMBER_OF_BUCKETS - 1U);
+}
+
+template <typename T, uint64_t Capacity>
+cxx::optional<uint64_t> RuntimeNameIndex<T, Capacity>::bucketOf(const RuntimeName_t& name,
+                                                                const uint64_t nameHash) const noexcept
+{
+    for (uint64_t i = homeBucket(nameHash); m_buckets[i].value.has_value(); i = (i + 1U) & (NUMBER_OF_BUCKETS - 1U))
+    {
+        if (m_buckets[i].hash == nameHash && m_buckets[i].name == name)
+        {
+            return i;
+        }
+    }
+    return cxx::nullopt;
+}
+
+template <typename T, uint64_t Capacity>
+bool RuntimeNameIndex<T, Capacity>::insert(const RuntimeName_t& name, const T& value) noexcept
+{
+    const auto nameHash = hash(name);
+    if (m_size >= Capacity || bucketOf(name, nameHash).has_value())
+    {
+        return false;
+    }
+
+    uint64_t i = homeBucket(nameHash);
+    while (m_buckets[i].value.has_value())
+    {
+        i = (i + 1U) & (NUMBER_OF_BUCKETS - 1U);
+    }
+    m_buckets[i].hash = nameHash;
+    m_buckets[i].name = name;
+    m_buckets[i].value.emplace(value);
+    ++m_size;
+    return true;
+}
+
+template <typename T, uint64_t Capacity>
+cxx::optional<T> RuntimeNameIndex<T, Capacity>::find(const RuntimeName_t& name) const noexcept
+{
+    auto bucket = bucketOf(name, hash(name));
+    if (!bucket.has_value())
+    {
+        return cxx::nullopt;
+    }
+    return m_buckets[bucket.value()].value;
+}
+
+template <typename T, uint64_t Capacity>
+bool RuntimeNameIndex<T, Capacity>::erase(const RuntimeName_t& name) noexcept
+{
+    auto bucket = bucketOf(name, hash(name));
+    if (!bucket.has_value())
+    {
+        return false;
+    }
+
+    // backward shift deletion; moves the following entries of the probe sequence into the gap so that no tombstones
+    // are required and the lookup can stop at the first empty bucket
+    uint64_t gap = bucket.value();
+    for (uint64_t i = (gap + 1U) & (NUMBER_OF_BUCKETS - 1U); m_buckets[i].value.has_value();
+         i = (i + 1U) & (NUMBER_OF_BUCKETS - 1U))
+    {
+        const uint64_t home = homeBucket(m_buckets[i].hash);
+        const bool isHomeCyclicallyInGapToI =
+            (gap <= i) ? (gap < home && home <= i) : (gap < home || home <= i);
+        if (!isHomeCyclicallyInGapToI)
+        {
+            m_buckets[gap].hash = m_buckets[i].hash;
+            m_buckets[gap].name = m_buckets[i].name;
+            m_buckets[gap].value = m_buckets[i].value;
+            gap = i;
+        }
+    }
+    m_buckets[gap].value.reset();
+    --m_size;
+    return true;
+}
+
+template <typename T, uint64_t Capacity>
+void RuntimeNameIndex<T, Capacity>::clear() noexcept
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket.value.reset();
+    }
+    m_size = 0U;
+}
+
+template <typename T, uint64_t Capacity>
+uint64_t RuntimeNameIndex<T, Capacity>::size() const noexcept
+{
+    return m_size;
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_RUNTIME_NAME_INDEX_INL
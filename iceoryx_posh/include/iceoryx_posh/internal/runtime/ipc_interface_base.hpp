@@ -65,7 +65,6 @@ enum class IpcMessageType : int32_t
     CREATE_NODE,
     CREATE_NODE_ACK,
     FIND_SERVICE,
-    KEEPALIVE,
     TERMINATION,
     TERMINATION_ACK,
     PREPARE_APP_TERMINATION,
@@ -43,16 +43,17 @@ class IpcRuntimeInterface
     IpcRuntimeInterface(IpcRuntimeInterface&&) = delete;
     IpcRuntimeInterface& operator=(IpcRuntimeInterface&&) = delete;
 
-    /// @brief sends the keep alive trigger to the RouDi daemon
-    /// @return true if sending was successful, false if not
-    bool sendKeepalive() noexcept;
-
     /// @brief send a request to the RouDi daemon
     /// @param[in] msg request to RouDi
     /// @param[out] answer response from RouDi
     /// @return true if communication was successful, false if not
     bool sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept;
 
+    /// @brief receive the answer of the RouDi daemon for a request which was not sent via the RouDi IPC channel
+    /// @param[out] answer response from RouDi
+    /// @return true if communication was successful, false if not
+    bool receiveAnswerFromRouDi(IpcMessage& answer) noexcept;
+
     /// @brief get the adress offset of the segment manager
     /// @return address offset as rp::BaseRelativePointer::offset_t
     rp::BaseRelativePointer::offset_t getSegmentManagerAddressOffset() const noexcept;
@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_RUNTIME_POSH_RUNTIME_IMPL_HPP
 #define IOX_POSH_RUNTIME_POSH_RUNTIME_IMPL_HPP
 
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
 #include "iceoryx_hoofs/cxx/method_callback.hpp"
 #include "iceoryx_hoofs/internal/concurrent/periodic_task.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/mutex.hpp"
@@ -92,6 +93,16 @@ class PoshRuntimeImpl : public PoshRuntime
     PoshRuntimeImpl(cxx::optional<const RuntimeName_t*> name,
                     const RuntimeLocation location = RuntimeLocation::SEPARATE_PROCESS_FROM_ROUDI) noexcept;
 
+    /// @brief Hands a request over to RouDi with the provided function instead of the IPC channel of RouDi and
+    /// receives the answer from the IPC channel of the runtime
+    /// @param[in] deliverRequest function which passes the request to RouDi
+    /// @param[in] msg request to RouDi
+    /// @param[out] answer response from RouDi
+    /// @return true if communication was successful, false if not
+    bool deliverRequestToRouDi(const cxx::function_ref<void(const IpcMessage&)> deliverRequest,
+                               const IpcMessage& msg,
+                               IpcMessage& answer) noexcept;
+
   private:
     cxx::expected<PublisherPortUserType::MemberType_t*, IpcMessageErrorType>
     requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcept;
@@ -108,7 +119,7 @@ class PoshRuntimeImpl : public PoshRuntime
     cxx::optional<SharedMemoryUser> m_ShmInterface;
     popo::ApplicationPort m_applicationPort;
 
-    void sendKeepAliveAndHandleShutdownPreparation() noexcept;
+    void sendHeartbeatAndHandleShutdownPreparation() noexcept;
     static_assert(PROCESS_KEEP_ALIVE_INTERVAL > roudi::DISCOVERY_INTERVAL, "Keep alive interval too small");
 
     // the m_keepAliveTask should always be the last member, so that it will be the first member to be destroyed
@@ -117,7 +128,7 @@ class PoshRuntimeImpl : public PoshRuntime
         PROCESS_KEEP_ALIVE_INTERVAL,
         "KeepAlive",
         *this,
-        &PoshRuntimeImpl::sendKeepAliveAndHandleShutdownPreparation};
+        &PoshRuntimeImpl::sendHeartbeatAndHandleShutdownPreparation};
 };
 
 } // namespace runtime
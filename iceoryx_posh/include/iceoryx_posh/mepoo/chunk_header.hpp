@@ -100,6 +100,16 @@ struct ChunkHeader
     /// @return the const pointer to the `ChunkHeader` or a `nullptr` if `userPayload` is a `nullptr`
     static const ChunkHeader* fromUserPayload(const void* const userPayload) noexcept;
 
+    /// @brief Get a pointer to the `ChunkHeader` associated to the user-header of the chunk
+    /// @param[in] userHeader is the pointer to the user-header of the chunk
+    /// @return the pointer to the `ChunkHeader` or a `nullptr` if `userHeader` is a `nullptr`
+    static ChunkHeader* fromUserHeader(void* const userHeader) noexcept;
+
+    /// @brief Get a const pointer to the `ChunkHeader` associated to the user-header of the chunk
+    /// @param[in] userHeader is the const pointer to the user-header of the chunk
+    /// @return the const pointer to the `ChunkHeader` or a `nullptr` if `userHeader` is a `nullptr`
+    static const ChunkHeader* fromUserHeader(const void* const userHeader) noexcept;
+
     /// @brief Calculates the used size of the chunk with the ChunkHeader, user-heander and user-payload
     /// @return the used size of the chunk
     uint32_t usedSizeOfChunk() const noexcept;
@@ -47,6 +47,19 @@ struct MePooConfig
     using MePooConfigContainerType = cxx::vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
 
+    /// @brief if true, the MemoryManager records the sizes of the chunk requests and the peak usage per size class
+    /// which can be used to get a mempool configuration suggestion, see MemPoolProfiler::suggestMePooConfig
+    bool m_profileChunkRequests{false};
+
+    /// @brief size in bytes of the additional chunk memory which is reserved in the segment for exhausted mempools;
+    /// an exhausted mempool is extended with up to MemPool::MAX_NUMBER_OF_EXTENSIONS chunk ranges from this memory
+    /// instead of failing the chunk request, see MemPoolOverflow
+    uint64_t m_overflowMemorySize{0U};
+
+    /// @brief the maximum number of chunks per mempool which a publisher can have in use at the same time, including
+    /// the chunks held by its subscribers, if the PublisherOptions do not set a limit; 0 means unlimited
+    uint32_t m_publisherChunkQuota{0U};
+
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() = default;
 
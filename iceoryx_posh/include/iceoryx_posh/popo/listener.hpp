@@ -27,6 +27,7 @@
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iceoryx_posh/popo/wait_options.hpp"
 
 #include <thread>
 
@@ -67,6 +68,10 @@ class Listener
 {
   public:
     Listener() noexcept;
+
+    /// @brief Creates a Listener whose thread waits for events as defined by the options
+    /// @param[in] waitOptions defines whether the thread polls for events before or instead of blocking
+    explicit Listener(const WaitOptions& waitOptions) noexcept;
     Listener(const Listener&) = delete;
     Listener(Listener&&) = delete;
     ~Listener();
@@ -132,7 +137,7 @@ class Listener
     uint64_t size() const noexcept;
 
   protected:
-    Listener(ConditionVariableData& conditionVariableData) noexcept;
+    Listener(ConditionVariableData& conditionVariableData, const WaitOptions& waitOptions = WaitOptions()) noexcept;
 
   private:
     class Event_t;
@@ -39,6 +39,18 @@ struct PublisherOptions
 
     /// @brief The option whether the publisher should block when the subscriber queue is full
     SubscriberTooSlowPolicy subscriberTooSlowPolicy{SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA};
+
+    /// @brief The maximum number of chunks per mempool the publisher and its subscribers can hold at the same time;
+    /// 0 applies the quota from the RouDi config
+    uint32_t maxChunksInUse{0U};
+
+    /// @brief The number of chunks per mempool which are reserved for the publisher and cannot be acquired by other
+    /// publishers; the reservation is made with the first loan from a mempool and fails if the mempool cannot serve it
+    uint32_t reservedChunks{0U};
+
+    /// @brief The option whether the publisher shall provide its latest sample to subscribers which only read the
+    /// latest value; the previous sample can then not be reused for the next loan
+    bool provideLatestValue{false};
 };
 
 } // namespace popo
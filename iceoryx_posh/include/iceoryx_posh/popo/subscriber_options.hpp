@@ -17,8 +17,10 @@
 #ifndef IOX_POSH_POPO_SUBSCRIBER_OPTIONS_HPP
 #define IOX_POSH_POPO_SUBSCRIBER_OPTIONS_HPP
 
+#include "iceoryx_hoofs/internal/units/duration.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
 #include "port_queue_policies.hpp"
+#include "user_header_filter.hpp"
 
 #include <cstdint>
 
@@ -44,6 +46,21 @@ struct SubscriberOptions
 
     /// @brief The option whether the publisher should block when the subscriber queue is full
     QueueFullPolicy queueFullPolicy{QueueFullPolicy::DISCARD_OLDEST_DATA};
+
+    /// @brief The option whether the subscriber only reads the latest value of a publisher which provides it instead
+    /// of receiving the samples via its queue; with multiple publishers the one which acknowledged last is read
+    bool latestValueOnly{false};
+
+    /// @brief The filter the publisher applies before it delivers a sample to the subscriber; all samples are
+    /// delivered by default
+    UserHeaderFilter userHeaderFilter{};
+
+    /// @brief The publisher delivers only the first of every n samples to the subscriber; 0 and 1 deliver every sample
+    uint64_t deliverEveryNthSample{1U};
+
+    /// @brief The publisher delivers at most one sample per interval to the subscriber; zero disables the limit. The
+    /// history requested on subscription is not downsampled
+    units::Duration minDeliveryInterval{units::Duration::fromNanoseconds(0U)};
 };
 
 } // namespace popo
@@ -0,0 +1,93 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_USER_HEADER_FILTER_HPP
+#define IOX_POSH_POPO_USER_HEADER_FILTER_HPP
+
+#include "iceoryx_hoofs/cxx/serialization.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Selects the chunks a subscriber receives by a field of their user-header. The filter is evaluated by the
+/// publisher before a chunk is pushed, i.e. chunks which do not match neither occupy a slot in the queue of the
+/// subscriber nor wake it up. Since the filter is stored in shared memory it is described by data instead of a
+/// callable.
+/// @code
+///   SubscriberOptions options;
+///   options.userHeaderFilter = UserHeaderFilter::fieldEquals(offsetof(CameraHeader, cameraId), FRONT_CAMERA_ID);
+/// @endcode
+class UserHeaderFilter
+{
+  public:
+    /// @brief the maximum size of a field which can be compared
+    static constexpr uint32_t MAX_FIELD_SIZE{8U};
+
+    /// @brief creates a filter which lets all chunks pass
+    UserHeaderFilter() noexcept = default;
+
+    /// @brief creates a UserHeaderFilter from its serialization
+    /// @param[in] serialization of the filter, an invalid serialization results in a filter which lets all chunks pass
+    explicit UserHeaderFilter(const cxx::Serialization& serialization) noexcept;
+
+    /// @brief creates a filter which lets only the chunks pass whose user-header contains the value at the offset
+    /// @tparam T trivially copyable type of the field with a size of at most MAX_FIELD_SIZE
+    /// @param[in] offset of the field from the start of the user-header, e.g. offsetof(MyHeader, myField)
+    /// @param[in] value the field must be equal to
+    /// @return the filter
+    template <typename T>
+    static UserHeaderFilter fieldEquals(const uint32_t offset, const T& value) noexcept;
+
+    /// @brief creates a filter which lets only the chunks pass whose user-header contains the value at the offset,
+    /// only the bits set in the mask are compared
+    /// @tparam T trivially copyable type of the field with a size of at most MAX_FIELD_SIZE
+    /// @param[in] offset of the field from the start of the user-header, e.g. offsetof(MyHeader, myFlags)
+    /// @param[in] value the masked field must be equal to
+    /// @param[in] mask selects the bits of the field which are compared
+    /// @return the filter
+    template <typename T>
+    static UserHeaderFilter fieldEquals(const uint32_t offset, const T& value, const T& mask) noexcept;
+
+    /// @brief checks whether the filter restricts the chunks at all
+    /// @return false for a default constructed filter, otherwise true
+    bool isEnabled() const noexcept;
+
+    /// @brief checks whether a chunk passes the filter
+    /// @param[in] chunkHeader of the chunk to check
+    /// @return true if the filter is disabled or the field of the user-header matches; chunks without a user-header
+    /// or with a user-header which is too small for the field do not match
+    bool matches(const mepoo::ChunkHeader& chunkHeader) const noexcept;
+
+    /// @brief creates a serialization of the UserHeaderFilter
+    explicit operator cxx::Serialization() const noexcept;
+
+  private:
+    uint32_t m_offset{0U};
+    uint32_t m_size{0U};
+    uint64_t m_value{0U};
+    uint64_t m_mask{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/user_header_filter.inl"
+
+#endif // IOX_POSH_POPO_USER_HEADER_FILTER_HPP
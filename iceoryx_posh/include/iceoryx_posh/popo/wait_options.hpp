@@ -0,0 +1,52 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_WAIT_OPTIONS_HPP
+#define IOX_POSH_POPO_WAIT_OPTIONS_HPP
+
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Defines how a WaitSet or Listener waits for notifications
+enum class WaitStrategy : uint8_t
+{
+    /// @brief block on the semaphore right away; no CPU time is spent while waiting
+    BLOCK,
+    /// @brief poll the notifications for the spin duration and block on the semaphore afterwards; trades some CPU
+    /// time for a lower wake-up latency
+    SPIN_THEN_BLOCK,
+    /// @brief poll the notifications without ever blocking; intended for threads running on isolated cores
+    BUSY_POLL
+};
+
+/// @brief This struct is used to configure how a WaitSet or Listener waits for notifications
+struct WaitOptions
+{
+    /// @brief The strategy which is used while waiting
+    WaitStrategy waitStrategy{WaitStrategy::BLOCK};
+
+    /// @brief The time the notifications are polled before blocking, only used with WaitStrategy::SPIN_THEN_BLOCK
+    units::Duration spinDuration{units::Duration::fromMicroseconds(20U)};
+};
+
+} // namespace popo
+} // namespace iox
+#endif // IOX_POSH_POPO_WAIT_OPTIONS_HPP
@@ -33,6 +33,7 @@
 #include "iceoryx_posh/popo/notification_info.hpp"
 #include "iceoryx_posh/popo/trigger.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iceoryx_posh/popo/wait_options.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
 #include <typeinfo>
@@ -66,6 +67,11 @@ class WaitSet
     using NotificationInfoVector = cxx::vector<const NotificationInfo*, CAPACITY>;
 
     WaitSet() noexcept;
+
+    /// @brief Creates a WaitSet which waits for notifications as defined by the options
+    /// @param[in] waitOptions defines whether wait() and timedWait() poll for notifications before or instead of
+    /// blocking
+    explicit WaitSet(const WaitOptions& waitOptions) noexcept;
     ~WaitSet() noexcept;
 
     /// @brief all the Trigger have a pointer pointing to this waitset for cleanup
@@ -213,7 +219,7 @@ class WaitSet
     static constexpr uint64_t capacity() noexcept;
 
   protected:
-    explicit WaitSet(ConditionVariableData& condVarData) noexcept;
+    explicit WaitSet(ConditionVariableData& condVarData, const WaitOptions& waitOptions = WaitOptions()) noexcept;
 
   private:
     enum class NoStateEnumUsed : StateEnumIdentifier
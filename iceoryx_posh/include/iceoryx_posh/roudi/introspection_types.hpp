@@ -42,6 +42,8 @@ struct MemPoolInfo
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
     uint32_t m_chunkPayloadSize{0};
+    /// @brief number of failed chunk requests since the mempool was created
+    uint64_t m_exhaustionCount{0};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -19,6 +19,7 @@
 #include "iceoryx_posh/internal/roudi/memory/mempool_collection_memory_block.hpp"
 #include "iceoryx_posh/internal/roudi/memory/mempool_segment_manager_memory_block.hpp"
 #include "iceoryx_posh/roudi/memory/posix_shm_memory_provider.hpp"
+#include "iceoryx_posh/roudi/memory/single_process_memory_provider.hpp"
 
 namespace iox
 {
@@ -38,9 +39,16 @@ struct DefaultRouDiMemory
 
     mepoo::MePooConfig introspectionMemPoolConfig() const;
 
+    /// @brief The provider for the management memory; this is m_managementShm for ProcessScope::MULTI_PROCESS and
+    /// m_singleProcessManagementMemory for ProcessScope::SINGLE_PROCESS
+    MemoryProvider& managementMemoryProvider() noexcept;
+    const MemoryProvider& managementMemoryProvider() const noexcept;
+
+    ProcessScope m_processScope{ProcessScope::MULTI_PROCESS};
     MemPoolCollectionMemoryBlock m_introspectionMemPoolBlock;
     MemPoolSegmentManagerMemoryBlock m_segmentManagerBlock;
     PosixShmMemoryProvider m_managementShm;
+    SingleProcessMemoryProvider m_singleProcessManagementMemory;
 };
 } // namespace roudi
 } // namespace iox
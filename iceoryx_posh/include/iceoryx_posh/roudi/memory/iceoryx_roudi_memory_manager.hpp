@@ -51,7 +51,7 @@ class IceOryxRouDiMemoryManager : public RouDiMemoryInterface
     /// MemoryBlocks to destroy their data
     cxx::expected<RouDiMemoryManagerError> destroyMemory() noexcept override;
 
-    const PosixShmMemoryProvider* mgmtMemoryProvider() const noexcept override;
+    const MemoryProvider* mgmtMemoryProvider() const noexcept override;
     cxx::optional<PortPool*> portPool() noexcept override;
     cxx::optional<mepoo::MemoryManager*> introspectionMemoryManager() const noexcept override;
     cxx::optional<mepoo::SegmentManager<>*> segmentManager() const noexcept override;
@@ -54,7 +54,7 @@ class RouDiMemoryInterface
     /// MemoryBlocks to destroy their data
     virtual cxx::expected<RouDiMemoryManagerError> destroyMemory() noexcept = 0;
 
-    virtual const PosixShmMemoryProvider* mgmtMemoryProvider() const noexcept = 0;
+    virtual const MemoryProvider* mgmtMemoryProvider() const noexcept = 0;
     virtual cxx::optional<PortPool*> portPool() noexcept = 0;
     virtual cxx::optional<mepoo::MemoryManager*> introspectionMemoryManager() const noexcept = 0;
     virtual cxx::optional<mepoo::SegmentManager<>*> segmentManager() const noexcept = 0;
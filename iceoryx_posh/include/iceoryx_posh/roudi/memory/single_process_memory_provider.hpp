@@ -0,0 +1,61 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_MEMORY_SINGLE_PROCESS_MEMORY_PROVIDER_HPP
+#define IOX_POSH_ROUDI_MEMORY_SINGLE_PROCESS_MEMORY_PROVIDER_HPP
+
+#include "iceoryx_posh/roudi/memory/memory_provider.hpp"
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Creates anonymous private memory which is only accessible from within the current process. This is used
+/// instead of the PosixShmMemoryProvider when RouDi and all applications share a single process.
+class SingleProcessMemoryProvider : public MemoryProvider
+{
+  public:
+    SingleProcessMemoryProvider() noexcept = default;
+    ~SingleProcessMemoryProvider() noexcept;
+
+    SingleProcessMemoryProvider(SingleProcessMemoryProvider&&) = delete;
+    SingleProcessMemoryProvider& operator=(SingleProcessMemoryProvider&&) = delete;
+
+    SingleProcessMemoryProvider(const SingleProcessMemoryProvider&) = delete;
+    SingleProcessMemoryProvider& operator=(const SingleProcessMemoryProvider&) = delete;
+
+  protected:
+    /// @copydoc MemoryProvider::createMemory
+    /// @note This maps anonymous private memory to the address space of the process
+    cxx::expected<void*, MemoryProviderError> createMemory(const uint64_t size, const uint64_t alignment) noexcept;
+
+    /// @copydoc MemoryProvider::destroyMemory
+    /// @note This unmaps the anonymous private memory
+    cxx::expected<MemoryProviderError> destroyMemory() noexcept;
+
+  private:
+    cxx::optional<posix::SharedMemoryObject> m_memoryObject;
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_MEMORY_SINGLE_PROCESS_MEMORY_PROVIDER_HPP
@@ -27,6 +27,7 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
+#include "iceoryx_posh/internal/roudi/port_ownership.hpp"
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
@@ -54,7 +55,10 @@ enum class PortPoolError : uint8_t
 class PortPool
 {
   public:
-    PortPool(PortPoolData& portPoolData) noexcept;
+    /// @param[in] portPoolData the memory for the ports
+    /// @param[in] processScope defines whether the synchronization primitives of the ports need to work across
+    /// process boundaries
+    PortPool(PortPoolData& portPoolData, const ProcessScope processScope = ProcessScope::MULTI_PROCESS) noexcept;
 
     virtual ~PortPool() noexcept = default;
 
@@ -69,6 +73,22 @@ class PortPool
     cxx::vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>
     getConditionVariableDataList() noexcept;
 
+    /// @brief The following functions return only the data which is owned by a runtime. The ports are tracked per
+    /// owner when they are added, therefore the costs depend on the number of ports of the runtime and not on the
+    /// number of ports in the pool.
+    /// @param[in] runtimeName of the runtime which owns the data
+    cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS>
+    getPublisherPortDataList(const RuntimeName_t& runtimeName) noexcept;
+    cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS>
+    getSubscriberPortDataList(const RuntimeName_t& runtimeName) noexcept;
+    cxx::vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER>
+    getInterfacePortDataList(const RuntimeName_t& runtimeName) noexcept;
+    cxx::vector<popo::ApplicationPortData*, MAX_PROCESS_NUMBER>
+    getApplicationPortDataList(const RuntimeName_t& runtimeName) noexcept;
+    cxx::vector<runtime::NodeData*, MAX_NODE_NUMBER> getNodeDataList(const RuntimeName_t& runtimeName) noexcept;
+    cxx::vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>
+    getConditionVariableDataList(const RuntimeName_t& runtimeName) noexcept;
+
     cxx::expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     addPublisherPort(const capro::ServiceDescription& serviceDescription,
                      mepoo::MemoryManager* const memoryManager,
@@ -116,8 +136,34 @@ class PortPool
 
     std::atomic<uint64_t>* serviceRegistryChangeCounter() noexcept;
 
+  private:
+    template <typename T, uint64_t Capacity>
+    void linkToOwner(FixedPositionContainer<T, Capacity>& container,
+                     PortOwnershipList<Capacity>& ownershipList,
+                     const T* const element,
+                     const RuntimeName_t& runtimeName) noexcept;
+
+    template <typename T, uint64_t Capacity>
+    void unlinkFromOwner(FixedPositionContainer<T, Capacity>& container,
+                         PortOwnershipList<Capacity>& ownershipList,
+                         const T* const element) noexcept;
+
+    template <typename T, uint64_t Capacity>
+    cxx::vector<T*, Capacity> getOwnedDataList(FixedPositionContainer<T, Capacity>& container,
+                                               const PortOwnershipList<Capacity>& ownershipList,
+                                               const RuntimeName_t& runtimeName) noexcept;
+
   private:
     PortPoolData* m_portPoolData;
+    ProcessScope m_processScope{ProcessScope::MULTI_PROCESS};
+
+    PortOwnerRegistry m_ownerRegistry;
+    PortOwnershipList<MAX_PUBLISHERS> m_publisherOwnership;
+    PortOwnershipList<MAX_SUBSCRIBERS> m_subscriberOwnership;
+    PortOwnershipList<MAX_INTERFACE_NUMBER> m_interfaceOwnership;
+    PortOwnershipList<MAX_PROCESS_NUMBER> m_applicationOwnership;
+    PortOwnershipList<MAX_NODE_NUMBER> m_nodeOwnership;
+    PortOwnershipList<MAX_NUMBER_OF_CONDITION_VARIABLES> m_conditionVariableOwnership;
 };
 
 } // namespace roudi
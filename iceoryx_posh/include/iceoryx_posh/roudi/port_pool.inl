@@ -52,6 +52,52 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
         subscriberOptions,
         memoryInfo);
 }
+
+template <typename T, uint64_t Capacity>
+inline void PortPool::linkToOwner(FixedPositionContainer<T, Capacity>& container,
+                                  PortOwnershipList<Capacity>& ownershipList,
+                                  const T* const element,
+                                  const RuntimeName_t& runtimeName) noexcept
+{
+    container.indexOf(element).and_then([&](const typename FixedPositionContainer<T, Capacity>::index_t index) {
+        ownershipList.add(m_ownerRegistry.acquire(runtimeName), index);
+    });
+}
+
+template <typename T, uint64_t Capacity>
+inline void PortPool::unlinkFromOwner(FixedPositionContainer<T, Capacity>& container,
+                                      PortOwnershipList<Capacity>& ownershipList,
+                                      const T* const element) noexcept
+{
+    container.indexOf(element).and_then([&](const typename FixedPositionContainer<T, Capacity>::index_t index) {
+        m_ownerRegistry.release(ownershipList.remove(index));
+    });
+}
+
+template <typename T, uint64_t Capacity>
+inline cxx::vector<T*, Capacity> PortPool::getOwnedDataList(FixedPositionContainer<T, Capacity>& container,
+                                                            const PortOwnershipList<Capacity>& ownershipList,
+                                                            const RuntimeName_t& runtimeName) noexcept
+{
+    cxx::vector<T*, Capacity> ownedData;
+    m_ownerRegistry.find(runtimeName).and_then([&](const PortOwnerRegistry::owner_t owner) {
+        ownershipList.forEachSlotOf(owner, [&](const typename PortOwnershipList<Capacity>::index_t slot) {
+            ownedData.emplace_back(container.elementAt(slot));
+        });
+    });
+
+    // the data of runtimes which got no owner id since all ids were in use can only be found by name
+    ownershipList.forEachSlotOf(PortOwnerRegistry::UNTRACKED_OWNER,
+                                [&](const typename PortOwnershipList<Capacity>::index_t slot) {
+                                    auto element = container.elementAt(slot);
+                                    if (element->m_runtimeName == runtimeName)
+                                    {
+                                        ownedData.emplace_back(element);
+                                    }
+                                });
+    return ownedData;
+}
+
 } // namespace roudi
 } // namespace iox
 
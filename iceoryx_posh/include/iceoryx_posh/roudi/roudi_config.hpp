@@ -26,6 +26,10 @@ namespace config
 {
 struct RouDiConfig
 {
+    /// @brief with roudi::ProcessScope::SINGLE_PROCESS RouDi neither creates POSIX shared memory nor inter-process
+    /// semaphores; the applications must be in the same process, i.e. use the PoshRuntimeSingleProcess
+    roudi::ProcessScope m_processScope{roudi::ProcessScope::MULTI_PROCESS};
+
     RouDiConfig& setDefaults();
     RouDiConfig& optimize();
 };
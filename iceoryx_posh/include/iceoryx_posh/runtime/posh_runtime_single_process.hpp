@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_RUNTIME_POSH_RUNTIME_SINGLE_PROCESS_HPP
 #define IOX_POSH_RUNTIME_POSH_RUNTIME_SINGLE_PROCESS_HPP
 
+#include "iceoryx_hoofs/cxx/function.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/runtime/posh_runtime_impl.hpp"
 
@@ -27,8 +28,26 @@ namespace runtime
 class PoshRuntimeSingleProcess : public PoshRuntimeImpl
 {
   public:
+    /// @brief Function which processes a request of the runtime in the calling thread and sends the answer to the
+    /// IPC channel of the runtime
+    using RequestHandler = cxx::function<void(const IpcMessage&)>;
+
     PoshRuntimeSingleProcess(const RuntimeName_t& name) noexcept;
     ~PoshRuntimeSingleProcess();
+
+    /// @brief Requests are passed to the provided handler instead of being sent via the IPC channel of RouDi. This
+    /// saves the context switch to the RouDi thread which processes the IPC messages. Since RouDi and the runtime
+    /// live in the same process, RouDi registers its handler on construction.
+    /// @param[in] handler which processes the requests
+    /// @return true if the handler was registered, false if there is already a registered handler
+    static bool registerRequestHandler(const RequestHandler& handler) noexcept;
+
+    /// @brief Removes the registered request handler; afterwards the requests are sent via the IPC channel again
+    static void unregisterRequestHandler() noexcept;
+
+    /// @copydoc PoshRuntime::sendRequestToRouDi
+    /// @note uses the registered request handler if available
+    bool sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept override;
 };
 } // namespace runtime
 } // namespace iox
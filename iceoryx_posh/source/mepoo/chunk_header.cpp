@@ -160,6 +160,21 @@ const ChunkHeader* ChunkHeader::fromUserPayload(const void* const userPayload) n
     return ChunkHeader::fromUserPayload(const_cast<void*>(userPayload));
 }
 
+ChunkHeader* ChunkHeader::fromUserHeader(void* const userHeader) noexcept
+{
+    if (userHeader == nullptr)
+    {
+        return nullptr;
+    }
+    // the UserHeader is always located relative to the ChunkHeader in this way, see userHeader()
+    return reinterpret_cast<ChunkHeader*>(reinterpret_cast<uint64_t>(userHeader) - sizeof(ChunkHeader));
+}
+
+const ChunkHeader* ChunkHeader::fromUserHeader(const void* const userHeader) noexcept
+{
+    return ChunkHeader::fromUserHeader(const_cast<void*>(userHeader));
+}
+
 uint32_t ChunkHeader::usedSizeOfChunk() const noexcept
 {
     return static_cast<uint32_t>(overflowSafeUsedSizeOfChunk());
@@ -0,0 +1,136 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_quota.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+
+namespace iox
+{
+namespace mepoo
+{
+constexpr uint32_t ChunkQuotaUsage::RESERVATION_NOT_REQUESTED;
+constexpr uint32_t ChunkQuotaUsage::RESERVATION_GRANTED;
+constexpr uint32_t ChunkQuotaUsage::RESERVATION_DENIED;
+constexpr uint64_t ChunkQuotaUsage::RESERVED_CHUNKS_SHIFT;
+constexpr uint64_t ChunkQuotaUsage::RESERVED_CHUNKS_IN_USE_MASK;
+
+cxx::expected<QuotaChunk, ChunkRequestError> ChunkQuotaUsage::acquireChunk(MemPool& memPool,
+                                                                           const ChunkQuotaSettings& settings) noexcept
+{
+    // only the owner increases the number of chunks in use, therefore it cannot exceed the limit after the check
+    if (settings.m_maxChunksInUse != 0U && m_chunksInUse.load(std::memory_order_relaxed) >= settings.m_maxChunksInUse)
+    {
+        return cxx::error<ChunkRequestError>(ChunkRequestError::CHUNK_QUOTA_EXCEEDED);
+    }
+
+    if (settings.m_reservedChunks != 0U
+        && m_reservationState.load(std::memory_order_relaxed) == RESERVATION_NOT_REQUESTED)
+    {
+        if (memPool.tryToReserveChunks(settings.m_reservedChunks))
+        {
+            m_reservation.store(static_cast<uint64_t>(settings.m_reservedChunks) << RESERVED_CHUNKS_SHIFT,
+                                std::memory_order_relaxed);
+            m_reservationState.store(RESERVATION_GRANTED, std::memory_order_relaxed);
+        }
+        else
+        {
+            LogWarn() << "Unable to reserve " << settings.m_reservedChunks << " chunks in MemPool [ ChunkSize = "
+                      << memPool.getChunkSize() << ", ChunkCount = " << memPool.getChunkCount() << ", UsedChunks = "
+                      << memPool.getUsedChunks() << ", ReservedChunks = " << memPool.getReservedChunks()
+                      << " ]; the chunks are acquired without reservation";
+            m_reservationState.store(RESERVATION_DENIED, std::memory_order_relaxed);
+        }
+    }
+
+    if (m_reservationState.load(std::memory_order_relaxed) == RESERVATION_GRANTED)
+    {
+        const uint64_t reservation = m_reservation.load(std::memory_order_relaxed);
+        if ((reservation & RESERVED_CHUNKS_IN_USE_MASK) < (reservation >> RESERVED_CHUNKS_SHIFT))
+        {
+            m_reservation.fetch_add(1U, std::memory_order_relaxed);
+            void* chunk = memPool.getReservedChunk();
+            if (chunk != nullptr)
+            {
+                m_chunksInUse.fetch_add(1U, std::memory_order_relaxed);
+                return cxx::success<QuotaChunk>(QuotaChunk{chunk, true});
+            }
+            m_reservation.fetch_sub(1U, std::memory_order_relaxed);
+        }
+    }
+
+    void* chunk = memPool.getChunk();
+    if (chunk == nullptr)
+    {
+        return cxx::error<ChunkRequestError>(ChunkRequestError::RUNNING_OUT_OF_CHUNKS);
+    }
+    m_chunksInUse.fetch_add(1U, std::memory_order_relaxed);
+    return cxx::success<QuotaChunk>(QuotaChunk{chunk, false});
+}
+
+void ChunkQuotaUsage::releaseChunk(MemPool& memPool, const void* chunk, const bool isReserved) noexcept
+{
+    if (isReserved)
+    {
+        memPool.freeReservedChunk(chunk);
+        const uint64_t reservation = m_reservation.fetch_sub(1U, std::memory_order_acq_rel);
+        // the reservation of the chunks in use stays in the MemPool until they are released
+        if ((reservation >> RESERVED_CHUNKS_SHIFT) == 0U)
+        {
+            memPool.releaseReservedChunks(1U);
+        }
+    }
+    else
+    {
+        memPool.freeChunk(chunk);
+    }
+
+    m_chunksInUse.fetch_sub(1U, std::memory_order_release);
+}
+
+void ChunkQuotaUsage::releaseReservation(MemPool& memPool) noexcept
+{
+    if (m_reservationState.load(std::memory_order_relaxed) != RESERVATION_GRANTED)
+    {
+        return;
+    }
+
+    uint64_t reservation = m_reservation.load(std::memory_order_relaxed);
+    while (!m_reservation.compare_exchange_weak(reservation,
+                                                reservation & RESERVED_CHUNKS_IN_USE_MASK,
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_relaxed))
+    {
+    }
+
+    const uint64_t reservedChunks = reservation >> RESERVED_CHUNKS_SHIFT;
+    const uint64_t reservedChunksInUse = reservation & RESERVED_CHUNKS_IN_USE_MASK;
+    memPool.releaseReservedChunks(static_cast<uint32_t>(reservedChunks - reservedChunksInUse));
+}
+
+uint32_t ChunkQuotaUsage::getChunksInUse() const noexcept
+{
+    return m_chunksInUse.load(std::memory_order_acquire);
+}
+
+void ChunkQuotaUsage::reset() noexcept
+{
+    m_reservation.store(0U, std::memory_order_relaxed);
+    m_reservationState.store(RESERVATION_NOT_REQUESTED, std::memory_order_relaxed);
+}
+
+} // namespace mepoo
+} // namespace iox
@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
 
 #include <algorithm>
 
@@ -30,15 +31,25 @@ namespace mepoo
 MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
                          const uint32_t minFreeChunks,
                          const uint32_t numChunks,
-                         const uint32_t chunkSize) noexcept
+                         const uint32_t chunkSize,
+                         const uint64_t exhaustionCount) noexcept
     : m_usedChunks(usedChunks)
     , m_minFreeChunks(minFreeChunks)
     , m_numChunks(numChunks)
     , m_chunkSize(chunkSize)
+    , m_exhaustionCount(exhaustionCount)
 {
 }
 
 constexpr uint64_t MemPool::CHUNK_MEMORY_ALIGNMENT;
+constexpr std::chrono::nanoseconds MemPool::EXHAUSTION_REPORT_INTERVAL;
+constexpr uint32_t MemPool::MAX_NUMBER_OF_EXTENSIONS;
+constexpr uint64_t MemPool::RESERVED_CHUNKS_SHIFT;
+constexpr uint64_t MemPool::USED_CHUNKS_MASK;
+constexpr uint32_t MemPool::Extension::UNUSED;
+constexpr uint32_t MemPool::Extension::INITIALIZING;
+constexpr uint32_t MemPool::Extension::READY;
+constexpr uint32_t MemPool::Extension::FAILED;
 
 MemPool::MemPool(const cxx::greater_or_equal<uint32_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
                  const cxx::greater_or_equal<uint32_t, 1> numberOfChunks,
@@ -71,44 +82,239 @@ bool MemPool::isMultipleOfAlignment(const uint32_t value) const noexcept
 void MemPool::adjustMinFree() noexcept
 {
     // @todo rethink the concurrent change that can happen. do we need a CAS loop?
-    m_minFree.store(std::min(m_numberOfChunks - m_usedChunks.load(std::memory_order_relaxed),
-                             m_minFree.load(std::memory_order_relaxed)));
+    const uint32_t numberOfChunks = getChunkCount();
+    const uint32_t usedChunks = getUsedChunks();
+    const uint32_t freeChunks = (numberOfChunks > usedChunks) ? numberOfChunks - usedChunks : 0U;
+    m_minFree.store(std::min(freeChunks, m_minFree.load(std::memory_order_relaxed)));
 }
 
 void* MemPool::getChunk() noexcept
 {
-    uint32_t l_index{0U};
-    if (!m_freeIndices.pop(l_index))
+    uint64_t usedAndReservedChunks = m_usedAndReservedChunks.load(std::memory_order_relaxed);
+    do
     {
-        std::cerr << "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
-                  << ", used_chunks = " << m_usedChunks << " ] has no more space left" << std::endl;
-        return nullptr;
-    }
+        // the reserved chunks which are not in use must stay in the free lists for getReservedChunk
+        while ((usedAndReservedChunks & USED_CHUNKS_MASK) + (usedAndReservedChunks >> RESERVED_CHUNKS_SHIFT)
+               >= getChunkCount())
+        {
+            if (!tryToExtend())
+            {
+                // the failure path must stay as cheap as the success path, the reporting is done rate limited by the
+                // caller
+                m_exhaustionCount.fetch_add(1U, std::memory_order_relaxed);
+                return nullptr;
+            }
+            usedAndReservedChunks = m_usedAndReservedChunks.load(std::memory_order_relaxed);
+        }
+    } while (!m_usedAndReservedChunks.compare_exchange_weak(
+        usedAndReservedChunks, usedAndReservedChunks + 1U, std::memory_order_relaxed, std::memory_order_relaxed));
 
     /// @todo: verify that m_usedChunk is not changed during adjustMInFree
     ///         without changing m_minFree
-    m_usedChunks.fetch_add(1U, std::memory_order_relaxed);
     adjustMinFree();
 
-    return m_rawMemory + l_index * m_chunkSize;
+    void* chunk = popChunk();
+    if (chunk == nullptr)
+    {
+        m_usedAndReservedChunks.fetch_sub(1U, std::memory_order_relaxed);
+        m_exhaustionCount.fetch_add(1U, std::memory_order_relaxed);
+    }
+    return chunk;
+}
+
+void* MemPool::getReservedChunk() noexcept
+{
+    m_usedReservedChunks.fetch_add(1U, std::memory_order_relaxed);
+    adjustMinFree();
+
+    void* chunk = popChunk();
+    if (chunk == nullptr)
+    {
+        m_usedReservedChunks.fetch_sub(1U, std::memory_order_relaxed);
+        m_exhaustionCount.fetch_add(1U, std::memory_order_relaxed);
+    }
+    return chunk;
+}
+
+void* MemPool::popChunk() noexcept
+{
+    // the callers acquired a chunk from the counters beforehand, therefore one of the free lists has a chunk left
+    uint32_t index{0U};
+    if (m_freeIndices.pop(index))
+    {
+        return m_rawMemory.get() + static_cast<uint64_t>(index) * m_chunkSize;
+    }
+
+    const uint32_t numberOfExtensions = m_numberOfExtensions.load(std::memory_order_acquire);
+    for (uint32_t i = 0U; i < numberOfExtensions; ++i)
+    {
+        auto& extension = m_extensions[i];
+        if (extension.m_freeIndices.pop(index))
+        {
+            return extension.m_rawMemory.get() + static_cast<uint64_t>(index) * m_chunkSize;
+        }
+    }
+
+    return nullptr;
+}
+
+bool MemPool::tryToExtend() noexcept
+{
+    if (!m_overflow)
+    {
+        return false;
+    }
+
+    const uint32_t numberOfExtensions = m_numberOfExtensions.load(std::memory_order_acquire);
+    if (numberOfExtensions >= MAX_NUMBER_OF_EXTENSIONS)
+    {
+        return false;
+    }
+
+    auto& extension = m_extensions[numberOfExtensions];
+    uint32_t state{Extension::UNUSED};
+    // only one caller extends the MemPool, concurrent callers do not wait for the extension but fail their request
+    if (!extension.m_state.compare_exchange_strong(
+            state, Extension::INITIALIZING, std::memory_order_acquire, std::memory_order_acquire))
+    {
+        // if the extension just became ready the caller shall try again to acquire a chunk
+        return state == Extension::READY;
+    }
+
+    uint32_t numberOfChunks{0U};
+    void* memory = m_overflow->allocate(m_chunkSize, m_numberOfChunks, numberOfChunks);
+    if (memory == nullptr)
+    {
+        // the overflow never gets memory back, therefore it is pointless to try it again
+        extension.m_state.store(Extension::FAILED, std::memory_order_relaxed);
+        return false;
+    }
+
+    extension.m_rawMemory = static_cast<uint8_t*>(memory);
+    extension.m_numberOfChunks = numberOfChunks;
+    extension.m_freeIndices.init(extension.m_freeIndicesMemory.get(), numberOfChunks);
+    // the extension must be visible to popChunk before its chunks can be acquired by getChunk
+    m_numberOfExtensions.store(numberOfExtensions + 1U, std::memory_order_release);
+    m_numberOfExtensionChunks.fetch_add(numberOfChunks, std::memory_order_release);
+    extension.m_state.store(Extension::READY, std::memory_order_release);
+
+    LogWarn() << "MemPool [ ChunkSize = " << m_chunkSize << ", ChunkCount = " << m_numberOfChunks
+              << " ] is exhausted and was extended by " << numberOfChunks << " chunks from the overflow memory";
+
+    return true;
 }
 
 void MemPool::freeChunk(const void* chunk) noexcept
 {
-    cxx::Expects(m_rawMemory <= chunk
-                 && chunk <= m_rawMemory + (static_cast<uint64_t>(m_chunkSize) * (m_numberOfChunks - 1U)));
+    pushChunk(chunk);
+    m_usedAndReservedChunks.fetch_sub(1U, std::memory_order_relaxed);
+}
+
+void MemPool::freeReservedChunk(const void* chunk) noexcept
+{
+    pushChunk(chunk);
+    m_usedReservedChunks.fetch_sub(1U, std::memory_order_relaxed);
+}
+
+bool MemPool::tryToReserveChunks(const uint32_t numberOfChunks) noexcept
+{
+    uint64_t usedAndReservedChunks = m_usedAndReservedChunks.load(std::memory_order_relaxed);
+    do
+    {
+        if ((usedAndReservedChunks & USED_CHUNKS_MASK) + (usedAndReservedChunks >> RESERVED_CHUNKS_SHIFT)
+                + numberOfChunks
+            > getChunkCount())
+        {
+            return false;
+        }
+    } while (!m_usedAndReservedChunks.compare_exchange_weak(
+        usedAndReservedChunks,
+        usedAndReservedChunks + (static_cast<uint64_t>(numberOfChunks) << RESERVED_CHUNKS_SHIFT),
+        std::memory_order_relaxed,
+        std::memory_order_relaxed));
+    return true;
+}
+
+void MemPool::releaseReservedChunks(const uint32_t numberOfChunks) noexcept
+{
+    m_usedAndReservedChunks.fetch_sub(static_cast<uint64_t>(numberOfChunks) << RESERVED_CHUNKS_SHIFT,
+                                      std::memory_order_relaxed);
+}
+
+uint32_t MemPool::getReservedChunks() const noexcept
+{
+    return static_cast<uint32_t>(m_usedAndReservedChunks.load(std::memory_order_relaxed) >> RESERVED_CHUNKS_SHIFT);
+}
+
+void MemPool::pushChunk(const void* chunk) noexcept
+{
+    const uint8_t* rawMemory = m_rawMemory.get();
+    uint32_t numberOfChunks = m_numberOfChunks;
+    freeList_t* freeIndices = &m_freeIndices;
 
-    auto offset = static_cast<const uint8_t*>(chunk) - m_rawMemory;
+    if (chunk < rawMemory || rawMemory + static_cast<uint64_t>(m_chunkSize) * m_numberOfChunks <= chunk)
+    {
+        const uint32_t numberOfExtensions = m_numberOfExtensions.load(std::memory_order_acquire);
+        for (uint32_t i = 0U; i < numberOfExtensions; ++i)
+        {
+            auto& extension = m_extensions[i];
+            const uint8_t* extensionMemory = extension.m_rawMemory.get();
+            if (extensionMemory <= chunk
+                && chunk < extensionMemory + static_cast<uint64_t>(m_chunkSize) * extension.m_numberOfChunks)
+            {
+                rawMemory = extensionMemory;
+                numberOfChunks = extension.m_numberOfChunks;
+                freeIndices = &extension.m_freeIndices;
+                break;
+            }
+        }
+    }
+
+    cxx::Expects(rawMemory <= chunk
+                 && chunk <= rawMemory + (static_cast<uint64_t>(m_chunkSize) * (numberOfChunks - 1U)));
+
+    auto offset = static_cast<const uint8_t*>(chunk) - rawMemory;
     cxx::Expects(offset % m_chunkSize == 0);
 
     uint32_t index = static_cast<uint32_t>(offset / m_chunkSize);
 
-    if (!m_freeIndices.push(index))
+    // the ChunkHeader must be read before the chunk is returned to the free list and might be reused
+    if (m_profiler)
+    {
+        m_profiler->recordRelease(*static_cast<const ChunkHeader*>(chunk));
+    }
+
+    if (!freeIndices->push(index))
     {
         errorHandler(Error::kPOSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
     }
+}
 
-    m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
+void MemPool::setProfiler(MemPoolProfiler* const profiler) noexcept
+{
+    m_profiler = profiler;
+}
+
+void MemPool::enableExtensions(MemPoolOverflow* const overflow, posix::Allocator& managementAllocator) noexcept
+{
+    m_overflow = overflow;
+    for (auto& extension : m_extensions)
+    {
+        extension.m_freeIndicesMemory = static_cast<freeList_t::Index_t*>(managementAllocator.allocate(
+            freeList_t::requiredIndexMemorySize(m_numberOfChunks), CHUNK_MEMORY_ALIGNMENT));
+    }
+}
+
+uint32_t MemPool::getNumberOfExtensions() const noexcept
+{
+    return m_numberOfExtensions.load(std::memory_order_relaxed);
+}
+
+uint64_t MemPool::requiredExtensionManagementMemorySize(const uint32_t numberOfChunks) noexcept
+{
+    return MAX_NUMBER_OF_EXTENSIONS
+           * cxx::align(static_cast<uint64_t>(freeList_t::requiredIndexMemorySize(numberOfChunks)),
+                        CHUNK_MEMORY_ALIGNMENT);
 }
 
 uint32_t MemPool::getChunkSize() const noexcept
@@ -118,12 +324,13 @@ uint32_t MemPool::getChunkSize() const noexcept
 
 uint32_t MemPool::getChunkCount() const noexcept
 {
-    return m_numberOfChunks;
+    return m_numberOfChunks + m_numberOfExtensionChunks.load(std::memory_order_acquire);
 }
 
 uint32_t MemPool::getUsedChunks() const noexcept
 {
-    return m_usedChunks.load(std::memory_order_relaxed);
+    return static_cast<uint32_t>(m_usedAndReservedChunks.load(std::memory_order_relaxed) & USED_CHUNKS_MASK)
+           + m_usedReservedChunks.load(std::memory_order_relaxed);
 }
 
 uint32_t MemPool::getMinFree() const noexcept
@@ -133,10 +340,35 @@ uint32_t MemPool::getMinFree() const noexcept
 
 MemPoolInfo MemPool::getInfo() const noexcept
 {
-    return {m_usedChunks.load(std::memory_order_relaxed),
+    return {getUsedChunks(),
             m_minFree.load(std::memory_order_relaxed),
-            m_numberOfChunks,
-            m_chunkSize};
+            getChunkCount(),
+            m_chunkSize,
+            m_exhaustionCount.load(std::memory_order_relaxed)};
+}
+
+uint64_t MemPool::getExhaustionCount() const noexcept
+{
+    return m_exhaustionCount.load(std::memory_order_relaxed);
+}
+
+cxx::optional<uint64_t> MemPool::tryAcquireExhaustionReport() noexcept
+{
+    // steady_clock is system wide and therefore valid for all processes which share this mempool
+    const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now().time_since_epoch())
+                            .count();
+
+    int64_t nextReportTime = m_nextExhaustionReportTime.load(std::memory_order_relaxed);
+    if (now < nextReportTime
+        || !m_nextExhaustionReportTime.compare_exchange_strong(
+            nextReportTime, now + EXHAUSTION_REPORT_INTERVAL.count(), std::memory_order_relaxed))
+    {
+        return cxx::nullopt;
+    }
+
+    const uint64_t exhaustionCount = m_exhaustionCount.load(std::memory_order_relaxed);
+    return exhaustionCount - m_reportedExhaustionCount.exchange(exhaustionCount, std::memory_order_relaxed);
 }
 
 } // namespace mepoo
@@ -0,0 +1,71 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/mem_pool_overflow.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace mepoo
+{
+void MemPoolOverflow::init(void* const memory, const uint64_t size) noexcept
+{
+    m_memory = static_cast<uint8_t*>(memory);
+    m_size = size;
+    m_usedSize.store(0U, std::memory_order_relaxed);
+}
+
+void* MemPoolOverflow::allocate(const uint32_t chunkSize,
+                                const uint32_t maxNumberOfChunks,
+                                uint32_t& numberOfChunks) noexcept
+{
+    numberOfChunks = 0U;
+    if (chunkSize == 0U)
+    {
+        return nullptr;
+    }
+
+    uint64_t usedSize = m_usedSize.load(std::memory_order_relaxed);
+    uint64_t allocatedSize{0U};
+    do
+    {
+        const uint64_t numberOfFittingChunks = std::min(static_cast<uint64_t>(maxNumberOfChunks),
+                                                        (m_size - usedSize) / static_cast<uint64_t>(chunkSize));
+        if (numberOfFittingChunks == 0U)
+        {
+            return nullptr;
+        }
+        numberOfChunks = static_cast<uint32_t>(numberOfFittingChunks);
+        allocatedSize = numberOfFittingChunks * chunkSize;
+    } while (!m_usedSize.compare_exchange_weak(
+        usedSize, usedSize + allocatedSize, std::memory_order_relaxed, std::memory_order_relaxed));
+
+    return m_memory.get() + usedSize;
+}
+
+uint64_t MemPoolOverflow::getSize() const noexcept
+{
+    return m_size;
+}
+
+uint64_t MemPoolOverflow::getUsedSize() const noexcept
+{
+    return m_usedSize.load(std::memory_order_relaxed);
+}
+
+} // namespace mepoo
+} // namespace iox
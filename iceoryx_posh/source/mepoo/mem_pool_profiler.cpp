@@ -0,0 +1,212 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/mem_pool_profiler.hpp"
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace iox
+{
+namespace mepoo
+{
+constexpr uint32_t MemPoolProfiler::SUB_CLASS_BITS;
+constexpr uint32_t MemPoolProfiler::HALF_SUB_CLASS_COUNT;
+constexpr uint32_t MemPoolProfiler::NUMBER_OF_SIZE_CLASSES;
+constexpr uint32_t MemPoolProfiler::DEFAULT_HEADROOM_IN_PERCENT;
+
+namespace
+{
+void storeMax(std::atomic<uint32_t>& maximum, const uint32_t value) noexcept
+{
+    auto currentMaximum = maximum.load(std::memory_order_relaxed);
+    while (currentMaximum < value
+           && !maximum.compare_exchange_weak(currentMaximum, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+/// @brief the memory of a mempool including its share of the management memory
+uint64_t memoryOfMemPool(const uint32_t chunkPayloadSize, const uint32_t chunkCount) noexcept
+{
+    MePooConfig config;
+    config.addMemPool({chunkPayloadSize, chunkCount});
+    return MemoryManager::requiredFullMemorySize(config);
+}
+
+uint32_t chunkPayloadSizeFor(const uint32_t requiredChunkSize) noexcept
+{
+    const auto chunkSize = cxx::align(static_cast<uint64_t>(requiredChunkSize), MemPool::CHUNK_MEMORY_ALIGNMENT);
+    const auto chunkPayloadSize = (chunkSize > sizeof(ChunkHeader)) ? chunkSize - sizeof(ChunkHeader) : 0U;
+    return static_cast<uint32_t>(std::max(chunkPayloadSize, MemPool::CHUNK_MEMORY_ALIGNMENT));
+}
+
+uint32_t chunkCountFor(const uint64_t peakNumberOfUsedChunks, const uint32_t headroomInPercent) noexcept
+{
+    const uint64_t chunkCount = (peakNumberOfUsedChunks * (100U + headroomInPercent) + 99U) / 100U;
+    return static_cast<uint32_t>(
+        std::min(std::max(chunkCount, static_cast<uint64_t>(1U)),
+                 static_cast<uint64_t>(std::numeric_limits<uint32_t>::max())));
+}
+} // namespace
+
+uint32_t MemPoolProfiler::sizeClassOf(const uint32_t requiredChunkSize) noexcept
+{
+    uint32_t mostSignificantBit{0U};
+    for (uint32_t remainder = requiredChunkSize >> 1U; remainder != 0U; remainder >>= 1U)
+    {
+        ++mostSignificantBit;
+    }
+
+    // sizes below 2^SUB_CLASS_BITS have a class of their own, above every power of two has HALF_SUB_CLASS_COUNT classes
+    const uint32_t magnitude =
+        (mostSignificantBit < SUB_CLASS_BITS) ? 0U : mostSignificantBit - (SUB_CLASS_BITS - 1U);
+    return magnitude * HALF_SUB_CLASS_COUNT + (requiredChunkSize >> magnitude);
+}
+
+uint32_t MemPoolProfiler::requiredChunkSizeOf(const ChunkHeader& chunkHeader) noexcept
+{
+    // the alignment of the user-header does not influence the required chunk size and is not stored in the ChunkHeader
+    constexpr uint32_t USER_HEADER_ALIGNMENT{1U};
+    auto chunkSettings = ChunkSettings::create(chunkHeader.userPayloadSize(),
+                                               chunkHeader.userPayloadAlignment(),
+                                               chunkHeader.userHeaderSize(),
+                                               USER_HEADER_ALIGNMENT);
+    return chunkSettings.has_error() ? chunkHeader.chunkSize() : chunkSettings.value().requiredChunkSize();
+}
+
+void MemPoolProfiler::recordAllocation(const ChunkHeader& chunkHeader) noexcept
+{
+    const auto requiredChunkSize = requiredChunkSizeOf(chunkHeader);
+    auto& sizeClass = m_sizeClasses[sizeClassOf(requiredChunkSize)];
+
+    sizeClass.m_numberOfRequests.fetch_add(1U, std::memory_order_relaxed);
+    storeMax(sizeClass.m_maxRequiredChunkSize, requiredChunkSize);
+    const auto usedChunks = sizeClass.m_usedChunks.fetch_add(1U, std::memory_order_relaxed) + 1U;
+    storeMax(sizeClass.m_peakUsedChunks, usedChunks);
+}
+
+void MemPoolProfiler::recordRelease(const ChunkHeader& chunkHeader) noexcept
+{
+    m_sizeClasses[sizeClassOf(requiredChunkSizeOf(chunkHeader))].m_usedChunks.fetch_sub(1U,
+                                                                                          std::memory_order_relaxed);
+}
+
+cxx::vector<ChunkRequestStatistics, MemPoolProfiler::NUMBER_OF_SIZE_CLASSES>
+MemPoolProfiler::getChunkRequestStatistics() const noexcept
+{
+    cxx::vector<ChunkRequestStatistics, NUMBER_OF_SIZE_CLASSES> statistics;
+    for (const auto& sizeClass : m_sizeClasses)
+    {
+        const auto numberOfRequests = sizeClass.m_numberOfRequests.load(std::memory_order_relaxed);
+        if (numberOfRequests != 0U)
+        {
+            ChunkRequestStatistics entry;
+            entry.m_maxRequiredChunkSize = sizeClass.m_maxRequiredChunkSize.load(std::memory_order_relaxed);
+            entry.m_numberOfRequests = numberOfRequests;
+            entry.m_peakNumberOfUsedChunks = sizeClass.m_peakUsedChunks.load(std::memory_order_relaxed);
+            statistics.emplace_back(entry);
+        }
+    }
+    return statistics;
+}
+
+MePooConfig MemPoolProfiler::suggestMePooConfig(const uint32_t headroomInPercent) const noexcept
+{
+    MePooConfig config;
+    const auto statistics = getChunkRequestStatistics();
+    const uint64_t numberOfClasses = statistics.size();
+    if (numberOfClasses == 0U)
+    {
+        return config;
+    }
+
+    // a mempool serves a contiguous range of size classes, its chunk size is given by the largest class and its chunk
+    // count by the sum of the peaks; the partition into at most MAX_NUMBER_OF_MEMPOOLS ranges with the least memory
+    // is found with dynamic programming over the number of mempools and the number of covered size classes
+    std::vector<uint64_t> summedPeaks(numberOfClasses + 1U, 0U);
+    for (uint64_t i = 0U; i < numberOfClasses; ++i)
+    {
+        summedPeaks[i + 1U] = summedPeaks[i] + statistics[i].m_peakNumberOfUsedChunks;
+    }
+    auto mempoolOf = [&](const uint64_t first, const uint64_t last) {
+        return MePooConfig::Entry(chunkPayloadSizeFor(statistics[last].m_maxRequiredChunkSize),
+                                  chunkCountFor(summedPeaks[last + 1U] - summedPeaks[first], headroomInPercent));
+    };
+
+    constexpr uint64_t INFINITE_MEMORY{std::numeric_limits<uint64_t>::max()};
+    const uint64_t maxNumberOfMemPools = std::min(static_cast<uint64_t>(MAX_NUMBER_OF_MEMPOOLS), numberOfClasses);
+    // memory[k][i] is the least memory to cover the first i size classes with k mempools, start[k][i] is the first
+    // size class of the last of these mempools
+    std::vector<std::vector<uint64_t>> memory(maxNumberOfMemPools + 1U,
+                                              std::vector<uint64_t>(numberOfClasses + 1U, INFINITE_MEMORY));
+    std::vector<std::vector<uint64_t>> start(maxNumberOfMemPools + 1U, std::vector<uint64_t>(numberOfClasses + 1U, 0U));
+    memory[0U][0U] = 0U;
+    for (uint64_t k = 1U; k <= maxNumberOfMemPools; ++k)
+    {
+        for (uint64_t i = k; i <= numberOfClasses; ++i)
+        {
+            for (uint64_t j = k - 1U; j < i; ++j)
+            {
+                if (memory[k - 1U][j] == INFINITE_MEMORY)
+                {
+                    continue;
+                }
+                const auto entry = mempoolOf(j, i - 1U);
+                const auto candidate = memory[k - 1U][j] + memoryOfMemPool(entry.m_size, entry.m_chunkCount);
+                if (candidate < memory[k][i])
+                {
+                    memory[k][i] = candidate;
+                    start[k][i] = j;
+                }
+            }
+        }
+    }
+
+    uint64_t numberOfMemPools{1U};
+    for (uint64_t k = 2U; k <= maxNumberOfMemPools; ++k)
+    {
+        if (memory[k][numberOfClasses] < memory[numberOfMemPools][numberOfClasses])
+        {
+            numberOfMemPools = k;
+        }
+    }
+
+    cxx::vector<MePooConfig::Entry, MAX_NUMBER_OF_MEMPOOLS> reversedEntries;
+    for (uint64_t k = numberOfMemPools, i = numberOfClasses; k > 0U; i = start[k][i], --k)
+    {
+        reversedEntries.emplace_back(mempoolOf(start[k][i], i - 1U));
+    }
+    for (uint64_t i = reversedEntries.size(); i > 0U; --i)
+    {
+        const auto& entry = reversedEntries[i - 1U];
+        // small size classes are narrower than the chunk alignment and might end up with the same chunk size
+        if (!config.m_mempoolConfig.empty() && config.m_mempoolConfig.back().m_size == entry.m_size)
+        {
+            config.m_mempoolConfig.back().m_chunkCount += entry.m_chunkCount;
+            continue;
+        }
+        config.addMemPool(entry);
+    }
+    return config;
+}
+
+} // namespace mepoo
+} // namespace iox
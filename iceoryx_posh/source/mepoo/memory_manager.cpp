@@ -27,11 +27,15 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
 namespace mepoo
 {
+constexpr uint32_t MemoryManager::NO_CHUNK_QUOTA;
+constexpr uint32_t MemoryManager::MAX_NUMBER_OF_CHUNK_QUOTAS;
+
 void MemoryManager::printMemPoolVector(log::LogStream& log) const noexcept
 {
     for (auto& l_mempool : m_memPoolVector)
@@ -96,6 +100,30 @@ uint32_t MemoryManager::sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t si
     return size + static_cast<uint32_t>(sizeof(ChunkHeader));
 }
 
+uint32_t MemoryManager::maxNumberOfExtensionChunks(const MePooConfig& mePooConfig) noexcept
+{
+    if (mePooConfig.m_overflowMemorySize == 0U || mePooConfig.m_mempoolConfig.empty())
+    {
+        return 0U;
+    }
+
+    uint64_t numberOfExtensionChunks{0U};
+    uint64_t smallestChunkSize{std::numeric_limits<uint64_t>::max()};
+    for (const auto& mempoolConfig : mePooConfig.m_mempoolConfig)
+    {
+        numberOfExtensionChunks +=
+            static_cast<uint64_t>(MemPool::MAX_NUMBER_OF_EXTENSIONS) * mempoolConfig.m_chunkCount;
+        smallestChunkSize =
+            std::min(smallestChunkSize, static_cast<uint64_t>(sizeWithChunkHeaderStruct(mempoolConfig.m_size)));
+    }
+
+    // the overflow memory limits the number of chunks in all extensions even if every mempool could be extended
+    // further
+    numberOfExtensionChunks = std::min(numberOfExtensionChunks, mePooConfig.m_overflowMemorySize / smallestChunkSize);
+    return static_cast<uint32_t>(
+        std::min(numberOfExtensionChunks, static_cast<uint64_t>(std::numeric_limits<uint32_t>::max() / 2U)));
+}
+
 uint64_t MemoryManager::requiredChunkMemorySize(const MePooConfig& mePooConfig) noexcept
 {
     uint64_t memorySize{0};
@@ -109,6 +137,7 @@ uint64_t MemoryManager::requiredChunkMemorySize(const MePooConfig& mePooConfig)
                                      * MemoryManager::sizeWithChunkHeaderStruct(mempoolConfig.m_size),
                                  MemPool::CHUNK_MEMORY_ALIGNMENT);
     }
+    memorySize += cxx::align(mePooConfig.m_overflowMemorySize, MemPool::CHUNK_MEMORY_ALIGNMENT);
     return memorySize;
 }
 
@@ -122,12 +151,20 @@ uint64_t MemoryManager::requiredManagementMemorySize(const MePooConfig& mePooCon
         memorySize +=
             cxx::align(static_cast<uint64_t>(MemPool::freeList_t::requiredIndexMemorySize(mempool.m_chunkCount)),
                        MemPool::CHUNK_MEMORY_ALIGNMENT);
+        if (mePooConfig.m_overflowMemorySize > 0U)
+        {
+            memorySize += MemPool::requiredExtensionManagementMemorySize(mempool.m_chunkCount);
+        }
     }
+    sumOfAllChunks += maxNumberOfExtensionChunks(mePooConfig);
 
     memorySize +=
         cxx::align(static_cast<uint64_t>(sumOfAllChunks * sizeof(ChunkManagement)), MemPool::CHUNK_MEMORY_ALIGNMENT);
     memorySize += cxx::align(static_cast<uint64_t>(MemPool::freeList_t::requiredIndexMemorySize(sumOfAllChunks)),
                              MemPool::CHUNK_MEMORY_ALIGNMENT);
+    memorySize += cxx::align(static_cast<uint64_t>(mePooConfig.m_mempoolConfig.size()) * MAX_NUMBER_OF_CHUNK_QUOTAS
+                                 * sizeof(ChunkQuotaUsage),
+                             MemPool::CHUNK_MEMORY_ALIGNMENT);
 
     return memorySize;
 }
@@ -146,23 +183,157 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
         addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
     }
 
+    if (mePooConfig.m_overflowMemorySize > 0U)
+    {
+        m_overflow.init(
+            chunkMemoryAllocator.allocate(mePooConfig.m_overflowMemorySize, MemPool::CHUNK_MEMORY_ALIGNMENT),
+            mePooConfig.m_overflowMemorySize);
+        for (auto& memPool : m_memPoolVector)
+        {
+            memPool.enableExtensions(&m_overflow, managementAllocator);
+        }
+        // the chunks of the extensions need a ChunkManagement, too
+        m_totalNumberOfChunks += maxNumberOfExtensionChunks(mePooConfig);
+    }
+
     generateChunkManagementPool(managementAllocator);
+
+    const uint64_t numberOfChunkQuotaUsages =
+        static_cast<uint64_t>(m_memPoolVector.size()) * MAX_NUMBER_OF_CHUNK_QUOTAS;
+    if (numberOfChunkQuotaUsages > 0U)
+    {
+        auto chunkQuotaUsages = static_cast<ChunkQuotaUsage*>(managementAllocator.allocate(
+            numberOfChunkQuotaUsages * sizeof(ChunkQuotaUsage), MemPool::CHUNK_MEMORY_ALIGNMENT));
+        for (uint64_t i = 0U; i < numberOfChunkQuotaUsages; ++i)
+        {
+            new (&chunkQuotaUsages[i]) ChunkQuotaUsage();
+        }
+        m_chunkQuotaUsages = chunkQuotaUsages;
+    }
+    m_defaultChunkQuota.m_maxChunksInUse = mePooConfig.m_publisherChunkQuota;
+
+    m_profileChunkRequests = mePooConfig.m_profileChunkRequests;
+    if (m_profileChunkRequests)
+    {
+        for (auto& memPool : m_memPoolVector)
+        {
+            memPool.setProfiler(&m_profiler);
+        }
+    }
+}
+
+cxx::optional<const MemPoolProfiler*> MemoryManager::getProfiler() const noexcept
+{
+    if (!m_profileChunkRequests)
+    {
+        return cxx::nullopt;
+    }
+    return cxx::make_optional<const MemPoolProfiler*>(&m_profiler);
+}
+
+uint32_t MemoryManager::acquireChunkQuota(const ChunkQuotaSettings& settings) noexcept
+{
+    ChunkQuotaSettings effectiveSettings = settings;
+    if (effectiveSettings.m_maxChunksInUse == 0U)
+    {
+        effectiveSettings.m_maxChunksInUse = m_defaultChunkQuota.m_maxChunksInUse;
+    }
+    if ((effectiveSettings.m_maxChunksInUse == 0U && effectiveSettings.m_reservedChunks == 0U)
+        || m_memPoolVector.empty())
+    {
+        return NO_CHUNK_QUOTA;
+    }
+
+    for (uint32_t chunkQuota = 0U; chunkQuota < MAX_NUMBER_OF_CHUNK_QUOTAS; ++chunkQuota)
+    {
+        auto& quota = m_chunkQuotas[chunkQuota];
+        if (quota.m_isAcquired)
+        {
+            continue;
+        }
+
+        // a released quota can only be reused when all of its chunks are released
+        bool hasChunksInUse{false};
+        for (uint32_t memPoolIndex = 0U; memPoolIndex < m_memPoolVector.size(); ++memPoolIndex)
+        {
+            hasChunksInUse = hasChunksInUse || (chunkQuotaUsage(chunkQuota, memPoolIndex).getChunksInUse() != 0U);
+        }
+        if (hasChunksInUse)
+        {
+            continue;
+        }
+
+        for (uint32_t memPoolIndex = 0U; memPoolIndex < m_memPoolVector.size(); ++memPoolIndex)
+        {
+            chunkQuotaUsage(chunkQuota, memPoolIndex).reset();
+        }
+        quota.m_settings = effectiveSettings;
+        quota.m_isAcquired = true;
+        return chunkQuota;
+    }
+
+    LogWarn() << "All " << MAX_NUMBER_OF_CHUNK_QUOTAS
+              << " chunk quotas are in use; the chunks are acquired without quota";
+    return NO_CHUNK_QUOTA;
+}
+
+void MemoryManager::releaseChunkQuota(const uint32_t chunkQuota) noexcept
+{
+    if (chunkQuota >= MAX_NUMBER_OF_CHUNK_QUOTAS || !m_chunkQuotas[chunkQuota].m_isAcquired)
+    {
+        return;
+    }
+
+    for (uint32_t memPoolIndex = 0U; memPoolIndex < m_memPoolVector.size(); ++memPoolIndex)
+    {
+        chunkQuotaUsage(chunkQuota, memPoolIndex).releaseReservation(m_memPoolVector[memPoolIndex]);
+    }
+    m_chunkQuotas[chunkQuota].m_isAcquired = false;
+}
+
+ChunkQuotaUsage& MemoryManager::chunkQuotaUsage(const uint32_t chunkQuota, const uint32_t memPoolIndex) noexcept
+{
+    return m_chunkQuotaUsages.get()[static_cast<uint64_t>(memPoolIndex) * MAX_NUMBER_OF_CHUNK_QUOTAS + chunkQuota];
 }
 
 SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
 {
-    void* chunk{nullptr};
+    SharedChunk chunk;
+    getChunk(chunkSettings, NO_CHUNK_QUOTA).and_then([&](SharedChunk& acquiredChunk) {
+        chunk = std::move(acquiredChunk);
+    });
+    return chunk;
+}
+
+cxx::expected<SharedChunk, ChunkRequestError> MemoryManager::getChunk(const ChunkSettings& chunkSettings,
+                                                                       const uint32_t chunkQuota) noexcept
+{
+    QuotaChunk chunk;
     MemPool* memPoolPointer{nullptr};
     const auto requiredChunkSize = chunkSettings.requiredChunkSize();
 
     uint32_t aquiredChunkSize = 0U;
 
-    for (auto& memPool : m_memPoolVector)
+    for (uint32_t memPoolIndex = 0U; memPoolIndex < m_memPoolVector.size(); ++memPoolIndex)
     {
+        auto& memPool = m_memPoolVector[memPoolIndex];
         uint32_t chunkSizeOfMemPool = memPool.getChunkSize();
         if (chunkSizeOfMemPool >= requiredChunkSize)
         {
-            chunk = memPool.getChunk();
+            if (chunkQuota < MAX_NUMBER_OF_CHUNK_QUOTAS)
+            {
+                auto& usage = chunkQuotaUsage(chunkQuota, memPoolIndex);
+                auto maybeChunk = usage.acquireChunk(memPool, m_chunkQuotas[chunkQuota].m_settings);
+                if (maybeChunk.has_error() && maybeChunk.get_error() == ChunkRequestError::CHUNK_QUOTA_EXCEEDED)
+                {
+                    return cxx::error<ChunkRequestError>(ChunkRequestError::CHUNK_QUOTA_EXCEEDED);
+                }
+                maybeChunk.and_then([&](const QuotaChunk& quotaChunk) { chunk = quotaChunk; });
+            }
+            else
+            {
+                chunk.m_chunk = memPool.getChunk();
+            }
             memPoolPointer = &memPool;
             aquiredChunkSize = chunkSizeOfMemPool;
             break;
@@ -174,7 +345,7 @@ SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
         LogFatal() << "There are no mempools available!";
 
         errorHandler(Error::kMEPOO__MEMPOOL_GETCHUNK_CHUNK_WITHOUT_MEMPOOL, nullptr, ErrorLevel::SEVERE);
-        return SharedChunk(nullptr);
+        return cxx::error<ChunkRequestError>(ChunkRequestError::RUNNING_OUT_OF_CHUNKS);
     }
     else if (memPoolPointer == nullptr)
     {
@@ -185,25 +356,38 @@ SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
         log.Flush();
 
         errorHandler(Error::kMEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE, nullptr, ErrorLevel::SEVERE);
-        return SharedChunk(nullptr);
+        return cxx::error<ChunkRequestError>(ChunkRequestError::RUNNING_OUT_OF_CHUNKS);
     }
-    else if (chunk == nullptr)
+    else if (chunk.m_chunk == nullptr)
     {
-        auto log = LogError();
-        log << "MemoryManager: unable to acquire a chunk with a chunk-payload size of "
-            << chunkSettings.userPayloadSize();
-        log << "The following mempools are available:";
-        printMemPoolVector(log);
-        log.Flush();
-        errorHandler(Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS, nullptr, ErrorLevel::MODERATE);
-        return SharedChunk(nullptr);
+        // a mempool which runs out of chunks is most likely hammered by further requests; to not amplify the
+        // overload with console I/O the exhaustion is only counted and reported in a rate limited summary
+        memPoolPointer->tryAcquireExhaustionReport().and_then([&](const uint64_t numberOfFailedRequests) {
+            LogWarn() << "MemoryManager: unable to acquire a chunk with a chunk-payload size of "
+                      << chunkSettings.userPayloadSize() << " from MemPool [ ChunkSize = " << aquiredChunkSize
+                      << ", ChunkCount = " << memPoolPointer->getChunkCount() << " ]; " << numberOfFailedRequests
+                      << " request(s) failed since the last report";
+            errorHandler(
+                Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS, nullptr, ErrorLevel::MODERATE);
+        });
+        return cxx::error<ChunkRequestError>(ChunkRequestError::RUNNING_OUT_OF_CHUNKS);
     }
     else
     {
-        auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
+        auto chunkHeader = new (chunk.m_chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
+        if (m_profileChunkRequests)
+        {
+            m_profiler.recordAllocation(*chunkHeader);
+        }
         auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
             ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
-        return SharedChunk(chunkManagement);
+        if (chunkQuota < MAX_NUMBER_OF_CHUNK_QUOTAS)
+        {
+            chunkManagement->m_chunkQuotaUsage =
+                &chunkQuotaUsage(chunkQuota, static_cast<uint32_t>(memPoolPointer - m_memPoolVector.begin()));
+            chunkManagement->m_isReservedChunk = chunk.m_isReserved;
+        }
+        return cxx::success<SharedChunk>(chunkManagement);
     }
 }
 } // namespace mepoo
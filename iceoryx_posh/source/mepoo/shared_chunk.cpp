@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_quota.hpp"
 
 namespace iox
 {
@@ -61,7 +62,15 @@ void SharedChunk::decrementReferenceCounter() noexcept
 
 void SharedChunk::freeChunk() noexcept
 {
-    m_chunkManagement->m_mempool->freeChunk(m_chunkManagement->m_chunkHeader);
+    if (m_chunkManagement->m_chunkQuotaUsage)
+    {
+        m_chunkManagement->m_chunkQuotaUsage->releaseChunk(
+            *m_chunkManagement->m_mempool, m_chunkManagement->m_chunkHeader, m_chunkManagement->m_isReservedChunk);
+    }
+    else
+    {
+        m_chunkManagement->m_mempool->freeChunk(m_chunkManagement->m_chunkHeader);
+    }
     m_chunkManagement->m_chunkManagementPool->freeChunk(m_chunkManagement);
     m_chunkManagement = nullptr;
 }
@@ -18,12 +18,35 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace popo
 {
-ConditionListener::ConditionListener(ConditionVariableData& condVarData) noexcept
+namespace
+{
+/// @brief tells the CPU that we are in a spin loop; reduces the power consumption and frees resources for a sibling
+/// hyper-thread
+inline void cpuRelax() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield");
+#endif
+}
+
+std::chrono::steady_clock::time_point deadlineAfter(const std::chrono::steady_clock::time_point& start,
+                                                    const units::Duration& duration) noexcept
+{
+    return start + std::chrono::nanoseconds(duration.toNanoseconds());
+}
+} // namespace
+
+ConditionListener::ConditionListener(ConditionVariableData& condVarData, const WaitOptions& waitOptions) noexcept
     : m_condVarDataPtr(&condVarData)
+    , m_waitOptions(waitOptions)
 {
 }
 
@@ -54,6 +77,11 @@ void ConditionListener::destroy() noexcept
 
 bool ConditionListener::wasNotified() const noexcept
 {
+    if (hasActiveNotification())
+    {
+        return true;
+    }
+
     auto result = getMembers()->m_semaphore.getValue();
     if (result.has_error())
     {
@@ -66,29 +94,88 @@ bool ConditionListener::wasNotified() const noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
-    return waitImpl([this]() -> bool {
-        if (this->getMembers()->m_semaphore.wait().has_error())
-        {
-            errorHandler(Error::kPOPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, nullptr, ErrorLevel::FATAL);
-            return false;
-        }
-        return true;
-    });
+    const auto start = std::chrono::steady_clock::now();
+    auto spinDeadline = start;
+    if (m_waitOptions.waitStrategy == WaitStrategy::SPIN_THEN_BLOCK)
+    {
+        spinDeadline = deadlineAfter(start, m_waitOptions.spinDuration);
+    }
+    else if (m_waitOptions.waitStrategy == WaitStrategy::BUSY_POLL)
+    {
+        spinDeadline = std::chrono::steady_clock::time_point::max();
+    }
+
+    return waitImpl(
+        [this]() -> bool {
+            if (this->getMembers()->m_semaphore.wait().has_error())
+            {
+                errorHandler(Error::kPOPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, nullptr, ErrorLevel::FATAL);
+                return false;
+            }
+            return true;
+        },
+        spinDeadline);
 }
 
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
-    return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore.timedWait(timeToWait).has_error())
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = deadlineAfter(start, timeToWait);
+    auto spinDeadline = start;
+    if (m_waitOptions.waitStrategy == WaitStrategy::SPIN_THEN_BLOCK)
+    {
+        spinDeadline = std::min(deadline, deadlineAfter(start, m_waitOptions.spinDuration));
+    }
+    else if (m_waitOptions.waitStrategy == WaitStrategy::BUSY_POLL)
+    {
+        spinDeadline = deadline;
+    }
+
+    return waitImpl(
+        [this, deadline]() -> bool {
+            // the time spent spinning is subtracted from the time to wait
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline)
+            {
+                return false;
+            }
+
+            const auto remainingTime = units::Duration(std::chrono::nanoseconds(deadline - now));
+            if (this->getMembers()->m_semaphore.timedWait(remainingTime).has_error())
+            {
+                errorHandler(
+                    Error::kPOPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, nullptr, ErrorLevel::FATAL);
+            }
+            return false;
+        },
+        spinDeadline);
+}
+
+bool ConditionListener::spinUntilNotified(const std::chrono::steady_clock::time_point& deadline) const noexcept
+{
+    // the clock is only read every few iterations to keep the polling loop tight
+    constexpr uint32_t ITERATIONS_BETWEEN_CLOCK_READS{64U};
+    while (true)
+    {
+        for (uint32_t i = 0U; i < ITERATIONS_BETWEEN_CLOCK_READS; ++i)
+        {
+            if (hasActiveNotification() || m_toBeDestroyed.load(std::memory_order_relaxed))
+            {
+                return true;
+            }
+            cpuRelax();
+        }
+
+        if (std::chrono::steady_clock::now() >= deadline)
         {
-            errorHandler(
-                Error::kPOPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, nullptr, ErrorLevel::FATAL);
+            return false;
         }
-        return false;
-    });
+    }
 }
 
-ConditionListener::NotificationVector_t ConditionListener::waitImpl(const cxx::function_ref<bool()>& waitCall) noexcept
+ConditionListener::NotificationVector_t
+ConditionListener::waitImpl(const cxx::function_ref<bool()>& waitCall,
+                            const std::chrono::steady_clock::time_point& spinDeadline) noexcept
 {
     using Type_t = iox::cxx::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     NotificationVector_t activeNotifications;
@@ -110,12 +197,46 @@ ConditionListener::NotificationVector_t ConditionListener::waitImpl(const cxx::f
             return activeNotifications;
         }
 
-        doReturnAfterNotificationCollection = !waitCall();
+        if (m_waitOptions.waitStrategy != WaitStrategy::BLOCK)
+        {
+            if (spinUntilNotified(spinDeadline))
+            {
+                continue;
+            }
+
+            if (m_waitOptions.waitStrategy == WaitStrategy::BUSY_POLL)
+            {
+                // the deadline of a timed wait passed
+                doReturnAfterNotificationCollection = true;
+                continue;
+            }
+        }
+
+        getMembers()->m_numberOfSleepingWaiters.fetch_add(1U, std::memory_order_relaxed);
+        // pairs with the fence in ConditionNotifier::notify
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!hasActiveNotification())
+        {
+            doReturnAfterNotificationCollection = !waitCall();
+        }
+        getMembers()->m_numberOfSleepingWaiters.fetch_sub(1U, std::memory_order_relaxed);
     }
 
     return activeNotifications;
 }
 
+bool ConditionListener::hasActiveNotification() const noexcept
+{
+    for (const auto& notification : getMembers()->m_activeNotifications)
+    {
+        if (notification.load(std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 void ConditionListener::reset(const uint64_t index) noexcept
 {
     if (index < MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE)
@@ -40,6 +40,15 @@ void ConditionNotifier::notify() noexcept
     {
         getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
     }
+
+    // pairs with the fence in ConditionListener::waitImpl; either the listener sees the notification before it
+    // blocks or we see the sleeping listener and wake it up
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (getMembers()->m_numberOfSleepingWaiters.load(std::memory_order_relaxed) == 0U)
+    {
+        return;
+    }
+
     getMembers()->m_semaphore.post().or_else([](auto) {
         errorHandler(Error::kPOPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, nullptr, ErrorLevel::FATAL);
     });
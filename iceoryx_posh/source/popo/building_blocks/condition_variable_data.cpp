@@ -27,12 +27,34 @@ ConditionVariableData::ConditionVariableData() noexcept
 }
 
 ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName) noexcept
-    : m_runtimeName(runtimeName)
+    : ConditionVariableData(runtimeName, roudi::ProcessScope::MULTI_PROCESS)
+{
+}
+
+ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName,
+                                             const roudi::ProcessScope processScope) noexcept
+    : m_semaphore(createSemaphore(processScope))
+    , m_runtimeName(runtimeName)
 {
     for (auto& id : m_activeNotifications)
     {
         id.store(false, std::memory_order_relaxed);
     }
 }
+
+posix::Semaphore ConditionVariableData::createSemaphore(const roudi::ProcessScope processScope) noexcept
+{
+    auto semaphore = (processScope == roudi::ProcessScope::SINGLE_PROCESS)
+                         ? posix::Semaphore::create(posix::CreateUnnamedSingleProcessSemaphore, 0U)
+                         : posix::Semaphore::create(posix::CreateUnnamedSharedMemorySemaphore, 0U);
+
+    return std::move(semaphore
+                         .or_else([](posix::SemaphoreError&) {
+                             errorHandler(Error::kPOPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE,
+                                          nullptr,
+                                          ErrorLevel::FATAL);
+                         })
+                         .value());
+}
 } // namespace popo
 } // namespace iox
@@ -0,0 +1,70 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/delivery_rate_limiter.hpp"
+
+#include <chrono>
+#include <limits>
+
+namespace iox
+{
+namespace popo
+{
+void DeliveryRateLimiter::setLimits(const uint64_t deliverEveryNthChunk,
+                                    const units::Duration minDeliveryInterval) noexcept
+{
+    constexpr uint64_t MAX_INTERVAL_NS{static_cast<uint64_t>(std::numeric_limits<int64_t>::max() / 2)};
+    const auto minDeliveryIntervalNs = minDeliveryInterval.toNanoseconds();
+
+    m_deliverEveryNthChunk = (deliverEveryNthChunk == 0U) ? 1U : deliverEveryNthChunk;
+    m_minDeliveryIntervalNs =
+        static_cast<int64_t>((minDeliveryIntervalNs > MAX_INTERVAL_NS) ? MAX_INTERVAL_NS : minDeliveryIntervalNs);
+}
+
+bool DeliveryRateLimiter::isEnabled() const noexcept
+{
+    return m_deliverEveryNthChunk > 1U || m_minDeliveryIntervalNs > 0;
+}
+
+bool DeliveryRateLimiter::isNextChunkDue() noexcept
+{
+    if (m_deliverEveryNthChunk > 1U
+        && m_numberOfOfferedChunks.fetch_add(1U, std::memory_order_relaxed) % m_deliverEveryNthChunk != 0U)
+    {
+        return false;
+    }
+
+    if (m_minDeliveryIntervalNs > 0)
+    {
+        // steady_clock is system wide and therefore valid for all processes which push into this queue
+        const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now().time_since_epoch())
+                                .count();
+
+        int64_t nextDeliveryTime = m_nextDeliveryTimeNs.load(std::memory_order_relaxed);
+        if (now < nextDeliveryTime
+            || !m_nextDeliveryTimeNs.compare_exchange_strong(
+                nextDeliveryTime, now + m_minDeliveryIntervalNs, std::memory_order_relaxed))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,62 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_reader.hpp"
+
+namespace iox
+{
+namespace popo
+{
+LatestValueReader::LatestValueReader(cxx::not_null<MemberType_t* const> latestValueDataPtr) noexcept
+    : m_latestValueDataPtr(latestValueDataPtr)
+{
+}
+
+mepoo::SharedChunk LatestValueReader::peek() noexcept
+{
+    auto& members = *getMembers();
+
+    while (true)
+    {
+        const auto slotIndex = members.m_currentSlot.load(std::memory_order_seq_cst);
+        auto& slot = members.m_slots[slotIndex];
+        slot.m_numberOfReaders.fetch_add(1U, std::memory_order_seq_cst);
+
+        // the writer does not reuse a slot with readers, but it could have replaced the value before the
+        // registration became visible; in this case the chunk must not be touched and the new value is tried
+        if (members.m_currentSlot.load(std::memory_order_seq_cst) == slotIndex)
+        {
+            auto chunk = slot.m_chunk.cloneToSharedChunk();
+            slot.m_numberOfReaders.fetch_sub(1U, std::memory_order_release);
+            return chunk;
+        }
+
+        slot.m_numberOfReaders.fetch_sub(1U, std::memory_order_relaxed);
+    }
+}
+
+const LatestValueReader::MemberType_t* LatestValueReader::getMembers() const noexcept
+{
+    return m_latestValueDataPtr;
+}
+
+LatestValueReader::MemberType_t* LatestValueReader::getMembers() noexcept
+{
+    return m_latestValueDataPtr;
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,88 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_writer.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint32_t LatestValueData::NUMBER_OF_SLOTS;
+
+LatestValueWriter::LatestValueWriter(cxx::not_null<MemberType_t* const> latestValueDataPtr) noexcept
+    : m_latestValueDataPtr(latestValueDataPtr)
+{
+}
+
+bool LatestValueWriter::update(const mepoo::SharedChunk& chunk) noexcept
+{
+    auto& members = *getMembers();
+    const auto currentSlot = members.m_currentSlot.load(std::memory_order_relaxed);
+
+    for (uint32_t i = 1U; i < LatestValueData::NUMBER_OF_SLOTS; ++i)
+    {
+        const auto slotIndex = (currentSlot + i) % LatestValueData::NUMBER_OF_SLOTS;
+        auto& slot = members.m_slots[slotIndex];
+        // the slot is not current, therefore a reader which registers after this check sees that the current slot
+        // changed and retries without touching the chunk; the sequentially consistent order of the registration,
+        // this check and the update of the current slot is what makes this work
+        if (slot.m_numberOfReaders.load(std::memory_order_seq_cst) == 0U)
+        {
+            slot.m_chunk.releaseToSharedChunk();
+            slot.m_chunk = mepoo::ShmSafeUnmanagedChunk(chunk);
+            members.m_currentSlot.store(slotIndex, std::memory_order_seq_cst);
+            releaseUnusedChunks();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void LatestValueWriter::releaseAll() noexcept
+{
+    update(mepoo::SharedChunk());
+    releaseUnusedChunks();
+}
+
+void LatestValueWriter::releaseUnusedChunks() noexcept
+{
+    auto& members = *getMembers();
+    const auto currentSlot = members.m_currentSlot.load(std::memory_order_relaxed);
+
+    for (uint32_t slotIndex = 0U; slotIndex < LatestValueData::NUMBER_OF_SLOTS; ++slotIndex)
+    {
+        auto& slot = members.m_slots[slotIndex];
+        if (slotIndex != currentSlot && !slot.m_chunk.isLogicalNullptr()
+            && slot.m_numberOfReaders.load(std::memory_order_seq_cst) == 0U)
+        {
+            slot.m_chunk.releaseToSharedChunk();
+        }
+    }
+}
+
+const LatestValueWriter::MemberType_t* LatestValueWriter::getMembers() const noexcept
+{
+    return m_latestValueDataPtr;
+}
+
+LatestValueWriter::MemberType_t* LatestValueWriter::getMembers() noexcept
+{
+    return m_latestValueDataPtr;
+}
+
+} // namespace popo
+} // namespace iox
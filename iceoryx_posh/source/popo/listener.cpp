@@ -23,13 +23,18 @@ namespace iox
 namespace popo
 {
 Listener::Listener() noexcept
-    : Listener(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable())
+    : Listener(WaitOptions())
 {
 }
 
-Listener::Listener(ConditionVariableData& conditionVariable) noexcept
+Listener::Listener(const WaitOptions& waitOptions) noexcept
+    : Listener(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), waitOptions)
+{
+}
+
+Listener::Listener(ConditionVariableData& conditionVariable, const WaitOptions& waitOptions) noexcept
     : m_conditionVariableData(&conditionVariable)
-    , m_conditionListener(conditionVariable)
+    , m_conditionListener(conditionVariable, waitOptions)
 {
     m_thread = std::thread(&Listener::threadLoop, this);
 }
@@ -40,6 +40,17 @@ void ApplicationPort::dispatchCaProMessage(const capro::CaproMessage& caProMessa
     }
 }
 
+void ApplicationPort::sendHeartbeat() noexcept
+{
+    getMembers()->m_heartbeat.store(mepoo::DurationNs_t(mepoo::BaseClock_t::now().time_since_epoch()).count(),
+                                    std::memory_order_relaxed);
+}
+
+mepoo::TimePointNs_t ApplicationPort::getLastHeartbeat() const noexcept
+{
+    return mepoo::TimePointNs_t(mepoo::DurationNs_t(getMembers()->m_heartbeat.load(std::memory_order_relaxed)));
+}
+
 const typename ApplicationPort::MemberType_t* ApplicationPort::getMembers() const noexcept
 {
     return reinterpret_cast<const MemberType_t*>(BasePort::getMembers());
@@ -21,6 +21,8 @@ namespace iox
 {
 namespace popo
 {
+constexpr uint32_t RPCBaseHeader::UNKNOWN_CLIENT_QUEUE_INDEX;
+
 ClientPortData::ClientPortData(const capro::ServiceDescription& serviceDescription,
                                const RuntimeName_t& runtimeName,
                                const NodeName_t& nodeName,
@@ -40,21 +40,120 @@ ClientPortRouDi::MemberType_t* ClientPortRouDi::getMembers() noexcept
 
 cxx::optional<capro::CaproMessage> ClientPortRouDi::tryGetCaProMessage() noexcept
 {
-    /// @todo
+    // get connect request from user side
+    const auto currentConnectRequest = getMembers()->m_connectRequested.load(std::memory_order_relaxed);
 
-    // nothing to change
-    return cxx::nullopt_t();
+    const auto currentConnectionState = getMembers()->m_connectionState.load(std::memory_order_relaxed);
+
+    if (currentConnectRequest && (ConnectionState::NOT_CONNECTED == currentConnectionState))
+    {
+        getMembers()->m_connectionState.store(ConnectionState::CONNECT_REQUESTED, std::memory_order_relaxed);
+
+        return cxx::make_optional<capro::CaproMessage>(createConnectMessage(capro::CaproMessageType::SUB));
+    }
+    else if (!currentConnectRequest && (ConnectionState::CONNNECTED == currentConnectionState))
+    {
+        getMembers()->m_connectionState.store(ConnectionState::DISCONNECT_REQUESTED, std::memory_order_relaxed);
+
+        // requests are not delivered to the server anymore
+        m_chunkSender.removeAllQueues();
+
+        return cxx::make_optional<capro::CaproMessage>(createConnectMessage(capro::CaproMessageType::UNSUB));
+    }
+    else if (!currentConnectRequest && (ConnectionState::WAIT_FOR_OFFER == currentConnectionState))
+    {
+        getMembers()->m_connectionState.store(ConnectionState::NOT_CONNECTED, std::memory_order_relaxed);
+        return cxx::nullopt_t();
+    }
+    else
+    {
+        // nothing to change
+        return cxx::nullopt_t();
+    }
 }
 
 cxx::optional<capro::CaproMessage>
-ClientPortRouDi::dispatchCaProMessageAndGetPossibleResponse(const capro::CaproMessage& /*caProMessage*/) noexcept
+ClientPortRouDi::dispatchCaProMessageAndGetPossibleResponse(const capro::CaproMessage& caProMessage) noexcept
 {
-    /// @todo
+    const auto currentConnectionState = getMembers()->m_connectionState.load(std::memory_order_relaxed);
+
+    if ((capro::CaproMessageType::OFFER == caProMessage.m_type)
+        && (ConnectionState::WAIT_FOR_OFFER == currentConnectionState))
+    {
+        getMembers()->m_connectionState.store(ConnectionState::CONNECT_REQUESTED, std::memory_order_relaxed);
+
+        return cxx::make_optional<capro::CaproMessage>(createConnectMessage(capro::CaproMessageType::SUB));
+    }
+    else if ((capro::CaproMessageType::STOP_OFFER == caProMessage.m_type)
+             && (ConnectionState::CONNNECTED == currentConnectionState))
+    {
+        getMembers()->m_connectionState.store(ConnectionState::WAIT_FOR_OFFER, std::memory_order_relaxed);
 
-    capro::CaproMessage responseMessage(
-        capro::CaproMessageType::NACK, this->getCaProServiceDescription(), capro::CaproMessageSubType::NOSUBTYPE);
+        m_chunkSender.removeAllQueues();
 
-    return cxx::make_optional<capro::CaproMessage>(responseMessage);
+        return cxx::nullopt_t();
+    }
+    else if (capro::CaproMessageType::ACK == caProMessage.m_type)
+    {
+        if (ConnectionState::CONNECT_REQUESTED == currentConnectionState)
+        {
+            // the server provides its request queue with the acknowledgement
+            const auto ret = m_chunkSender.tryAddQueue(
+                static_cast<ClientChunkDistributorData_t::ChunkQueueData_t*>(caProMessage.m_chunkQueueData));
+            if (ret.has_error())
+            {
+                errorHandler(Error::kPOPO__CAPRO_PROTOCOL_ERROR, nullptr, ErrorLevel::MODERATE);
+            }
+            getMembers()->m_connectionState.store(ConnectionState::CONNNECTED, std::memory_order_relaxed);
+        }
+        else if (ConnectionState::DISCONNECT_REQUESTED == currentConnectionState)
+        {
+            getMembers()->m_connectionState.store(ConnectionState::NOT_CONNECTED, std::memory_order_relaxed);
+        }
+        else
+        {
+            errorHandler(Error::kPOPO__CAPRO_PROTOCOL_ERROR, nullptr, ErrorLevel::MODERATE);
+        }
+
+        return cxx::nullopt_t();
+    }
+    else if (capro::CaproMessageType::NACK == caProMessage.m_type)
+    {
+        if (ConnectionState::CONNECT_REQUESTED == currentConnectionState)
+        {
+            getMembers()->m_connectionState.store(ConnectionState::WAIT_FOR_OFFER, std::memory_order_relaxed);
+        }
+        else if (ConnectionState::DISCONNECT_REQUESTED == currentConnectionState)
+        {
+            getMembers()->m_connectionState.store(ConnectionState::NOT_CONNECTED, std::memory_order_relaxed);
+        }
+        else
+        {
+            errorHandler(Error::kPOPO__CAPRO_PROTOCOL_ERROR, nullptr, ErrorLevel::MODERATE);
+        }
+
+        return cxx::nullopt_t();
+    }
+    else if (((capro::CaproMessageType::OFFER == caProMessage.m_type)
+              || (capro::CaproMessageType::STOP_OFFER == caProMessage.m_type))
+             && (ConnectionState::NOT_CONNECTED == currentConnectionState))
+    {
+        // No state change
+        return cxx::nullopt_t();
+    }
+    else
+    {
+        errorHandler(Error::kPOPO__CAPRO_PROTOCOL_ERROR, nullptr, ErrorLevel::SEVERE);
+        return cxx::nullopt_t();
+    }
+}
+
+capro::CaproMessage ClientPortRouDi::createConnectMessage(const capro::CaproMessageType type) noexcept
+{
+    // the client provides its response queue, the server answers with its request queue
+    capro::CaproMessage caproMessage(type, this->getCaProServiceDescription());
+    caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
+    return caproMessage;
 }
 
 void ClientPortRouDi::releaseAllChunks() noexcept
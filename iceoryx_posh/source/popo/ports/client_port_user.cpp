@@ -40,29 +40,48 @@ ClientPortUser::MemberType_t* ClientPortUser::getMembers() noexcept
 }
 
 cxx::expected<RequestHeader*, AllocationError>
-ClientPortUser::allocateRequest(const uint32_t /*userPayloadSize*/) noexcept
+ClientPortUser::allocateRequest(const uint32_t userPayloadSize, const uint32_t userPayloadAlignment) noexcept
 {
-    return cxx::error<AllocationError>(AllocationError::RUNNING_OUT_OF_CHUNKS);
+    auto allocateResult = m_chunkSender.tryAllocate(
+        getUniqueID(), userPayloadSize, userPayloadAlignment, sizeof(RequestHeader), alignof(RequestHeader));
+
+    if (allocateResult.has_error())
+    {
+        return cxx::error<AllocationError>(allocateResult.get_error());
+    }
+
+    auto requestHeader = new (allocateResult.value()->userHeader())
+        RequestHeader(&getMembers()->m_chunkReceiverData, getMembers()->m_lastKnownClientQueueIndex);
+    requestHeader->setSequenceNumber(getMembers()->m_sequenceNumber++);
+    return cxx::success<RequestHeader*>(requestHeader);
 }
 
-void ClientPortUser::freeRequest(RequestHeader* const /*requestHeader*/) noexcept
+void ClientPortUser::freeRequest(RequestHeader* const requestHeader) noexcept
 {
-    /// @todo
+    m_chunkSender.release(requestHeader->getChunkHeader());
 }
 
-void ClientPortUser::sendRequest(RequestHeader* const /*requestHeader*/) noexcept
+void ClientPortUser::sendRequest(RequestHeader* const requestHeader) noexcept
 {
-    /// @todo
+    // the server queue is added and removed asynchronously by RouDi, without a connection there is just no queue to
+    // deliver to and the chunk is released when the next request is sent
+    m_chunkSender.send(requestHeader->getChunkHeader());
 }
 
 void ClientPortUser::connect() noexcept
 {
-    /// @todo
+    if (!getMembers()->m_connectRequested.load(std::memory_order_relaxed))
+    {
+        getMembers()->m_connectRequested.store(true, std::memory_order_relaxed);
+    }
 }
 
 void ClientPortUser::disconnect() noexcept
 {
-    /// @todo
+    if (getMembers()->m_connectRequested.load(std::memory_order_relaxed))
+    {
+        getMembers()->m_connectRequested.store(false, std::memory_order_relaxed);
+    }
 }
 
 ConnectionState ClientPortUser::getConnectionState() const noexcept
@@ -72,13 +91,25 @@ ConnectionState ClientPortUser::getConnectionState() const noexcept
 
 cxx::expected<cxx::optional<const ResponseHeader*>, ChunkReceiveResult> ClientPortUser::getResponse() noexcept
 {
-    /// @todo
-    return cxx::success<cxx::optional<const ResponseHeader*>>(cxx::nullopt_t());
+    auto getResult = m_chunkReceiver.tryGet();
+
+    if (getResult.has_error())
+    {
+        if (getResult.get_error() == ChunkReceiveResult::NO_CHUNK_AVAILABLE)
+        {
+            return cxx::success<cxx::optional<const ResponseHeader*>>(cxx::nullopt_t());
+        }
+        return cxx::error<ChunkReceiveResult>(getResult.get_error());
+    }
+
+    auto responseHeader = static_cast<const ResponseHeader*>(getResult.value()->userHeader());
+    getMembers()->m_lastKnownClientQueueIndex = responseHeader->getLastKnownClientQueueIndex();
+    return cxx::success<cxx::optional<const ResponseHeader*>>(responseHeader);
 }
 
-void ClientPortUser::releaseResponse(const ResponseHeader* const /*responseHeader*/) noexcept
+void ClientPortUser::releaseResponse(const ResponseHeader* const responseHeader) noexcept
 {
-    /// @todo
+    m_chunkReceiver.release(responseHeader->getChunkHeader());
 }
 
 bool ClientPortUser::hasNewResponses() const noexcept
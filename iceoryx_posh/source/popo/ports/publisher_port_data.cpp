@@ -31,6 +31,7 @@ PublisherPortData::PublisherPortData(const capro::ServiceDescription& serviceDes
           memoryManager, publisherOptions.subscriberTooSlowPolicy, publisherOptions.historyCapacity, memoryInfo)
     , m_offeringRequested(publisherOptions.offerOnCreate)
 {
+    m_chunkSenderData.m_isLatestValueProvided = publisherOptions.provideLatestValue;
 }
 
 } // namespace popo
@@ -72,6 +72,11 @@ cxx::optional<capro::CaproMessage> PublisherPortRouDi::tryGetCaProMessage() noex
         m_chunkSender.removeAllQueues();
 
         capro::CaproMessage caproMessage(capro::CaproMessageType::STOP_OFFER, this->getCaProServiceDescription());
+        // lets the subscribers which read the latest value identify the publisher which stops to provide it
+        if (getMembers()->m_chunkSenderData.m_isLatestValueProvided)
+        {
+            caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkSenderData.m_latestValue);
+        }
         return cxx::make_optional<capro::CaproMessage>(caproMessage);
     }
     else
@@ -89,7 +94,11 @@ PublisherPortRouDi::dispatchCaProMessageAndGetPossibleResponse(const capro::Capr
 
     if (getMembers()->m_offered.load(std::memory_order_relaxed))
     {
-        if (capro::CaproMessageType::SUB == caProMessage.m_type)
+        if (capro::CaproMessageSubType::FIELD == caProMessage.m_subType)
+        {
+            return dispatchLatestValueSubscription(caProMessage);
+        }
+        else if (capro::CaproMessageType::SUB == caProMessage.m_type)
         {
             const auto ret = m_chunkSender.tryAddQueue(
                 static_cast<PublisherPortData::ChunkQueueData_t*>(caProMessage.m_chunkQueueData),
@@ -117,6 +126,34 @@ PublisherPortRouDi::dispatchCaProMessageAndGetPossibleResponse(const capro::Capr
     return cxx::make_optional<capro::CaproMessage>(responseMessage);
 }
 
+cxx::optional<capro::CaproMessage>
+PublisherPortRouDi::dispatchLatestValueSubscription(const capro::CaproMessage& caProMessage) noexcept
+{
+    capro::CaproMessage responseMessage(
+        capro::CaproMessageType::NACK, this->getCaProServiceDescription(), capro::CaproMessageSubType::FIELD);
+
+    // the subscribers of the latest value do not have a queue at the publisher; a subscription hands out the latest
+    // value with the ACK and an unsubscription has nothing to remove
+    if (capro::CaproMessageType::SUB == caProMessage.m_type)
+    {
+        if (getMembers()->m_chunkSenderData.m_isLatestValueProvided)
+        {
+            responseMessage.m_type = capro::CaproMessageType::ACK;
+            responseMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkSenderData.m_latestValue);
+        }
+    }
+    else if (capro::CaproMessageType::UNSUB == caProMessage.m_type)
+    {
+        responseMessage.m_type = capro::CaproMessageType::ACK;
+    }
+    else
+    {
+        errorHandler(Error::kPOPO__CAPRO_PROTOCOL_ERROR, nullptr, ErrorLevel::SEVERE);
+    }
+
+    return cxx::make_optional<capro::CaproMessage>(responseMessage);
+}
+
 void PublisherPortRouDi::releaseAllChunks() noexcept
 {
     m_chunkSender.releaseAll();
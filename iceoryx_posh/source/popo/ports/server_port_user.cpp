@@ -39,15 +39,26 @@ ServerPortUser::MemberType_t* ServerPortUser::getMembers() noexcept
     return reinterpret_cast<MemberType_t*>(BasePort::getMembers());
 }
 
-
 cxx::expected<cxx::optional<const RequestHeader*>, ChunkReceiveResult> ServerPortUser::getRequest() noexcept
 {
-    return cxx::success<cxx::optional<const RequestHeader*>>(cxx::nullopt_t());
+    auto getResult = m_chunkReceiver.tryGet();
+
+    if (getResult.has_error())
+    {
+        if (getResult.get_error() == ChunkReceiveResult::NO_CHUNK_AVAILABLE)
+        {
+            return cxx::success<cxx::optional<const RequestHeader*>>(cxx::nullopt_t());
+        }
+        return cxx::error<ChunkReceiveResult>(getResult.get_error());
+    }
+
+    return cxx::success<cxx::optional<const RequestHeader*>>(
+        static_cast<const RequestHeader*>(getResult.value()->userHeader()));
 }
 
-void ServerPortUser::releaseRequest(const RequestHeader* const /*requestHeader*/) noexcept
+void ServerPortUser::releaseRequest(const RequestHeader* const requestHeader) noexcept
 {
-    /// @todo
+    m_chunkReceiver.release(requestHeader->getChunkHeader());
 }
 
 bool ServerPortUser::hasNewRequests() const noexcept
@@ -61,20 +72,42 @@ bool ServerPortUser::hasLostRequestsSinceLastCall() noexcept
 }
 
 cxx::expected<ResponseHeader*, AllocationError>
-ServerPortUser::allocateResponse(const uint32_t /*userPayloadSize*/) noexcept
+ServerPortUser::allocateResponse(const RequestHeader* const requestHeader,
+                                 const uint32_t userPayloadSize,
+                                 const uint32_t userPayloadAlignment) noexcept
 {
-    /// @todo
-    return cxx::error<AllocationError>(AllocationError::RUNNING_OUT_OF_CHUNKS);
+    auto allocateResult = m_chunkSender.tryAllocate(
+        getUniqueID(), userPayloadSize, userPayloadAlignment, sizeof(ResponseHeader), alignof(ResponseHeader));
+
+    if (allocateResult.has_error())
+    {
+        return cxx::error<AllocationError>(allocateResult.get_error());
+    }
+
+    // the index is looked up once per response and passed back to the client, which provides it with the next request
+    const auto clientQueueIndex =
+        m_chunkSender
+            .getQueueIndex(requestHeader->getUniqueClientQueueId(), requestHeader->getLastKnownClientQueueIndex())
+            .value_or(RPCBaseHeader::UNKNOWN_CLIENT_QUEUE_INDEX);
+
+    auto responseHeader = new (allocateResult.value()->userHeader())
+        ResponseHeader(requestHeader->getClientQueueData(),
+                       requestHeader->getUniqueClientQueueId(),
+                       clientQueueIndex,
+                       requestHeader->getSequenceNumber());
+    return cxx::success<ResponseHeader*>(responseHeader);
 }
 
-void ServerPortUser::freeResponse(ResponseHeader* const /*responseHeader*/) noexcept
+void ServerPortUser::freeResponse(ResponseHeader* const responseHeader) noexcept
 {
-    /// @todo
+    m_chunkSender.release(responseHeader->getChunkHeader());
 }
 
-void ServerPortUser::sendResponse(ResponseHeader* const /*responseHeader*/) noexcept
+bool ServerPortUser::sendResponse(ResponseHeader* const responseHeader) noexcept
 {
-    /// @todo
+    return m_chunkSender.sendToQueue(responseHeader->getChunkHeader(),
+                                     responseHeader->getUniqueClientQueueId(),
+                                     responseHeader->getLastKnownClientQueueIndex());
 }
 
 void ServerPortUser::offer() noexcept
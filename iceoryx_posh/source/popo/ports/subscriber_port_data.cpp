@@ -31,8 +31,12 @@ SubscriberPortData::SubscriberPortData(const capro::ServiceDescription& serviceD
     , m_chunkReceiverData(queueType, subscriberOptions.queueFullPolicy, memoryInfo)
     , m_historyRequest(subscriberOptions.historyRequest)
     , m_subscribeRequested(subscriberOptions.subscribeOnCreate)
+    , m_isLatestValueOnly(subscriberOptions.latestValueOnly)
 {
     m_chunkReceiverData.m_queue.setCapacity(subscriberOptions.queueCapacity);
+    m_chunkReceiverData.m_userHeaderFilter = subscriberOptions.userHeaderFilter;
+    m_chunkReceiverData.m_deliveryRateLimiter.setLimits(subscriberOptions.deliverEveryNthSample,
+                                                        subscriberOptions.minDeliveryInterval);
 }
 
 } // namespace popo
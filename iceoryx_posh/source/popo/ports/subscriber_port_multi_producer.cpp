@@ -37,18 +37,16 @@ cxx::optional<capro::CaproMessage> SubscriberPortMultiProducer::tryGetCaProMessa
     {
         getMembers()->m_subscriptionState.store(SubscribeState::SUBSCRIBED, std::memory_order_relaxed);
 
-        capro::CaproMessage caproMessage(capro::CaproMessageType::SUB, BasePort::getMembers()->m_serviceDescription);
-        caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
-        caproMessage.m_historyCapacity = getMembers()->m_historyRequest;
+        auto caproMessage = createSubscriptionMessage(capro::CaproMessageType::SUB);
 
         return cxx::make_optional<capro::CaproMessage>(caproMessage);
     }
     else if (!currentSubscribeRequest && (SubscribeState::SUBSCRIBED == currentSubscriptionState))
     {
         getMembers()->m_subscriptionState.store(SubscribeState::NOT_SUBSCRIBED, std::memory_order_relaxed);
+        disconnectLatestValue();
 
-        capro::CaproMessage caproMessage(capro::CaproMessageType::UNSUB, BasePort::getMembers()->m_serviceDescription);
-        caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
+        auto caproMessage = createSubscriptionMessage(capro::CaproMessageType::UNSUB);
 
         return cxx::make_optional<capro::CaproMessage>(caproMessage);
     }
@@ -67,9 +65,7 @@ cxx::optional<capro::CaproMessage> SubscriberPortMultiProducer::dispatchCaProMes
     if ((capro::CaproMessageType::OFFER == caProMessage.m_type)
         && (SubscribeState::SUBSCRIBED == currentSubscriptionState))
     {
-        capro::CaproMessage caproMessage(capro::CaproMessageType::SUB, BasePort::getMembers()->m_serviceDescription);
-        caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
-        caproMessage.m_historyCapacity = getMembers()->m_historyRequest;
+        auto caproMessage = createSubscriptionMessage(capro::CaproMessageType::SUB);
 
         return cxx::make_optional<capro::CaproMessage>(caproMessage);
     }
@@ -79,11 +75,27 @@ cxx::optional<capro::CaproMessage> SubscriberPortMultiProducer::dispatchCaProMes
         // No state change
         return cxx::nullopt_t();
     }
-    else if ((capro::CaproMessageType::ACK == caProMessage.m_type)
-             || (capro::CaproMessageType::NACK == caProMessage.m_type)
-             || (capro::CaproMessageType::STOP_OFFER == caProMessage.m_type))
+    else if (capro::CaproMessageType::ACK == caProMessage.m_type)
     {
-        // we ignore all these messages for multi-producer
+        if (SubscribeState::SUBSCRIBED == currentSubscriptionState)
+        {
+            connectLatestValue(caProMessage);
+        }
+        return cxx::nullopt_t();
+    }
+    else if (capro::CaproMessageType::STOP_OFFER == caProMessage.m_type)
+    {
+        // only forget the latest value if it belongs to the publisher which stops offering
+        if ((caProMessage.m_chunkQueueData != nullptr)
+            && (caProMessage.m_chunkQueueData == static_cast<LatestValueData*>(getMembers()->m_latestValue)))
+        {
+            disconnectLatestValue();
+        }
+        return cxx::nullopt_t();
+    }
+    else if (capro::CaproMessageType::NACK == caProMessage.m_type)
+    {
+        // we ignore NACK messages for multi-producer
         return cxx::nullopt_t();
     }
     else
@@ -42,6 +42,38 @@ SubscriberPortRouDi::MemberType_t* SubscriberPortRouDi::getMembers() noexcept
     return reinterpret_cast<MemberType_t*>(BasePort::getMembers());
 }
 
+capro::CaproMessage SubscriberPortRouDi::createSubscriptionMessage(const capro::CaproMessageType type) noexcept
+{
+    capro::CaproMessage caproMessage(type, BasePort::getMembers()->m_serviceDescription);
+    caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
+    caproMessage.m_historyCapacity = getMembers()->m_historyRequest;
+    if (getMembers()->m_isLatestValueOnly)
+    {
+        caproMessage.m_subType = capro::CaproMessageSubType::FIELD;
+    }
+    return caproMessage;
+}
+
+void SubscriberPortRouDi::connectLatestValue(const capro::CaproMessage& caProMessage) noexcept
+{
+    if (getMembers()->m_isLatestValueOnly && (capro::CaproMessageSubType::FIELD == caProMessage.m_subType))
+    {
+        getMembers()->m_latestValue = static_cast<LatestValueData*>(caProMessage.m_chunkQueueData);
+    }
+}
+
+void SubscriberPortRouDi::disconnectLatestValue() noexcept
+{
+    getMembers()->m_latestValue = nullptr;
+    // pairs with the fence in SubscriberPortUser::peekLatestChunk, see isPeekingLatestValue
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+bool SubscriberPortRouDi::isPeekingLatestValue() const noexcept
+{
+    return getMembers()->m_numberOfLatestValuePeeks.load(std::memory_order_acquire) > 0U;
+}
+
 void SubscriberPortRouDi::releaseAllChunks() noexcept
 {
     m_chunkReceiver.releaseAll();
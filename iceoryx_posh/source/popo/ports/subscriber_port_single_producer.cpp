@@ -37,9 +37,7 @@ cxx::optional<capro::CaproMessage> SubscriberPortSingleProducer::tryGetCaProMess
     {
         getMembers()->m_subscriptionState.store(SubscribeState::SUBSCRIBE_REQUESTED, std::memory_order_relaxed);
 
-        capro::CaproMessage caproMessage(capro::CaproMessageType::SUB, BasePort::getMembers()->m_serviceDescription);
-        caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
-        caproMessage.m_historyCapacity = getMembers()->m_historyRequest;
+        auto caproMessage = createSubscriptionMessage(capro::CaproMessageType::SUB);
 
         return cxx::make_optional<capro::CaproMessage>(caproMessage);
     }
@@ -47,8 +45,7 @@ cxx::optional<capro::CaproMessage> SubscriberPortSingleProducer::tryGetCaProMess
     {
         getMembers()->m_subscriptionState.store(SubscribeState::UNSUBSCRIBE_REQUESTED, std::memory_order_relaxed);
 
-        capro::CaproMessage caproMessage(capro::CaproMessageType::UNSUB, BasePort::getMembers()->m_serviceDescription);
-        caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
+        auto caproMessage = createSubscriptionMessage(capro::CaproMessageType::UNSUB);
 
         return cxx::make_optional<capro::CaproMessage>(caproMessage);
     }
@@ -74,9 +71,7 @@ cxx::optional<capro::CaproMessage> SubscriberPortSingleProducer::dispatchCaProMe
     {
         getMembers()->m_subscriptionState.store(SubscribeState::SUBSCRIBE_REQUESTED, std::memory_order_relaxed);
 
-        capro::CaproMessage caproMessage(capro::CaproMessageType::SUB, BasePort::getMembers()->m_serviceDescription);
-        caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
-        caproMessage.m_historyCapacity = getMembers()->m_historyRequest;
+        auto caproMessage = createSubscriptionMessage(capro::CaproMessageType::SUB);
 
         return cxx::make_optional<capro::CaproMessage>(caproMessage);
     }
@@ -84,6 +79,7 @@ cxx::optional<capro::CaproMessage> SubscriberPortSingleProducer::dispatchCaProMe
              && (SubscribeState::SUBSCRIBED == currentSubscriptionState))
     {
         getMembers()->m_subscriptionState.store(SubscribeState::WAIT_FOR_OFFER, std::memory_order_relaxed);
+        disconnectLatestValue();
 
         return cxx::nullopt_t();
     }
@@ -91,10 +87,12 @@ cxx::optional<capro::CaproMessage> SubscriberPortSingleProducer::dispatchCaProMe
     {
         if (SubscribeState::SUBSCRIBE_REQUESTED == currentSubscriptionState)
         {
+            connectLatestValue(caProMessage);
             getMembers()->m_subscriptionState.store(SubscribeState::SUBSCRIBED, std::memory_order_relaxed);
         }
         else if (SubscribeState::UNSUBSCRIBE_REQUESTED == currentSubscriptionState)
         {
+            disconnectLatestValue();
             getMembers()->m_subscriptionState.store(SubscribeState::NOT_SUBSCRIBED, std::memory_order_relaxed);
         }
         else
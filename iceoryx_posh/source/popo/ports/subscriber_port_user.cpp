@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_reader.hpp"
 
 namespace iox
 {
@@ -89,6 +90,24 @@ bool SubscriberPortUser::hasLostChunksSinceLastCall() noexcept
     return m_chunkReceiver.hasLostChunks();
 }
 
+mepoo::SharedChunk SubscriberPortUser::peekLatestChunk() noexcept
+{
+    // the peek is announced before the pointer is loaded; together with the fence in disconnectLatestValue this
+    // guarantees that RouDi either sees the peek or this subscriber sees that the latest value is gone
+    getMembers()->m_numberOfLatestValuePeeks.fetch_add(1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    mepoo::SharedChunk chunk;
+    LatestValueData* latestValue = getMembers()->m_latestValue;
+    if (latestValue != nullptr)
+    {
+        chunk = LatestValueReader(latestValue).peek();
+    }
+
+    getMembers()->m_numberOfLatestValuePeeks.fetch_sub(1U, std::memory_order_release);
+    return chunk;
+}
+
 void SubscriberPortUser::setConditionVariable(ConditionVariableData& conditionVariableData,
                                               const uint64_t notificationIndex) noexcept
 {
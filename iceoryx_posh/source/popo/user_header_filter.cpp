@@ -0,0 +1,66 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/user_header_filter.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint32_t UserHeaderFilter::MAX_FIELD_SIZE;
+
+UserHeaderFilter::UserHeaderFilter(const cxx::Serialization& serialization) noexcept
+{
+    UserHeaderFilter filter;
+    if (serialization.extract(filter.m_offset, filter.m_size, filter.m_value, filter.m_mask)
+        && filter.m_size <= MAX_FIELD_SIZE)
+    {
+        *this = filter;
+    }
+}
+
+bool UserHeaderFilter::isEnabled() const noexcept
+{
+    return m_size != 0U;
+}
+
+bool UserHeaderFilter::matches(const mepoo::ChunkHeader& chunkHeader) const noexcept
+{
+    if (!isEnabled())
+    {
+        return true;
+    }
+
+    // the filter is located in the memory of the subscriber, therefore the bounds are checked for every chunk
+    const auto userHeader = static_cast<const uint8_t*>(chunkHeader.userHeader());
+    if (userHeader == nullptr || m_size > MAX_FIELD_SIZE
+        || static_cast<uint64_t>(m_offset) + m_size > chunkHeader.userHeaderSize())
+    {
+        return false;
+    }
+
+    uint64_t field{0U};
+    std::memcpy(&field, userHeader + m_offset, m_size);
+    return (field & m_mask) == (m_value & m_mask);
+}
+
+UserHeaderFilter::operator cxx::Serialization() const noexcept
+{
+    return cxx::Serialization::create(m_offset, m_size, m_value, m_mask);
+}
+
+} // namespace popo
+} // namespace iox
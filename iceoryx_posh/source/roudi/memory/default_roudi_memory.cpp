@@ -25,20 +25,36 @@ namespace iox
 namespace roudi
 {
 DefaultRouDiMemory::DefaultRouDiMemory(const RouDiConfig_t& roudiConfig) noexcept
-    : m_introspectionMemPoolBlock(introspectionMemPoolConfig())
-    , m_segmentManagerBlock(roudiConfig)
+    : m_processScope(roudiConfig.m_processScope)
+    , m_introspectionMemPoolBlock(introspectionMemPoolConfig())
+    , m_segmentManagerBlock(roudiConfig, roudiConfig.m_processScope)
     , m_managementShm(SHM_NAME, posix::AccessMode::READ_WRITE, posix::OpenMode::PURGE_AND_CREATE)
 
 {
-    m_managementShm.addMemoryBlock(&m_introspectionMemPoolBlock).or_else([](auto) {
+    managementMemoryProvider().addMemoryBlock(&m_introspectionMemPoolBlock).or_else([](auto) {
         errorHandler(
             Error::kROUDI__DEFAULT_ROUDI_MEMORY_FAILED_TO_ADD_INTROSPECTION_MEMORY_BLOCK, nullptr, ErrorLevel::FATAL);
     });
-    m_managementShm.addMemoryBlock(&m_segmentManagerBlock).or_else([](auto) {
+    managementMemoryProvider().addMemoryBlock(&m_segmentManagerBlock).or_else([](auto) {
         errorHandler(
             Error::kROUDI__DEFAULT_ROUDI_MEMORY_FAILED_TO_ADD_SEGMENT_MANAGER_MEMORY_BLOCK, nullptr, ErrorLevel::FATAL);
     });
 }
+
+MemoryProvider& DefaultRouDiMemory::managementMemoryProvider() noexcept
+{
+    return const_cast<MemoryProvider&>(static_cast<const DefaultRouDiMemory*>(this)->managementMemoryProvider());
+}
+
+const MemoryProvider& DefaultRouDiMemory::managementMemoryProvider() const noexcept
+{
+    if (m_processScope == ProcessScope::SINGLE_PROCESS)
+    {
+        return m_singleProcessManagementMemory;
+    }
+    return m_managementShm;
+}
+
 mepoo::MePooConfig DefaultRouDiMemory::introspectionMemPoolConfig() const
 {
     constexpr uint32_t ALIGNMENT{mepoo::MemPool::CHUNK_MEMORY_ALIGNMENT};
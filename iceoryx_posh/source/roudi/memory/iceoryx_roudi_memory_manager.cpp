@@ -24,11 +24,11 @@ namespace roudi
 IceOryxRouDiMemoryManager::IceOryxRouDiMemoryManager(const RouDiConfig_t& roudiConfig) noexcept
     : m_defaultMemory(roudiConfig)
 {
-    m_defaultMemory.m_managementShm.addMemoryBlock(&m_portPoolBlock).or_else([](auto) {
+    m_defaultMemory.managementMemoryProvider().addMemoryBlock(&m_portPoolBlock).or_else([](auto) {
         errorHandler(
             Error::kICEORYX_ROUDI_MEMORY_MANAGER__FAILED_TO_ADD_PORTPOOL_MEMORY_BLOCK, nullptr, ErrorLevel::FATAL);
     });
-    m_memoryManager.addMemoryProvider(&m_defaultMemory.m_managementShm).or_else([](auto) {
+    m_memoryManager.addMemoryProvider(&m_defaultMemory.managementMemoryProvider()).or_else([](auto) {
         errorHandler(
             Error::kICEORYX_ROUDI_MEMORY_MANAGER__FAILED_TO_ADD_MANAGEMENT_MEMORY_BLOCK, nullptr, ErrorLevel::FATAL);
     });
@@ -40,7 +40,7 @@ cxx::expected<RouDiMemoryManagerError> IceOryxRouDiMemoryManager::createAndAnnou
     auto portPool = m_portPoolBlock.portPool();
     if (!result.has_error() && portPool.has_value())
     {
-        m_portPool.emplace(*portPool.value());
+        m_portPool.emplace(*portPool.value(), m_defaultMemory.m_processScope);
     }
     return result;
 }
@@ -50,9 +50,9 @@ cxx::expected<RouDiMemoryManagerError> IceOryxRouDiMemoryManager::destroyMemory(
     return m_memoryManager.destroyMemory();
 }
 
-const PosixShmMemoryProvider* IceOryxRouDiMemoryManager::mgmtMemoryProvider() const noexcept
+const MemoryProvider* IceOryxRouDiMemoryManager::mgmtMemoryProvider() const noexcept
 {
-    return &m_defaultMemory.m_managementShm;
+    return &m_defaultMemory.managementMemoryProvider();
 }
 
 cxx::optional<PortPool*> IceOryxRouDiMemoryManager::portPool() noexcept
@@ -23,8 +23,10 @@ namespace iox
 {
 namespace roudi
 {
-MemPoolSegmentManagerMemoryBlock::MemPoolSegmentManagerMemoryBlock(const mepoo::SegmentConfig& segmentConfig) noexcept
+MemPoolSegmentManagerMemoryBlock::MemPoolSegmentManagerMemoryBlock(const mepoo::SegmentConfig& segmentConfig,
+                                                                   const ProcessScope processScope) noexcept
     : m_segmentConfig(segmentConfig)
+    , m_processScope(processScope)
 {
 }
 
@@ -49,7 +51,7 @@ void MemPoolSegmentManagerMemoryBlock::onMemoryAvailable(cxx::not_null<void*> me
 {
     posix::Allocator allocator(memory, size());
     auto segmentManager = allocator.allocate(sizeof(mepoo::SegmentManager<>), alignof(mepoo::SegmentManager<>));
-    m_segmentManager = new (segmentManager) mepoo::SegmentManager<>(m_segmentConfig, &allocator);
+    m_segmentManager = new (segmentManager) mepoo::SegmentManager<>(m_segmentConfig, &allocator, m_processScope);
 }
 
 void MemPoolSegmentManagerMemoryBlock::destroy() noexcept
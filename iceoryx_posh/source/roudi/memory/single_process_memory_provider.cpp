@@ -0,0 +1,69 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/roudi/memory/single_process_memory_provider.hpp"
+
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+SingleProcessMemoryProvider::~SingleProcessMemoryProvider() noexcept
+{
+    if (isAvailable())
+    {
+        destroy().or_else([](auto) { LogWarn() << "failed to cleanup single process memory provider resources"; });
+    }
+}
+
+cxx::expected<void*, MemoryProviderError> SingleProcessMemoryProvider::createMemory(const uint64_t size,
+                                                                                    const uint64_t alignment) noexcept
+{
+    if (alignment > posix::pageSize())
+    {
+        return cxx::error<MemoryProviderError>(MemoryProviderError::MEMORY_ALIGNMENT_EXCEEDS_PAGE_SIZE);
+    }
+
+    posix::SharedMemoryObject::create(posix::CreateUnnamedSingleProcessMemory, size)
+        .and_then([this](auto& memoryObject) {
+            memoryObject.finalizeAllocation();
+            m_memoryObject.emplace(std::move(memoryObject));
+        });
+
+    if (!m_memoryObject.has_value())
+    {
+        return cxx::error<MemoryProviderError>(MemoryProviderError::MEMORY_CREATION_FAILED);
+    }
+
+    auto baseAddress = m_memoryObject->getBaseAddress();
+    if (baseAddress == nullptr)
+    {
+        return cxx::error<MemoryProviderError>(MemoryProviderError::MEMORY_CREATION_FAILED);
+    }
+
+    return cxx::success<void*>(baseAddress);
+}
+
+cxx::expected<MemoryProviderError> SingleProcessMemoryProvider::destroyMemory() noexcept
+{
+    m_memoryObject.reset();
+    return cxx::success<void>();
+}
+
+} // namespace roudi
+} // namespace iox
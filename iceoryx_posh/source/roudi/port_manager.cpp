@@ -20,10 +20,12 @@
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_writer.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/runtime/node.hpp"
 
+#include <algorithm>
 #include <cstdint>
 
 namespace iox
@@ -133,9 +135,16 @@ void PortManager::doDiscovery() noexcept
 
 void PortManager::handlePublisherPorts() noexcept
 {
+    removePublisherPortsWithoutPeekingSubscribers();
+
     // get the changes of publisher port offer state
     for (auto publisherPortData : m_portPool->getPublisherPortDataList())
     {
+        if (isPublisherPortPendingRemoval(publisherPortData))
+        {
+            continue;
+        }
+
         PublisherPortRouDiType publisherPort(publisherPortData);
 
         doDiscoveryForPublisherPort(publisherPort);
@@ -477,60 +486,41 @@ void PortManager::makeAllPublisherPortsToStopOffer() noexcept
 
 void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcept
 {
-    for (auto port : m_portPool->getPublisherPortDataList())
+    for (auto port : m_portPool->getPublisherPortDataList(runtimeName))
     {
-        PublisherPortRouDiType sender(port);
-        if (runtimeName == sender.getRuntimeName())
+        if (!isPublisherPortPendingRemoval(port))
         {
             destroyPublisherPort(port);
         }
     }
 
-    for (auto port : m_portPool->getSubscriberPortDataList())
+    for (auto port : m_portPool->getSubscriberPortDataList(runtimeName))
     {
-        SubscriberPortUserType subscriber(port);
-        if (runtimeName == subscriber.getRuntimeName())
-        {
-            destroySubscriberPort(port);
-        }
+        destroySubscriberPort(port);
     }
 
-    for (auto port : m_portPool->getInterfacePortDataList())
+    for (auto port : m_portPool->getInterfacePortDataList(runtimeName))
     {
-        popo::InterfacePort interface(port);
-        if (runtimeName == interface.getRuntimeName())
-        {
-            m_portPool->removeInterfacePort(port);
-            LogDebug() << "Deleted Interface of application " << runtimeName;
-        }
+        m_portPool->removeInterfacePort(port);
+        LogDebug() << "Deleted Interface of application " << runtimeName;
     }
 
-    for (auto port : m_portPool->getApplicationPortDataList())
+    for (auto port : m_portPool->getApplicationPortDataList(runtimeName))
     {
-        popo::ApplicationPort application(port);
-        if (runtimeName == application.getRuntimeName())
-        {
-            m_portPool->removeApplicationPort(port);
-            LogDebug() << "Deleted ApplicationPort of application " << runtimeName;
-        }
+        m_portPool->removeApplicationPort(port);
+        LogDebug() << "Deleted ApplicationPort of application " << runtimeName;
     }
 
-    for (auto nodeData : m_portPool->getNodeDataList())
+    for (auto nodeData : m_portPool->getNodeDataList(runtimeName))
     {
-        if (runtimeName == nodeData->m_runtimeName)
-        {
-            m_portPool->removeNodeData(nodeData);
-            LogDebug() << "Deleted node of application " << runtimeName;
-        }
+        m_portPool->removeNodeData(nodeData);
+        LogDebug() << "Deleted node of application " << runtimeName;
     }
 
-    for (auto conditionVariableData : m_portPool->getConditionVariableDataList())
+    for (auto conditionVariableData : m_portPool->getConditionVariableDataList(runtimeName))
     {
-        if (runtimeName == conditionVariableData->m_runtimeName)
-        {
-            m_portPool->removeConditionVariableData(conditionVariableData);
-            LogDebug() << "Deleted condition variable of application" << runtimeName;
-        }
+        m_portPool->removeConditionVariableData(conditionVariableData);
+        LogDebug() << "Deleted condition variable of application" << runtimeName;
     }
 }
 
@@ -543,6 +533,11 @@ void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* con
     publisherPortRoudi.releaseAllChunks();
     publisherPortUser.stopOffer();
 
+    // the chunks which are still held by subscribers keep counting against the quota until they are released
+    auto& chunkSenderData = publisherPortData->m_chunkSenderData;
+    chunkSenderData.m_memoryMgr->releaseChunkQuota(chunkSenderData.m_chunkQuota);
+    chunkSenderData.m_chunkQuota = mepoo::MemoryManager::NO_CHUNK_QUOTA;
+
     // process STOP_OFFER for this publisher in RouDi and distribute it
     publisherPortRoudi.tryGetCaProMessage().and_then([this, &publisherPortRoudi](auto caproMessage) {
         cxx::Ensures(caproMessage.m_type == capro::CaproMessageType::STOP_OFFER);
@@ -556,12 +551,71 @@ void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* con
 
     m_portIntrospection.removePublisher(publisherPortUser);
 
+    // the latest value is part of the publisher port; a subscriber in another process which loaded it before the
+    // STOP_OFFER disconnected it could still be peeking, therefore the port must stay in the pool until it is done
+    if (hasSubscribersPeekingLatestValue(publisherPortData))
+    {
+        m_publisherPortsPendingRemoval.push_back(publisherPortData);
+        LogDebug() << "Destroyed publisher port, it is removed once no subscriber peeks its latest value";
+        return;
+    }
+
     // delete publisher port from list after STOP_OFFER was processed
     m_portPool->removePublisherPort(publisherPortData);
 
     LogDebug() << "Destroyed publisher port";
 }
 
+bool PortManager::hasSubscribersPeekingLatestValue(
+    PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept
+{
+    if (!publisherPortData->m_chunkSenderData.m_isLatestValueProvided)
+    {
+        return false;
+    }
+
+    PublisherPortRouDiType publisherPort(publisherPortData);
+    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
+    {
+        SubscriberPortType subscriberPort(subscriberPortData);
+        if (subscriberPort.getCaProServiceDescription() == publisherPort.getCaProServiceDescription()
+            && subscriberPort.isPeekingLatestValue())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PortManager::removePublisherPortsWithoutPeekingSubscribers() noexcept
+{
+    for (auto iter = m_publisherPortsPendingRemoval.begin(); iter != m_publisherPortsPendingRemoval.end();)
+    {
+        auto publisherPortData = *iter;
+        if (hasSubscribersPeekingLatestValue(publisherPortData))
+        {
+            ++iter;
+        }
+        else
+        {
+            // release the chunks of the latest value which were skipped since a subscriber was still peeking them
+            popo::LatestValueWriter(&publisherPortData->m_chunkSenderData.m_latestValue).releaseAll();
+            m_portPool->removePublisherPort(publisherPortData);
+            // the following elements are moved to the position of the erased one
+            m_publisherPortsPendingRemoval.erase(iter);
+
+            LogDebug() << "Removed destroyed publisher port after the last peek of its latest value";
+        }
+    }
+}
+
+bool PortManager::isPublisherPortPendingRemoval(
+    const PublisherPortRouDiType::MemberType_t* const portData) const noexcept
+{
+    return std::find(m_publisherPortsPendingRemoval.begin(), m_publisherPortsPendingRemoval.end(), portData)
+           != m_publisherPortsPendingRemoval.end();
+}
+
 void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept
 {
     // create temporary subscriber ports to orderly shut this subscriber down
@@ -642,6 +696,8 @@ PortManager::acquirePublisherPortData(const capro::ServiceDescription& service,
         auto publisherPortData = maybePublisherPortData.value();
         if (publisherPortData)
         {
+            publisherPortData->m_chunkSenderData.m_chunkQuota = payloadDataSegmentMemoryManager->acquireChunkQuota(
+                {publisherOptions.maxChunksInUse, publisherOptions.reservedChunks});
             m_portIntrospection.addPublisher(*publisherPortData);
 
             // we do discovery here for trying to connect the waiting subscribers if offer on create is desired
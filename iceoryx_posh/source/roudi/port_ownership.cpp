@@ -0,0 +1,81 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/port_ownership.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+constexpr PortOwnerRegistry::owner_t PortOwnerRegistry::UNTRACKED_OWNER;
+
+PortOwnerRegistry::PortOwnerRegistry() noexcept
+{
+    // the ids are handed out in ascending order
+    for (owner_t owner = MAX_PORT_OWNERS; owner > 0U; --owner)
+    {
+        m_freeOwners.emplace_back(owner - 1U);
+    }
+    for (auto& numberOfReferences : m_numberOfReferences)
+    {
+        numberOfReferences = 0U;
+    }
+}
+
+PortOwnerRegistry::owner_t PortOwnerRegistry::acquire(const RuntimeName_t& runtimeName) noexcept
+{
+    auto maybeOwner = m_ownerIndex.find(runtimeName);
+    if (maybeOwner.has_value())
+    {
+        ++m_numberOfReferences[maybeOwner.value()];
+        return maybeOwner.value();
+    }
+
+    if (m_freeOwners.empty())
+    {
+        return UNTRACKED_OWNER;
+    }
+
+    const owner_t owner = m_freeOwners.back();
+    m_freeOwners.pop_back();
+    m_ownerIndex.insert(runtimeName, owner);
+    m_ownerNames[owner] = runtimeName;
+    m_numberOfReferences[owner] = 1U;
+    return owner;
+}
+
+void PortOwnerRegistry::release(const owner_t owner) noexcept
+{
+    if (owner >= MAX_PORT_OWNERS || m_numberOfReferences[owner] == 0U)
+    {
+        return;
+    }
+
+    --m_numberOfReferences[owner];
+    if (m_numberOfReferences[owner] == 0U)
+    {
+        m_ownerIndex.erase(m_ownerNames[owner]);
+        m_freeOwners.emplace_back(owner);
+    }
+}
+
+cxx::optional<PortOwnerRegistry::owner_t> PortOwnerRegistry::find(const RuntimeName_t& runtimeName) const noexcept
+{
+    return m_ownerIndex.find(runtimeName);
+}
+
+} // namespace roudi
+} // namespace iox
@@ -23,8 +23,9 @@ namespace iox
 {
 namespace roudi
 {
-PortPool::PortPool(PortPoolData& portPoolData) noexcept
+PortPool::PortPool(PortPoolData& portPoolData, const ProcessScope processScope) noexcept
     : m_portPoolData(&portPoolData)
+    , m_processScope(processScope)
 {
 }
 
@@ -49,12 +50,36 @@ PortPool::getConditionVariableDataList() noexcept
     return m_portPoolData->m_conditionVariableMembers.content();
 }
 
+cxx::vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER>
+PortPool::getInterfacePortDataList(const RuntimeName_t& runtimeName) noexcept
+{
+    return getOwnedDataList(m_portPoolData->m_interfacePortMembers, m_interfaceOwnership, runtimeName);
+}
+
+cxx::vector<popo::ApplicationPortData*, MAX_PROCESS_NUMBER>
+PortPool::getApplicationPortDataList(const RuntimeName_t& runtimeName) noexcept
+{
+    return getOwnedDataList(m_portPoolData->m_applicationPortMembers, m_applicationOwnership, runtimeName);
+}
+
+cxx::vector<runtime::NodeData*, MAX_NODE_NUMBER> PortPool::getNodeDataList(const RuntimeName_t& runtimeName) noexcept
+{
+    return getOwnedDataList(m_portPoolData->m_nodeMembers, m_nodeOwnership, runtimeName);
+}
+
+cxx::vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>
+PortPool::getConditionVariableDataList(const RuntimeName_t& runtimeName) noexcept
+{
+    return getOwnedDataList(m_portPoolData->m_conditionVariableMembers, m_conditionVariableOwnership, runtimeName);
+}
+
 cxx::expected<popo::InterfacePortData*, PortPoolError>
 PortPool::addInterfacePort(const RuntimeName_t& runtimeName, const capro::Interfaces interface) noexcept
 {
     if (m_portPoolData->m_interfacePortMembers.hasFreeSpace())
     {
         auto interfacePortData = m_portPoolData->m_interfacePortMembers.insert(runtimeName, interface);
+        linkToOwner(m_portPoolData->m_interfacePortMembers, m_interfaceOwnership, interfacePortData, runtimeName);
         return cxx::success<popo::InterfacePortData*>(interfacePortData);
     }
     else
@@ -70,6 +95,8 @@ PortPool::addApplicationPort(const RuntimeName_t& runtimeName) noexcept
     if (m_portPoolData->m_applicationPortMembers.hasFreeSpace())
     {
         auto applicationPortData = m_portPoolData->m_applicationPortMembers.insert(runtimeName);
+        linkToOwner(
+            m_portPoolData->m_applicationPortMembers, m_applicationOwnership, applicationPortData, runtimeName);
         return cxx::success<popo::ApplicationPortData*>(applicationPortData);
     }
     else
@@ -86,6 +113,7 @@ cxx::expected<runtime::NodeData*, PortPoolError> PortPool::addNodeData(const Run
     if (m_portPoolData->m_nodeMembers.hasFreeSpace())
     {
         auto nodeData = m_portPoolData->m_nodeMembers.insert(runtimeName, nodeName, nodeDeviceIdentifier);
+        linkToOwner(m_portPoolData->m_nodeMembers, m_nodeOwnership, nodeData, runtimeName);
         return cxx::success<runtime::NodeData*>(nodeData);
     }
     else
@@ -100,7 +128,11 @@ PortPool::addConditionVariableData(const RuntimeName_t& runtimeName) noexcept
 {
     if (m_portPoolData->m_conditionVariableMembers.hasFreeSpace())
     {
-        auto conditionVariableData = m_portPoolData->m_conditionVariableMembers.insert(runtimeName);
+        auto conditionVariableData = m_portPoolData->m_conditionVariableMembers.insert(runtimeName, m_processScope);
+        linkToOwner(m_portPoolData->m_conditionVariableMembers,
+                    m_conditionVariableOwnership,
+                    conditionVariableData,
+                    runtimeName);
         return cxx::success<popo::ConditionVariableData*>(conditionVariableData);
     }
     else
@@ -112,21 +144,26 @@ PortPool::addConditionVariableData(const RuntimeName_t& runtimeName) noexcept
 
 void PortPool::removeInterfacePort(popo::InterfacePortData* const portData) noexcept
 {
+    unlinkFromOwner(m_portPoolData->m_interfacePortMembers, m_interfaceOwnership, portData);
     m_portPoolData->m_interfacePortMembers.erase(portData);
 }
 
 void PortPool::removeApplicationPort(popo::ApplicationPortData* const portData) noexcept
 {
+    unlinkFromOwner(m_portPoolData->m_applicationPortMembers, m_applicationOwnership, portData);
     m_portPoolData->m_applicationPortMembers.erase(portData);
 }
 
 void PortPool::removeNodeData(runtime::NodeData* const nodeData) noexcept
 {
+    unlinkFromOwner(m_portPoolData->m_nodeMembers, m_nodeOwnership, nodeData);
     m_portPoolData->m_nodeMembers.erase(nodeData);
 }
 
 void PortPool::removeConditionVariableData(popo::ConditionVariableData* const conditionVariableData) noexcept
 {
+    unlinkFromOwner(
+        m_portPoolData->m_conditionVariableMembers, m_conditionVariableOwnership, conditionVariableData);
     m_portPoolData->m_conditionVariableMembers.erase(conditionVariableData);
 }
 
@@ -145,6 +182,18 @@ cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS> PortPool::getSub
     return m_portPoolData->m_subscriberPortMembers.content();
 }
 
+cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS>
+PortPool::getPublisherPortDataList(const RuntimeName_t& runtimeName) noexcept
+{
+    return getOwnedDataList(m_portPoolData->m_publisherPortMembers, m_publisherOwnership, runtimeName);
+}
+
+cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS>
+PortPool::getSubscriberPortDataList(const RuntimeName_t& runtimeName) noexcept
+{
+    return getOwnedDataList(m_portPoolData->m_subscriberPortMembers, m_subscriberOwnership, runtimeName);
+}
+
 cxx::expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
 PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
                            mepoo::MemoryManager* const memoryManager,
@@ -156,6 +205,7 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
     {
         auto publisherPortData = m_portPoolData->m_publisherPortMembers.insert(
             serviceDescription, runtimeName, memoryManager, publisherOptions, memoryInfo);
+        linkToOwner(m_portPoolData->m_publisherPortMembers, m_publisherOwnership, publisherPortData, runtimeName);
         return cxx::success<PublisherPortRouDiType::MemberType_t*>(publisherPortData);
     }
     else
@@ -175,6 +225,7 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
     {
         auto subscriberPortData = constructSubscriber<iox::build::CommunicationPolicy>(
             serviceDescription, runtimeName, subscriberOptions, memoryInfo);
+        linkToOwner(m_portPoolData->m_subscriberPortMembers, m_subscriberOwnership, subscriberPortData, runtimeName);
 
         return cxx::success<SubscriberPortType::MemberType_t*>(subscriberPortData);
     }
@@ -187,11 +238,13 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
 
 void PortPool::removePublisherPort(PublisherPortRouDiType::MemberType_t* const portData) noexcept
 {
+    unlinkFromOwner(m_portPoolData->m_publisherPortMembers, m_publisherOwnership, portData);
     m_portPoolData->m_publisherPortMembers.erase(portData);
 }
 
 void PortPool::removeSubscriberPort(SubscriberPortType::MemberType_t* const portData) noexcept
 {
+    unlinkFromOwner(m_portPoolData->m_subscriberPortMembers, m_subscriberOwnership, portData);
     m_portPoolData->m_subscriberPortMembers.erase(portData);
 }
 
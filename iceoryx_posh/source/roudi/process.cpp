@@ -19,6 +19,9 @@
 #include "iceoryx_hoofs/platform/types.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/internal/popo/ports/application_port.hpp"
+
+#include <algorithm>
 
 using namespace iox::units::duration_literals;
 namespace iox
@@ -71,7 +74,16 @@ void Process::setTimestamp(const mepoo::TimePointNs_t timestamp) noexcept
 
 mepoo::TimePointNs_t Process::getTimestamp() noexcept
 {
-    return m_timestamp;
+    if (m_applicationPortData == nullptr)
+    {
+        return m_timestamp;
+    }
+    return std::max(m_timestamp, popo::ApplicationPort(m_applicationPortData).getLastHeartbeat());
+}
+
+void Process::setApplicationPortData(popo::ApplicationPortData* const applicationPortData) noexcept
+{
+    m_applicationPortData = applicationPortData;
 }
 
 posix::PosixUser Process::getUser() const noexcept
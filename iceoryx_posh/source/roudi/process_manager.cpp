@@ -135,6 +135,7 @@ void ProcessManager::printWarningForRegisteredProcessesAndClearProcessList() noe
                   << "' is still running after SIGKILL was sent. RouDi is ignoring this process.";
     }
     m_processList.clear();
+    m_processIndex.clear();
 }
 
 bool ProcessManager::requestShutdownOfProcess(Process& process, ShutdownPolicy shutdownPolicy) noexcept
@@ -261,6 +262,9 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
         return false;
     }
     m_processList.emplace_back(name, pid, user, isMonitored, sessionId);
+    auto lastProcess = m_processList.end();
+    --lastProcess;
+    m_processIndex.insert(name, lastProcess);
 
     // send REG_ACK and BaseAddrString
     runtime::IpcMessage sendBuffer;
@@ -294,22 +298,18 @@ bool ProcessManager::unregisterProcess(const RuntimeName_t& name) noexcept
 
 bool ProcessManager::searchForProcessAndRemoveIt(const RuntimeName_t& name, const TerminationFeedback feedback) noexcept
 {
-    // we need to search for the process (currently linear search)
-    auto it = m_processList.begin();
-    while (it != m_processList.end())
+    auto maybeProcess = m_processIndex.find(name);
+    if (!maybeProcess.has_value())
     {
-        auto otherName = it->getName();
-        if (name == otherName)
-        {
-            if (removeProcessAndDeleteRespectiveSharedMemoryObjects(it, feedback))
-            {
-                LogDebug() << "Removed existing application " << name;
-            }
-            return true; // we can assume there are no other processes with this name
-        }
-        ++it;
+        return false;
     }
-    return false;
+
+    auto it = maybeProcess.value();
+    if (removeProcessAndDeleteRespectiveSharedMemoryObjects(it, feedback))
+    {
+        LogDebug() << "Removed existing application " << name;
+    }
+    return true; // we can assume there are no other processes with this name
 }
 
 bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(ProcessList_t::iterator& processIter,
@@ -328,23 +328,13 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
             processIter->sendViaIpcChannel(sendBuffer);
         }
 
+        m_processIndex.erase(processIter->getName());
         processIter = m_processList.erase(processIter); // delete application
         return true;
     }
     return false;
 }
 
-void ProcessManager::updateLivelinessOfProcess(const RuntimeName_t& name) noexcept
-{
-    searchForProcessAndThen(
-        name,
-        [&](Process& process) {
-            // reset timestamp
-            process.setTimestamp(mepoo::BaseClock_t::now());
-        },
-        [&]() { LogWarn() << "Received Keepalive from unknown process " << name; });
-}
-
 void ProcessManager::findServiceForProcess(const RuntimeName_t& name, const capro::ServiceDescription& service) noexcept
 {
     searchForProcessAndThen(
@@ -402,6 +392,8 @@ void ProcessManager::addApplicationForProcess(const RuntimeName_t& name) noexcep
         name,
         [&](Process& process) {
             popo::ApplicationPortData* port = m_portManager.acquireApplicationPortData(name);
+            // the runtime signals its liveliness via the heartbeat in the ApplicationPortData
+            process.setApplicationPortData(port);
 
             auto offset = rp::BaseRelativePointer::getOffset(m_mgmtSegmentId, port);
 
@@ -616,19 +608,11 @@ bool ProcessManager::searchForProcessAndThen(const RuntimeName_t& name,
                                              cxx::function_ref<void(Process&)> AndThenCallable,
                                              cxx::function_ref<void()> OrElseCallable) noexcept
 {
-    typename ProcessList_t::iterator it = m_processList.begin();
-    const typename ProcessList_t::iterator itEnd = m_processList.end();
-
-    for (; itEnd != it; ++it)
+    auto maybeProcess = m_processIndex.find(name);
+    if (maybeProcess.has_value() && AndThenCallable)
     {
-        if (name == it->getName())
-        {
-            if (AndThenCallable)
-            {
-                AndThenCallable(*it);
-                return true;
-            }
-        }
+        AndThenCallable(*maybeProcess.value());
+        return true;
     }
     if (OrElseCallable)
     {
@@ -666,6 +650,7 @@ void ProcessManager::monitorProcesses() noexcept
                 m_processIntrospection->removeProcess(static_cast<int32_t>(processIterator->getPid()));
 
                 // delete application
+                m_processIndex.erase(processIterator->getName());
                 processIterator = m_processList.erase(processIterator);
                 continue; // erase returns first element after the removed one --> skip iterator increment
             }
@@ -25,6 +25,7 @@
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_manager.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iceoryx_posh/runtime/posh_runtime_single_process.hpp"
 
 namespace iox
 {
@@ -82,13 +83,29 @@ void RouDi::startProcessRuntimeMessagesThread()
 {
     m_handleRuntimeMessageThread = std::thread(&RouDi::processRuntimeMessages, this);
     posix::setThreadName(m_handleRuntimeMessageThread.native_handle(), "IPC-msg-process");
+
+    // a PoshRuntimeSingleProcess in this process can pass its requests directly to RouDi
+    m_isRequestHandlerRegistered = runtime::PoshRuntimeSingleProcess::registerRequestHandler(
+        [this](const runtime::IpcMessage& message) { processRuntimeMessage(message); });
 }
 
 void RouDi::shutdown()
 {
+    if (m_isRequestHandlerRegistered)
+    {
+        runtime::PoshRuntimeSingleProcess::unregisterRequestHandler();
+        m_isRequestHandlerRegistered = false;
+    }
+
     m_processIntrospection.stop();
     m_portManager->stopPortIntrospection();
 
+    m_roudiMemoryInterface->segmentManager().and_then([](mepoo::SegmentManager<>* segmentManager) {
+        segmentManager->suggestConfig().and_then([](const std::string& config) {
+            LogInfo() << "Suggested RouDi config for the profiled mempool usage:\n" << config;
+        });
+    });
+
     // stop the process management thread in order to prevent application to register while shutting down
     m_runMonitoringAndDiscoveryThread = false;
     if (m_monitoringAndDiscoveryThread.joinable())
@@ -172,14 +189,20 @@ void RouDi::processRuntimeMessages()
         runtime::IpcMessage message;
         if (roudiIpcInterface.timedReceive(m_runtimeMessagesThreadTimeout, message))
         {
-            auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
-            std::string runtimeName = message.getElementAtIndex(1);
-
-            processMessage(message, cmd, RuntimeName_t(cxx::TruncateToCapacity, runtimeName));
+            processRuntimeMessage(message);
         }
     }
 }
 
+void RouDi::processRuntimeMessage(const runtime::IpcMessage& message) noexcept
+{
+    auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
+    std::string runtimeName = message.getElementAtIndex(1);
+
+    std::lock_guard<std::mutex> lock(m_runtimeMessageMutex);
+    processMessage(message, cmd, RuntimeName_t(cxx::TruncateToCapacity, runtimeName));
+}
+
 version::VersionInfo RouDi::parseRegisterMessage(const runtime::IpcMessage& message,
                                                  uint32_t& pid,
                                                  uid_t& userId,
@@ -224,7 +247,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     }
     case runtime::IpcMessageType::CREATE_PUBLISHER:
     {
-        if (message.getNumberOfElements() != 8)
+        if (message.getNumberOfElements() != 11)
         {
             LogError() << "Wrong number of parameters for \"IpcMessageType::CREATE_PUBLISHER\" from \"" << runtimeName
                        << "\"received!";
@@ -232,7 +255,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             capro::ServiceDescription service(cxx::Serialization(message.getElementAtIndex(2)));
-            cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(7));
+            cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(10));
 
             popo::PublisherOptions options;
             uint64_t historyCapacity{};
@@ -263,6 +286,29 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             }
             options.subscriberTooSlowPolicy = static_cast<popo::SubscriberTooSlowPolicy>(subscriberTooSlowPolicy);
 
+            if (!cxx::convert::fromString(message.getElementAtIndex(7).c_str(), options.maxChunksInUse))
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_PUBLISHER\"! '"
+                           << message.getElementAtIndex(7).c_str() << "' cannot be extracted from string\n";
+                break;
+            }
+
+            if (!cxx::convert::fromString(message.getElementAtIndex(8).c_str(), options.reservedChunks))
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_PUBLISHER\"! '"
+                           << message.getElementAtIndex(8).c_str() << "' cannot be extracted from string\n";
+                break;
+            }
+
+            uint32_t provideLatestValue{};
+            if (!cxx::convert::fromString(message.getElementAtIndex(9).c_str(), provideLatestValue))
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_PUBLISHER\"! '"
+                           << message.getElementAtIndex(9).c_str() << "' cannot be extracted from string\n";
+                break;
+            }
+            options.provideLatestValue = (0U == provideLatestValue) ? false : true;
+
             m_prcMgr->addPublisherForProcess(
                 runtimeName, service, options, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
@@ -270,7 +316,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     }
     case runtime::IpcMessageType::CREATE_SUBSCRIBER:
     {
-        if (message.getNumberOfElements() != 9)
+        if (message.getNumberOfElements() != 13)
         {
             LogError() << "Wrong number of parameters for \"IpcMessageType::CREATE_SUBSCRIBER\" from \"" << runtimeName
                        << "\"received!";
@@ -278,7 +324,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             capro::ServiceDescription service(cxx::Serialization(message.getElementAtIndex(2)));
-            cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(8));
+            cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(12));
 
 
             popo::SubscriberOptions options;
@@ -318,6 +364,32 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             }
             options.queueFullPolicy = static_cast<popo::QueueFullPolicy>(queueFullPolicy);
 
+            uint32_t latestValueOnly{};
+            if (!cxx::convert::fromString(message.getElementAtIndex(8).c_str(), latestValueOnly))
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_SUBSCRIBER\"! '"
+                           << message.getElementAtIndex(8).c_str() << "' cannot be extracted from string\n";
+                break;
+            }
+            options.latestValueOnly = (0U == latestValueOnly) ? false : true;
+            options.userHeaderFilter = popo::UserHeaderFilter(cxx::Serialization(message.getElementAtIndex(9)));
+
+            if (!cxx::convert::fromString(message.getElementAtIndex(10).c_str(), options.deliverEveryNthSample))
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_SUBSCRIBER\"! '"
+                           << message.getElementAtIndex(10).c_str() << "' cannot be extracted from string\n";
+                break;
+            }
+
+            uint64_t minDeliveryIntervalNs{};
+            if (!cxx::convert::fromString(message.getElementAtIndex(11).c_str(), minDeliveryIntervalNs))
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_SUBSCRIBER\"! '"
+                           << message.getElementAtIndex(11).c_str() << "' cannot be extracted from string\n";
+                break;
+            }
+            options.minDeliveryInterval = units::Duration::fromNanoseconds(minDeliveryIntervalNs);
+
             m_prcMgr->addSubscriberForProcess(
                 runtimeName, service, options, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
@@ -395,11 +467,6 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         break;
     }
-    case runtime::IpcMessageType::KEEPALIVE:
-    {
-        m_prcMgr->updateLivelinessOfProcess(runtimeName);
-        break;
-    }
     case runtime::IpcMessageType::PREPARE_APP_TERMINATION:
     {
         if (message.getNumberOfElements() != 2)
@@ -22,6 +22,7 @@ namespace config
 {
 RouDiConfig& RouDiConfig::setDefaults()
 {
+    m_processScope = roudi::ProcessScope::MULTI_PROCESS;
     return *this;
 }
 
@@ -113,6 +113,9 @@ iox::cxx::expected<iox::RouDiConfig_t, iox::roudi::RouDiConfigFileParseError> To
         auto writer = segment->get_as<std::string>("writer").value_or(groupOfCurrentProcess);
         auto reader = segment->get_as<std::string>("reader").value_or(groupOfCurrentProcess);
         iox::mepoo::MePooConfig mempoolConfig;
+        mempoolConfig.m_profileChunkRequests = segment->get_as<bool>("profiling").value_or(false);
+        mempoolConfig.m_overflowMemorySize = segment->get_as<uint64_t>("overflow_size").value_or(0U);
+        mempoolConfig.m_publisherChunkQuota = segment->get_as<uint32_t>("publisher_chunk_quota").value_or(0U);
         auto mempools = segment->get_table_array("mempool");
         if (!mempools)
         {
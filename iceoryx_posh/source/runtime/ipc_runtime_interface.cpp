@@ -142,11 +142,6 @@ IpcRuntimeInterface::IpcRuntimeInterface(const RuntimeName_t& roudiName,
     }
 }
 
-bool IpcRuntimeInterface::sendKeepalive() noexcept
-{
-    return m_RoudiIpcInterface.send({IpcMessageTypeToString(IpcMessageType::KEEPALIVE), m_runtimeName});
-}
-
 rp::BaseRelativePointer::offset_t IpcRuntimeInterface::getSegmentManagerAddressOffset() const noexcept
 {
     cxx::Ensures(m_segmentManagerAddressOffset.has_value()
@@ -162,6 +157,11 @@ bool IpcRuntimeInterface::sendRequestToRouDi(const IpcMessage& msg, IpcMessage&
         return false;
     }
 
+    return receiveAnswerFromRouDi(answer);
+}
+
+bool IpcRuntimeInterface::receiveAnswerFromRouDi(IpcMessage& answer) noexcept
+{
     if (!m_AppIpcInterface.receive(answer))
     {
         LogError() << "Could not receive request via App IPC channel interface.\n";
@@ -127,6 +127,8 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
                << static_cast<cxx::Serialization>(service).toString() << cxx::convert::toString(options.historyCapacity)
                << options.nodeName << cxx::convert::toString(options.offerOnCreate)
                << cxx::convert::toString(static_cast<uint8_t>(options.subscriberTooSlowPolicy))
+               << cxx::convert::toString(options.maxChunksInUse) << cxx::convert::toString(options.reservedChunks)
+               << cxx::convert::toString(options.provideLatestValue)
                << static_cast<cxx::Serialization>(portConfigInfo).toString();
 
     auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
@@ -239,6 +241,10 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
                << cxx::convert::toString(options.queueCapacity) << options.nodeName
                << cxx::convert::toString(options.subscribeOnCreate)
                << cxx::convert::toString(static_cast<uint8_t>(options.queueFullPolicy))
+               << cxx::convert::toString(options.latestValueOnly)
+               << static_cast<cxx::Serialization>(options.userHeaderFilter).toString()
+               << cxx::convert::toString(options.deliverEveryNthSample)
+               << cxx::convert::toString(options.minDeliveryInterval.toNanoseconds())
                << static_cast<cxx::Serialization>(portConfigInfo).toString();
 
     auto maybeSubscriber = requestSubscriberFromRoudi(sendBuffer);
@@ -531,13 +537,21 @@ bool PoshRuntimeImpl::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answ
     return m_ipcChannelInterface.sendRequestToRouDi(msg, answer);
 }
 
+bool PoshRuntimeImpl::deliverRequestToRouDi(const cxx::function_ref<void(const IpcMessage&)> deliverRequest,
+                                            const IpcMessage& msg,
+                                            IpcMessage& answer) noexcept
+{
+    // the mutex is held until the answer is received to prevent other threads from receiving this answer
+    std::lock_guard<posix::mutex> g(m_appIpcRequestMutex);
+    deliverRequest(msg);
+    return m_ipcChannelInterface.receiveAnswerFromRouDi(answer);
+}
+
 // this is the callback for the m_keepAliveTimer
-void PoshRuntimeImpl::sendKeepAliveAndHandleShutdownPreparation() noexcept
+void PoshRuntimeImpl::sendHeartbeatAndHandleShutdownPreparation() noexcept
 {
-    if (!m_ipcChannelInterface.sendKeepalive())
-    {
-        LogWarn() << "Error in sending keep alive";
-    }
+    // RouDi reads the heartbeat directly from the shared memory, there is no need for an IPC message
+    m_applicationPort.sendHeartbeat();
 
     // this is not the nicest solution, but we cannot send this in the signal handler where m_shutdownRequested is
     // usually set; luckily the runtime already has a thread running and therefore this thread is used to unblock the
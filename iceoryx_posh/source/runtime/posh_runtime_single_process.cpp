@@ -16,10 +16,28 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/runtime/posh_runtime_single_process.hpp"
+
+#include <mutex>
+
 namespace iox
 {
 namespace runtime
 {
+namespace
+{
+std::mutex& requestHandlerMutex() noexcept
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+cxx::optional<PoshRuntimeSingleProcess::RequestHandler>& requestHandler() noexcept
+{
+    static cxx::optional<PoshRuntimeSingleProcess::RequestHandler> handler;
+    return handler;
+}
+} // namespace
+
 PoshRuntime*& getSingleProcessRuntime()
 {
     static PoshRuntime* singleProcessRuntime = nullptr;
@@ -53,5 +71,36 @@ PoshRuntimeSingleProcess::~PoshRuntimeSingleProcess()
     PoshRuntime::setRuntimeFactory(PoshRuntime::defaultRuntimeFactory);
 }
 
+bool PoshRuntimeSingleProcess::registerRequestHandler(const RequestHandler& handler) noexcept
+{
+    std::lock_guard<std::mutex> lock(requestHandlerMutex());
+    if (requestHandler().has_value())
+    {
+        return false;
+    }
+    requestHandler().emplace(handler);
+    return true;
+}
+
+void PoshRuntimeSingleProcess::unregisterRequestHandler() noexcept
+{
+    std::lock_guard<std::mutex> lock(requestHandlerMutex());
+    requestHandler().reset();
+}
+
+bool PoshRuntimeSingleProcess::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept
+{
+    {
+        // the lock ensures that the handler is not unregistered while it is in use
+        std::lock_guard<std::mutex> lock(requestHandlerMutex());
+        if (requestHandler().has_value())
+        {
+            return deliverRequestToRouDi(
+                [](const IpcMessage& request) { requestHandler().value()(request); }, msg, answer);
+        }
+    }
+    return PoshRuntimeImpl::sendRequestToRouDi(msg, answer);
+}
+
 } // namespace runtime
 } // namespace iox
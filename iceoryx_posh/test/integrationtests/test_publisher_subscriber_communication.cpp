@@ -30,6 +30,8 @@
 
 #include "test.hpp"
 
+#include <cstddef>
+
 namespace
 {
 using namespace ::testing;
@@ -461,4 +463,74 @@ TEST_F(PublisherSubscriberCommunication_test, MixedOptionsSetupWorksWithBlocking
     EXPECT_THAT(subscriberNonBlocking->take().has_error(), Eq(true));
 }
 
+struct CameraHeader
+{
+    uint32_t cameraId{0U};
+};
+
+TEST_F(PublisherSubscriberCommunication_test, SubscriberWithUserHeaderFilterReceivesOnlyMatchingSamples)
+{
+    constexpr uint32_t FRONT_CAMERA_ID{1U};
+    iox::popo::Publisher<uint64_t, CameraHeader> publisher(m_serviceDescription);
+    this->InterOpWait();
+    iox::popo::SubscriberOptions options;
+    options.userHeaderFilter = UserHeaderFilter::fieldEquals(offsetof(CameraHeader, cameraId), FRONT_CAMERA_ID);
+    iox::popo::Subscriber<uint64_t, CameraHeader> filteredSubscriber(m_serviceDescription, options);
+    iox::popo::Subscriber<uint64_t, CameraHeader> subscriber(m_serviceDescription);
+    this->InterOpWait();
+
+    for (uint32_t cameraId = 0U; cameraId < 3U; ++cameraId)
+    {
+        ASSERT_FALSE(publisher.loan()
+                         .and_then([&](auto& sample) {
+                             sample.getUserHeader().cameraId = cameraId;
+                             *sample = 42U + cameraId;
+                             sample.publish();
+                         })
+                         .has_error());
+    }
+
+    auto sample = filteredSubscriber.take();
+    ASSERT_FALSE(sample.has_error());
+    EXPECT_THAT(sample->getUserHeader().cameraId, Eq(FRONT_CAMERA_ID));
+    EXPECT_THAT(**sample, Eq(43U));
+    EXPECT_TRUE(filteredSubscriber.take().has_error());
+    EXPECT_FALSE(filteredSubscriber.hasMissedData());
+
+    for (uint32_t cameraId = 0U; cameraId < 3U; ++cameraId)
+    {
+        EXPECT_FALSE(subscriber.take().has_error());
+    }
+}
+
+TEST_F(PublisherSubscriberCommunication_test, DownsampledSubscriberReceivesOnlyEveryNthSample)
+{
+    auto publisher = createPublisher<uint64_t>();
+    this->InterOpWait();
+    iox::popo::SubscriberOptions options;
+    options.deliverEveryNthSample = 4U;
+    iox::popo::Subscriber<uint64_t> downsampledSubscriber(m_serviceDescription, options);
+    options.deliverEveryNthSample = 1U;
+    options.minDeliveryInterval = units::Duration::fromSeconds(3600U);
+    iox::popo::Subscriber<uint64_t> rateLimitedSubscriber(m_serviceDescription, options);
+    this->InterOpWait();
+
+    for (uint64_t i = 0U; i < 10U; ++i)
+    {
+        EXPECT_FALSE(publisher->publishCopyOf(i).has_error());
+    }
+
+    for (uint64_t expectedValue : {0U, 4U, 8U})
+    {
+        auto sample = downsampledSubscriber.take();
+        ASSERT_FALSE(sample.has_error());
+        EXPECT_THAT(**sample, Eq(expectedValue));
+    }
+    EXPECT_TRUE(downsampledSubscriber.take().has_error());
+    EXPECT_FALSE(downsampledSubscriber.hasMissedData());
+
+    EXPECT_FALSE(rateLimitedSubscriber.take().has_error());
+    EXPECT_TRUE(rateLimitedSubscriber.take().has_error());
+}
+
 } // namespace
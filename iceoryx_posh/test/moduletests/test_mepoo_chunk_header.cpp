@@ -205,6 +205,39 @@ TEST(ChunkHeader_test, FromUserPayloadFunctionCalledWithConstParamReturnsConstTy
     EXPECT_TRUE(isConstReturn);
 }
 
+TEST(ChunkHeader_test, FromUserHeaderFunctionCalledWithNullptrReturnsNullptr)
+{
+    constexpr void* USER_HEADER{nullptr};
+    auto chunkHeader = ChunkHeader::fromUserHeader(USER_HEADER);
+    EXPECT_THAT(chunkHeader, Eq(nullptr));
+}
+
+TEST(ChunkHeader_test, FromUserHeaderFunctionCalledWithConstParamReturnsConstType)
+{
+    auto isConstReturn =
+        std::is_same<decltype(ChunkHeader::fromUserHeader(std::declval<const void*>())), const ChunkHeader*>::value;
+    EXPECT_TRUE(isConstReturn);
+}
+
+TEST(ChunkHeader_test, FromUserHeaderFunctionReturnsChunkHeaderOfUserHeader)
+{
+    alignas(ChunkHeader) static uint8_t storage[1024 * 1024];
+
+    constexpr uint32_t CHUNK_SIZE{753U};
+    constexpr uint32_t USER_PAYLOAD_SIZE{8U};
+    constexpr uint32_t USER_HEADER_SIZE{16U};
+    constexpr uint32_t USER_HEADER_ALIGNMENT{8U};
+
+    auto chunkSettingsResult = ChunkSettings::create(
+        USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+    auto& chunkSettings = chunkSettingsResult.value();
+
+    iox::cxx::unique_ptr<ChunkHeader> sut{new (storage) ChunkHeader(CHUNK_SIZE, chunkSettings), [](ChunkHeader*) {}};
+
+    EXPECT_THAT(ChunkHeader::fromUserHeader(sut->userHeader()), Eq(sut.get()));
+}
+
 TEST(ChunkHeader_test, UsedChunkSizeIsSizeOfChunkHeaderWhenUserPayloadIsZero)
 {
     constexpr uint32_t CHUNK_SIZE{2 * sizeof(ChunkHeader)};
@@ -0,0 +1,175 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_quota.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+
+class ChunkQuotaUsage_test : public Test
+{
+  public:
+    static constexpr uint32_t NUMBER_OF_CHUNKS{20U};
+    static constexpr uint32_t CHUNK_SIZE{64U};
+    static constexpr uint64_t MEMORY_SIZE{NUMBER_OF_CHUNKS * CHUNK_SIZE + 10000U};
+
+    ChunkQuotaUsage_test()
+        : allocator(m_rawMemory, MEMORY_SIZE)
+        , memPool(CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator)
+    {
+    }
+
+    std::vector<QuotaChunk> acquireChunks(const ChunkQuotaSettings& settings, const uint32_t numberOfChunks)
+    {
+        std::vector<QuotaChunk> chunks;
+        for (uint32_t i = 0U; i < numberOfChunks; ++i)
+        {
+            sut.acquireChunk(memPool, settings).and_then([&](const QuotaChunk& chunk) { chunks.push_back(chunk); });
+        }
+        return chunks;
+    }
+
+    alignas(MemPool::CHUNK_MEMORY_ALIGNMENT) uint8_t m_rawMemory[MEMORY_SIZE];
+    iox::posix::Allocator allocator;
+    MemPool memPool;
+    ChunkQuotaUsage sut;
+};
+
+constexpr uint32_t ChunkQuotaUsage_test::NUMBER_OF_CHUNKS;
+constexpr uint32_t ChunkQuotaUsage_test::CHUNK_SIZE;
+constexpr uint64_t ChunkQuotaUsage_test::MEMORY_SIZE;
+
+TEST_F(ChunkQuotaUsage_test, AcquiringMoreChunksThanMaxChunksInUseFailsWithQuotaExceeded)
+{
+    const ChunkQuotaSettings settings{5U, 0U};
+    auto chunks = acquireChunks(settings, 5U);
+    ASSERT_THAT(chunks.size(), Eq(5U));
+
+    auto maybeChunk = sut.acquireChunk(memPool, settings);
+
+    ASSERT_TRUE(maybeChunk.has_error());
+    EXPECT_THAT(maybeChunk.get_error(), Eq(ChunkRequestError::CHUNK_QUOTA_EXCEEDED));
+    EXPECT_THAT(sut.getChunksInUse(), Eq(5U));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(5U));
+}
+
+TEST_F(ChunkQuotaUsage_test, ReleasedChunksCanBeAcquiredAgainWithinTheQuota)
+{
+    const ChunkQuotaSettings settings{5U, 0U};
+    auto chunks = acquireChunks(settings, 5U);
+    ASSERT_THAT(chunks.size(), Eq(5U));
+
+    sut.releaseChunk(memPool, chunks.back().m_chunk, chunks.back().m_isReserved);
+
+    EXPECT_THAT(sut.getChunksInUse(), Eq(4U));
+    EXPECT_FALSE(sut.acquireChunk(memPool, settings).has_error());
+}
+
+TEST_F(ChunkQuotaUsage_test, ExhaustedMemPoolFailsWithRunningOutOfChunks)
+{
+    const ChunkQuotaSettings settings{0U, 0U};
+    auto chunks = acquireChunks(settings, NUMBER_OF_CHUNKS);
+    ASSERT_THAT(chunks.size(), Eq(NUMBER_OF_CHUNKS));
+
+    auto maybeChunk = sut.acquireChunk(memPool, settings);
+
+    ASSERT_TRUE(maybeChunk.has_error());
+    EXPECT_THAT(maybeChunk.get_error(), Eq(ChunkRequestError::RUNNING_OUT_OF_CHUNKS));
+}
+
+TEST_F(ChunkQuotaUsage_test, ReservedChunksAreAvailableWhenOthersExhaustedTheMemPool)
+{
+    const ChunkQuotaSettings settings{0U, 3U};
+    ASSERT_FALSE(sut.acquireChunk(memPool, settings).has_error());
+    EXPECT_THAT(memPool.getReservedChunks(), Eq(3U));
+
+    std::vector<void*> chunksOfOthers;
+    for (void* chunk = memPool.getChunk(); chunk != nullptr; chunk = memPool.getChunk())
+    {
+        chunksOfOthers.push_back(chunk);
+    }
+    EXPECT_THAT(chunksOfOthers.size(), Eq(NUMBER_OF_CHUNKS - 3U));
+
+    auto chunks = acquireChunks(settings, 3U);
+    ASSERT_THAT(chunks.size(), Eq(2U));
+    EXPECT_TRUE(chunks[0].m_isReserved);
+    EXPECT_TRUE(chunks[1].m_isReserved);
+    EXPECT_THAT(sut.getChunksInUse(), Eq(3U));
+}
+
+TEST_F(ChunkQuotaUsage_test, DeniedReservationStillAllowsToAcquireChunks)
+{
+    const ChunkQuotaSettings settings{0U, NUMBER_OF_CHUNKS + 1U};
+
+    auto maybeChunk = sut.acquireChunk(memPool, settings);
+
+    ASSERT_FALSE(maybeChunk.has_error());
+    EXPECT_FALSE(maybeChunk.value().m_isReserved);
+    EXPECT_THAT(memPool.getReservedChunks(), Eq(0U));
+}
+
+TEST_F(ChunkQuotaUsage_test, ReleaseReservationReturnsTheUnusedReservedChunksToTheMemPool)
+{
+    const ChunkQuotaSettings settings{0U, 5U};
+    auto chunks = acquireChunks(settings, 2U);
+    ASSERT_THAT(chunks.size(), Eq(2U));
+
+    sut.releaseReservation(memPool);
+
+    EXPECT_THAT(memPool.getReservedChunks(), Eq(2U));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(2U));
+}
+
+TEST_F(ChunkQuotaUsage_test, ReservedChunksInUseAreReturnedToTheMemPoolAfterTheReservationIsReleased)
+{
+    const ChunkQuotaSettings settings{0U, 5U};
+    auto chunks = acquireChunks(settings, 2U);
+    ASSERT_THAT(chunks.size(), Eq(2U));
+    sut.releaseReservation(memPool);
+
+    for (const auto& chunk : chunks)
+    {
+        sut.releaseChunk(memPool, chunk.m_chunk, chunk.m_isReserved);
+    }
+
+    EXPECT_THAT(sut.getChunksInUse(), Eq(0U));
+    EXPECT_THAT(memPool.getReservedChunks(), Eq(0U));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(0U));
+}
+
+TEST_F(ChunkQuotaUsage_test, ReleasedReservedChunksStayReservedWhileTheReservationIsActive)
+{
+    const ChunkQuotaSettings settings{0U, 5U};
+    auto chunks = acquireChunks(settings, 2U);
+    ASSERT_THAT(chunks.size(), Eq(2U));
+
+    for (const auto& chunk : chunks)
+    {
+        sut.releaseChunk(memPool, chunk.m_chunk, chunk.m_isReserved);
+    }
+
+    EXPECT_THAT(memPool.getReservedChunks(), Eq(5U));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(0U));
+}
+
+} // namespace
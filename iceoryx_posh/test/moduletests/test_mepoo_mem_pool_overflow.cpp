@@ -0,0 +1,79 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/mem_pool_overflow.hpp"
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+
+class MemPoolOverflow_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        sut.init(memory, MEMORY_SIZE);
+    }
+
+    static constexpr uint32_t CHUNK_SIZE{128U};
+    static constexpr uint64_t MEMORY_SIZE{10U * CHUNK_SIZE};
+    alignas(8) uint8_t memory[MEMORY_SIZE];
+    MemPoolOverflow sut;
+};
+
+constexpr uint32_t MemPoolOverflow_test::CHUNK_SIZE;
+constexpr uint64_t MemPoolOverflow_test::MEMORY_SIZE;
+
+TEST_F(MemPoolOverflow_test, NewOverflowHasNoUsedMemory)
+{
+    EXPECT_THAT(sut.getSize(), Eq(MEMORY_SIZE));
+    EXPECT_THAT(sut.getUsedSize(), Eq(0U));
+}
+
+TEST_F(MemPoolOverflow_test, AllocationsAreConsecutive)
+{
+    uint32_t numberOfChunks{0U};
+
+    EXPECT_THAT(sut.allocate(CHUNK_SIZE, 3U, numberOfChunks), Eq(memory));
+    EXPECT_THAT(numberOfChunks, Eq(3U));
+    EXPECT_THAT(sut.allocate(CHUNK_SIZE, 2U, numberOfChunks), Eq(memory + 3U * CHUNK_SIZE));
+    EXPECT_THAT(numberOfChunks, Eq(2U));
+    EXPECT_THAT(sut.getUsedSize(), Eq(5U * CHUNK_SIZE));
+}
+
+TEST_F(MemPoolOverflow_test, AllocationIsReducedToTheRemainingMemory)
+{
+    uint32_t numberOfChunks{0U};
+    sut.allocate(CHUNK_SIZE, 8U, numberOfChunks);
+
+    EXPECT_THAT(sut.allocate(CHUNK_SIZE, 8U, numberOfChunks), Eq(memory + 8U * CHUNK_SIZE));
+    EXPECT_THAT(numberOfChunks, Eq(2U));
+    EXPECT_THAT(sut.getUsedSize(), Eq(MEMORY_SIZE));
+}
+
+TEST_F(MemPoolOverflow_test, AllocationFailsWhenNotASingleChunkFits)
+{
+    uint32_t numberOfChunks{0U};
+    sut.allocate(CHUNK_SIZE / 2U, 19U, numberOfChunks);
+
+    EXPECT_THAT(sut.allocate(CHUNK_SIZE, 1U, numberOfChunks), Eq(nullptr));
+    EXPECT_THAT(numberOfChunks, Eq(0U));
+    EXPECT_THAT(sut.getUsedSize(), Eq(19U * CHUNK_SIZE / 2U));
+}
+
+} // namespace
@@ -0,0 +1,207 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool_profiler.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "test.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+
+class MemPoolProfiler_test : public Test
+{
+  public:
+    void configure(const bool profileChunkRequests)
+    {
+        mempoolConfig.addMemPool({1024U, CHUNK_COUNT});
+        mempoolConfig.addMemPool({16384U, CHUNK_COUNT});
+        mempoolConfig.m_profileChunkRequests = profileChunkRequests;
+        sut.configureMemoryManager(mempoolConfig, allocator, allocator);
+    }
+
+    ChunkSettings chunkSettingsFor(const uint32_t userPayloadSize)
+    {
+        return ChunkSettings::create(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+    }
+
+    /// @brief payload sizes which grow by an eighth of the current power of two, i.e. by one size class per step
+    static uint32_t spreadPayloadSize(const uint32_t index)
+    {
+        return (64U + 8U * (index % 8U)) << (index / 8U);
+    }
+
+    const MemPoolProfiler& profiler()
+    {
+        auto maybeProfiler = sut.getProfiler();
+        EXPECT_TRUE(maybeProfiler.has_value());
+        return *maybeProfiler.value();
+    }
+
+    static constexpr uint32_t CHUNK_COUNT{100U};
+    static constexpr uint64_t MEMORY_SIZE{8U * 1024U * 1024U};
+    std::unique_ptr<uint8_t[]> memory{new uint8_t[MEMORY_SIZE]};
+    iox::posix::Allocator allocator{memory.get(), MEMORY_SIZE};
+    MePooConfig mempoolConfig;
+    MemoryManager sut;
+};
+
+constexpr uint32_t MemPoolProfiler_test::CHUNK_COUNT;
+constexpr uint64_t MemPoolProfiler_test::MEMORY_SIZE;
+
+TEST_F(MemPoolProfiler_test, SizeClassesAreMonotonicAndWithinRange)
+{
+    uint32_t previousSizeClass{0U};
+    for (uint64_t size = 1U; size <= std::numeric_limits<uint32_t>::max(); size = size * 9U / 8U + 1U)
+    {
+        const auto sizeClass = MemPoolProfiler::sizeClassOf(static_cast<uint32_t>(size));
+        EXPECT_THAT(sizeClass, Ge(previousSizeClass));
+        EXPECT_THAT(sizeClass, Lt(MemPoolProfiler::NUMBER_OF_SIZE_CLASSES));
+        previousSizeClass = sizeClass;
+    }
+    EXPECT_THAT(MemPoolProfiler::sizeClassOf(std::numeric_limits<uint32_t>::max()),
+                Eq(MemPoolProfiler::NUMBER_OF_SIZE_CLASSES - 1U));
+}
+
+TEST_F(MemPoolProfiler_test, SizesWhichDifferByMoreThanAnEighthAreInDifferentSizeClasses)
+{
+    EXPECT_THAT(MemPoolProfiler::sizeClassOf(1024U), Ne(MemPoolProfiler::sizeClassOf(1024U + 1024U / 8U)));
+    EXPECT_THAT(MemPoolProfiler::sizeClassOf(1024U), Eq(MemPoolProfiler::sizeClassOf(1024U + 1024U / 8U - 1U)));
+}
+
+TEST_F(MemPoolProfiler_test, MemoryManagerWithoutProfilingHasNoProfiler)
+{
+    configure(false);
+
+    EXPECT_FALSE(sut.getProfiler().has_value());
+}
+
+TEST_F(MemPoolProfiler_test, NewProfilerHasNoStatistics)
+{
+    configure(true);
+
+    EXPECT_TRUE(profiler().getChunkRequestStatistics().empty());
+    EXPECT_TRUE(profiler().suggestMePooConfig().m_mempoolConfig.empty());
+}
+
+TEST_F(MemPoolProfiler_test, ChunkRequestsAreRecordedWithTheirPeakUsage)
+{
+    configure(true);
+    const auto chunkSettings = chunkSettingsFor(100U);
+    {
+        std::vector<SharedChunk> chunks;
+        for (uint32_t i = 0U; i < 7U; ++i)
+        {
+            chunks.emplace_back(sut.getChunk(chunkSettings));
+        }
+    }
+    auto chunk = sut.getChunk(chunkSettings);
+
+    auto statistics = profiler().getChunkRequestStatistics();
+
+    ASSERT_THAT(statistics.size(), Eq(1U));
+    EXPECT_THAT(statistics[0].m_maxRequiredChunkSize, Eq(chunkSettings.requiredChunkSize()));
+    EXPECT_THAT(statistics[0].m_numberOfRequests, Eq(8U));
+    EXPECT_THAT(statistics[0].m_peakNumberOfUsedChunks, Eq(7U));
+}
+
+TEST_F(MemPoolProfiler_test, ChunkRequestsOfDifferentSizeClassesAreRecordedSeparately)
+{
+    configure(true);
+    auto smallChunk = sut.getChunk(chunkSettingsFor(100U));
+    auto largeChunk1 = sut.getChunk(chunkSettingsFor(10000U));
+    auto largeChunk2 = sut.getChunk(chunkSettingsFor(9500U));
+
+    auto statistics = profiler().getChunkRequestStatistics();
+
+    ASSERT_THAT(statistics.size(), Eq(2U));
+    EXPECT_THAT(statistics[0].m_maxRequiredChunkSize, Eq(chunkSettingsFor(100U).requiredChunkSize()));
+    EXPECT_THAT(statistics[0].m_peakNumberOfUsedChunks, Eq(1U));
+    EXPECT_THAT(statistics[1].m_maxRequiredChunkSize, Eq(chunkSettingsFor(10000U).requiredChunkSize()));
+    EXPECT_THAT(statistics[1].m_peakNumberOfUsedChunks, Eq(2U));
+}
+
+TEST_F(MemPoolProfiler_test, SuggestedMemPoolsFitTheRequestsWithHeadroom)
+{
+    configure(true);
+    std::vector<SharedChunk> chunks;
+    for (uint32_t i = 0U; i < 10U; ++i)
+    {
+        chunks.emplace_back(sut.getChunk(chunkSettingsFor(100U)));
+    }
+    for (uint32_t i = 0U; i < 5U; ++i)
+    {
+        chunks.emplace_back(sut.getChunk(chunkSettingsFor(10000U)));
+    }
+
+    constexpr uint32_t HEADROOM_IN_PERCENT{50U};
+    auto suggestion = profiler().suggestMePooConfig(HEADROOM_IN_PERCENT).m_mempoolConfig;
+
+    ASSERT_THAT(suggestion.size(), Eq(2U));
+    EXPECT_THAT(suggestion[0].m_size + sizeof(ChunkHeader), Ge(chunkSettingsFor(100U).requiredChunkSize()));
+    EXPECT_THAT(suggestion[0].m_size, Lt(1024U));
+    EXPECT_THAT(suggestion[0].m_chunkCount, Eq(15U));
+    EXPECT_THAT(suggestion[1].m_size + sizeof(ChunkHeader), Ge(chunkSettingsFor(10000U).requiredChunkSize()));
+    EXPECT_THAT(suggestion[1].m_size, Lt(16384U));
+    EXPECT_THAT(suggestion[1].m_chunkCount, Eq(8U));
+}
+
+TEST_F(MemPoolProfiler_test, SuggestionWithMoreSizeClassesThanMemPoolsIsValid)
+{
+    mempoolConfig.addMemPool({65536U, 2U * iox::MAX_NUMBER_OF_MEMPOOLS});
+    mempoolConfig.m_profileChunkRequests = true;
+    sut.configureMemoryManager(mempoolConfig, allocator, allocator);
+    std::vector<SharedChunk> chunks;
+    for (uint32_t i = 0U; i < 2U * iox::MAX_NUMBER_OF_MEMPOOLS; ++i)
+    {
+        chunks.emplace_back(sut.getChunk(chunkSettingsFor(spreadPayloadSize(i))));
+    }
+    ASSERT_THAT(profiler().getChunkRequestStatistics().size(), Gt(iox::MAX_NUMBER_OF_MEMPOOLS));
+
+    auto suggestion = profiler().suggestMePooConfig();
+
+    ASSERT_THAT(suggestion.m_mempoolConfig.size(), AllOf(Gt(0U), Le(iox::MAX_NUMBER_OF_MEMPOOLS)));
+    uint64_t numberOfChunks{0U};
+    for (uint64_t i = 0U; i < suggestion.m_mempoolConfig.size(); ++i)
+    {
+        numberOfChunks += suggestion.m_mempoolConfig[i].m_chunkCount;
+        if (i > 0U)
+        {
+            EXPECT_THAT(suggestion.m_mempoolConfig[i].m_size, Gt(suggestion.m_mempoolConfig[i - 1U].m_size));
+        }
+    }
+    EXPECT_THAT(numberOfChunks, Ge(2U * iox::MAX_NUMBER_OF_MEMPOOLS));
+
+    // the suggestion must be usable for a MemoryManager which serves all recorded requests
+    std::unique_ptr<uint8_t[]> suggestedMemory{new uint8_t[MemoryManager::requiredFullMemorySize(suggestion)]};
+    iox::posix::Allocator suggestedAllocator{suggestedMemory.get(), MemoryManager::requiredFullMemorySize(suggestion)};
+    MemoryManager suggestedMemoryManager;
+    suggestedMemoryManager.configureMemoryManager(suggestion, suggestedAllocator, suggestedAllocator);
+    std::vector<SharedChunk> suggestedChunks;
+    for (uint32_t i = 0U; i < 2U * iox::MAX_NUMBER_OF_MEMPOOLS; ++i)
+    {
+        suggestedChunks.emplace_back(suggestedMemoryManager.getChunk(chunkSettingsFor(spreadPayloadSize(i))));
+        EXPECT_TRUE(suggestedChunks.back());
+    }
+}
+
+} // namespace
@@ -208,6 +208,33 @@ TEST_F(MemoryManager_test, GetChunkMethodWhenNoFreeChunksInMemPoolConfigReturnsE
     EXPECT_EQ(detectedError.value(), iox::Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
 }
 
+TEST_F(MemoryManager_test, getChunkWhenMemPoolIsRepeatedlyExhaustedReportsErrorRateLimited)
+{
+    constexpr uint32_t CHUNK_COUNT{1U};
+    constexpr uint32_t PAYLOAD_SIZE{100U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    auto chunkSettingsResult = ChunkSettings::create(PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+    auto& chunkSettings = chunkSettingsResult.value();
+    auto chunk = sut->getChunk(chunkSettings);
+
+    uint64_t numberOfErrorHandlerCalls{0U};
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&numberOfErrorHandlerCalls](const iox::Error, const std::function<void()>, const iox::ErrorLevel) {
+            ++numberOfErrorHandlerCalls;
+        });
+
+    constexpr uint64_t NUMBER_OF_FAILED_REQUESTS{10U};
+    for (uint64_t i = 0U; i < NUMBER_OF_FAILED_REQUESTS; ++i)
+    {
+        EXPECT_THAT(sut->getChunk(chunkSettings), Eq(false));
+    }
+
+    EXPECT_THAT(numberOfErrorHandlerCalls, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_exhaustionCount, Eq(NUMBER_OF_FAILED_REQUESTS));
+}
+
 TEST_F(MemoryManager_test, VerifyGetChunkMethodWhenTheRequestedChunkIsAvailableInMemPoolConfig)
 {
     constexpr uint32_t CHUNK_COUNT{10U};
@@ -470,4 +497,168 @@ TEST_F(MemoryManager_test, addMemPoolWithChunkCountZeroShouldFail)
     EXPECT_DEATH({ sut->configureMemoryManager(mempoolconf, *allocator, *allocator); }, ".*");
 }
 
-} // namespace
\ No newline at end of file
+TEST_F(MemoryManager_test, ExhaustedMemPoolIsExtendedWithTheOverflowMemory)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.m_overflowMemorySize = 2U * CHUNK_COUNT * (CHUNK_SIZE_64 + sizeof(ChunkHeader));
+    const auto requiredMemorySize = iox::mepoo::MemoryManager::requiredFullMemorySize(mempoolconf);
+    ASSERT_THAT(requiredMemorySize, Le(rawMemorySize));
+    iox::posix::Allocator exactAllocator(rawMemory, requiredMemorySize);
+    sut->configureMemoryManager(mempoolconf, exactAllocator, exactAllocator);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (uint32_t i = 0U; i < 3U * CHUNK_COUNT; ++i)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_64));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+
+    EXPECT_THAT(sut->getChunk(chunkSettings_64), Eq(false));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(3U * CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_numChunks, Eq(3U * CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_numChunks, Eq(CHUNK_COUNT));
+}
+
+TEST_F(MemoryManager_test, OverflowMemoryIsSharedByAllMemPools)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.m_overflowMemorySize = CHUNK_COUNT * (CHUNK_SIZE_64 + sizeof(ChunkHeader));
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (uint32_t i = 0U; i < 2U * CHUNK_COUNT; ++i)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_64));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+    for (uint32_t i = 0U; i < CHUNK_COUNT; ++i)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_32));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+
+    EXPECT_THAT(sut->getChunk(chunkSettings_32), Eq(false));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_numChunks, Eq(CHUNK_COUNT));
+}
+
+TEST_F(MemoryManager_test, ChunkQuotaLimitsTheChunksInUsePerMemPool)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t MAX_CHUNKS_IN_USE{3U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    const auto chunkQuota = sut->acquireChunkQuota({MAX_CHUNKS_IN_USE, 0U});
+    ASSERT_THAT(chunkQuota, Ne(iox::mepoo::MemoryManager::NO_CHUNK_QUOTA));
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (uint32_t i = 0U; i < MAX_CHUNKS_IN_USE; ++i)
+    {
+        sut->getChunk(chunkSettings_32, chunkQuota).and_then([&](auto& chunk) {
+            chunkStore.push_back(chunk);
+        });
+    }
+    ASSERT_THAT(chunkStore.size(), Eq(MAX_CHUNKS_IN_USE));
+
+    auto maybeChunk = sut->getChunk(chunkSettings_32, chunkQuota);
+    ASSERT_TRUE(maybeChunk.has_error());
+    EXPECT_THAT(maybeChunk.get_error(), Eq(iox::mepoo::ChunkRequestError::CHUNK_QUOTA_EXCEEDED));
+    EXPECT_FALSE(sut->getChunk(chunkSettings_64, chunkQuota).has_error());
+
+    chunkStore.pop_back();
+    EXPECT_FALSE(sut->getChunk(chunkSettings_32, chunkQuota).has_error());
+}
+
+TEST_F(MemoryManager_test, ChunkQuotaWithoutLimitsIsNotAcquired)
+{
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 10U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    EXPECT_THAT(sut->acquireChunkQuota({0U, 0U}), Eq(iox::mepoo::MemoryManager::NO_CHUNK_QUOTA));
+}
+
+TEST_F(MemoryManager_test, ChunkQuotaWithoutMaxChunksInUseUsesTheQuotaFromTheConfig)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.m_publisherChunkQuota = 2U;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    const auto chunkQuota = sut->acquireChunkQuota({0U, 0U});
+    ASSERT_THAT(chunkQuota, Ne(iox::mepoo::MemoryManager::NO_CHUNK_QUOTA));
+
+    auto chunk1 = sut->getChunk(chunkSettings_32, chunkQuota);
+    auto chunk2 = sut->getChunk(chunkSettings_32, chunkQuota);
+    auto chunk3 = sut->getChunk(chunkSettings_32, chunkQuota);
+
+    EXPECT_FALSE(chunk1.has_error());
+    EXPECT_FALSE(chunk2.has_error());
+    ASSERT_TRUE(chunk3.has_error());
+    EXPECT_THAT(chunk3.get_error(), Eq(iox::mepoo::ChunkRequestError::CHUNK_QUOTA_EXCEEDED));
+}
+
+TEST_F(MemoryManager_test, ReservedChunksOfAChunkQuotaCannotBeAcquiredByOthers)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t RESERVED_CHUNKS{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    const auto chunkQuota = sut->acquireChunkQuota({0U, RESERVED_CHUNKS});
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    sut->getChunk(chunkSettings_32, chunkQuota).and_then([&](auto& chunk) { chunkStore.push_back(chunk); });
+    ASSERT_THAT(chunkStore.size(), Eq(1U));
+
+    for (uint32_t i = 0U; i < CHUNK_COUNT - RESERVED_CHUNKS; ++i)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_32));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+    EXPECT_THAT(sut->getChunk(chunkSettings_32), Eq(false));
+
+    for (uint32_t i = 1U; i < RESERVED_CHUNKS; ++i)
+    {
+        EXPECT_FALSE(sut->getChunk(chunkSettings_32, chunkQuota).has_error());
+    }
+}
+
+TEST_F(MemoryManager_test, ReleasedChunkQuotaReturnsTheReservedChunks)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    const auto chunkQuota = sut->acquireChunkQuota({0U, CHUNK_COUNT});
+    EXPECT_FALSE(sut->getChunk(chunkSettings_32, chunkQuota).has_error());
+    EXPECT_THAT(sut->getChunk(chunkSettings_32), Eq(false));
+
+    sut->releaseChunkQuota(chunkQuota);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (uint32_t i = 0U; i < CHUNK_COUNT; ++i)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_32));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+}
+
+TEST_F(MemoryManager_test, ReleasedChunkQuotaIsNotReusedWhileItsChunksAreInUse)
+{
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 10U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    const auto chunkQuota = sut->acquireChunkQuota({1U, 0U});
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    sut->getChunk(chunkSettings_32, chunkQuota).and_then([&](auto& chunk) { chunkStore.push_back(chunk); });
+    ASSERT_THAT(chunkStore.size(), Eq(1U));
+
+    sut->releaseChunkQuota(chunkQuota);
+    const auto otherChunkQuota = sut->acquireChunkQuota({1U, 0U});
+    EXPECT_THAT(otherChunkQuota, Ne(chunkQuota));
+    sut->releaseChunkQuota(otherChunkQuota);
+
+    chunkStore.clear();
+    EXPECT_THAT(sut->acquireChunkQuota({1U, 0U}), Eq(chunkQuota));
+}
+
+} // namespace
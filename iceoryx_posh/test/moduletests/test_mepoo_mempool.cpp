@@ -19,6 +19,8 @@
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "test.hpp"
 
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -196,6 +198,183 @@ TEST_F(MemPool_test, GetMinFreeMethodReturnsTheNumberOfFreeChunks)
     }
 }
 
+TEST_F(MemPool_test, GetChunkMethodWhenAllTheChunksAreUsedIncreasesExhaustionCount)
+{
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        sut.getChunk();
+    }
+    EXPECT_THAT(sut.getExhaustionCount(), Eq(0U));
+
+    constexpr uint64_t NUMBER_OF_FAILED_REQUESTS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_FAILED_REQUESTS; ++i)
+    {
+        EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+    }
+
+    EXPECT_THAT(sut.getExhaustionCount(), Eq(NUMBER_OF_FAILED_REQUESTS));
+    EXPECT_THAT(sut.getInfo().m_exhaustionCount, Eq(NUMBER_OF_FAILED_REQUESTS));
+}
+
+TEST_F(MemPool_test, TryAcquireExhaustionReportReturnsFailedRequestsOnlyOncePerInterval)
+{
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        sut.getChunk();
+    }
+    sut.getChunk();
+    sut.getChunk();
+
+    auto report = sut.tryAcquireExhaustionReport();
+    ASSERT_TRUE(report.has_value());
+    EXPECT_THAT(report.value(), Eq(2U));
+
+    sut.getChunk();
+    EXPECT_FALSE(sut.tryAcquireExhaustionReport().has_value());
+    EXPECT_THAT(sut.getExhaustionCount(), Eq(3U));
+}
+
+TEST_F(MemPool_test, ExhaustedMemPoolWithoutOverflowIsNotExtended)
+{
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        sut.getChunk();
+    }
+
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+    EXPECT_THAT(sut.getNumberOfExtensions(), Eq(0U));
+    EXPECT_THAT(sut.getChunkCount(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(MemPool_test, ExhaustedMemPoolIsExtendedFromTheOverflow)
+{
+    alignas(MemPool::CHUNK_MEMORY_ALIGNMENT) uint8_t overflowMemory[NUMBER_OF_CHUNKS * CHUNK_SIZE];
+    MemPoolOverflow overflow;
+    overflow.init(overflowMemory, sizeof(overflowMemory));
+    sut.enableExtensions(&overflow, allocator);
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        sut.getChunk();
+    }
+
+    auto chunk = static_cast<uint8_t*>(sut.getChunk());
+
+    ASSERT_THAT(chunk, Ne(nullptr));
+    EXPECT_THAT(chunk, AllOf(Ge(overflowMemory), Lt(overflowMemory + sizeof(overflowMemory))));
+    EXPECT_THAT(sut.getNumberOfExtensions(), Eq(1U));
+    EXPECT_THAT(sut.getChunkCount(), Eq(2U * NUMBER_OF_CHUNKS));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_CHUNKS + 1U));
+    EXPECT_THAT(sut.getInfo().m_numChunks, Eq(2U * NUMBER_OF_CHUNKS));
+    EXPECT_THAT(sut.getExhaustionCount(), Eq(0U));
+}
+
+TEST_F(MemPool_test, ExtensionIsLimitedByTheRemainingOverflowMemory)
+{
+    constexpr uint32_t NUMBER_OF_OVERFLOW_CHUNKS{10U};
+    alignas(MemPool::CHUNK_MEMORY_ALIGNMENT) uint8_t overflowMemory[NUMBER_OF_OVERFLOW_CHUNKS * CHUNK_SIZE];
+    MemPoolOverflow overflow;
+    overflow.init(overflowMemory, sizeof(overflowMemory));
+    sut.enableExtensions(&overflow, allocator);
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS + NUMBER_OF_OVERFLOW_CHUNKS; ++i)
+    {
+        EXPECT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+    EXPECT_THAT(sut.getNumberOfExtensions(), Eq(1U));
+    EXPECT_THAT(sut.getChunkCount(), Eq(NUMBER_OF_CHUNKS + NUMBER_OF_OVERFLOW_CHUNKS));
+    EXPECT_THAT(sut.getExhaustionCount(), Eq(1U));
+}
+
+TEST_F(MemPool_test, MemPoolIsExtendedAtMostMaxNumberOfExtensionsTimes)
+{
+    constexpr uint32_t NUMBER_OF_OVERFLOW_CHUNKS{(MemPool::MAX_NUMBER_OF_EXTENSIONS + 1U) * NUMBER_OF_CHUNKS};
+    std::vector<uint8_t> overflowMemory(NUMBER_OF_OVERFLOW_CHUNKS * CHUNK_SIZE);
+    MemPoolOverflow overflow;
+    overflow.init(overflowMemory.data(), overflowMemory.size());
+    sut.enableExtensions(&overflow, allocator);
+    for (uint32_t i = 0U; i < (MemPool::MAX_NUMBER_OF_EXTENSIONS + 1U) * NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+    EXPECT_THAT(sut.getNumberOfExtensions(), Eq(MemPool::MAX_NUMBER_OF_EXTENSIONS));
+    EXPECT_THAT(overflow.getUsedSize(), Eq(MemPool::MAX_NUMBER_OF_EXTENSIONS * NUMBER_OF_CHUNKS * CHUNK_SIZE));
+}
+
+TEST_F(MemPool_test, ChunksOfExtensionsAreReusedAfterTheyAreFreed)
+{
+    alignas(MemPool::CHUNK_MEMORY_ALIGNMENT) uint8_t overflowMemory[NUMBER_OF_CHUNKS * CHUNK_SIZE];
+    MemPoolOverflow overflow;
+    overflow.init(overflowMemory, sizeof(overflowMemory));
+    sut.enableExtensions(&overflow, allocator);
+    std::vector<void*> chunks;
+    for (uint32_t i = 0U; i < 2U * NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.push_back(sut.getChunk());
+    }
+    for (auto chunk : chunks)
+    {
+        sut.freeChunk(chunk);
+    }
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+
+    for (uint32_t i = 0U; i < 2U * NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+    EXPECT_THAT(sut.getNumberOfExtensions(), Eq(1U));
+    EXPECT_THAT(sut.getMinFree(), Eq(0U));
+}
+
+TEST_F(MemPool_test, ReservedChunksCannotBeAcquiredWithGetChunk)
+{
+    constexpr uint32_t NUMBER_OF_RESERVED_CHUNKS{10U};
+    ASSERT_TRUE(sut.tryToReserveChunks(NUMBER_OF_RESERVED_CHUNKS));
+
+    std::vector<void*> chunks;
+    for (void* chunk = sut.getChunk(); chunk != nullptr; chunk = sut.getChunk())
+    {
+        chunks.push_back(chunk);
+    }
+
+    EXPECT_THAT(chunks.size(), Eq(NUMBER_OF_CHUNKS - NUMBER_OF_RESERVED_CHUNKS));
+    EXPECT_THAT(sut.getReservedChunks(), Eq(NUMBER_OF_RESERVED_CHUNKS));
+    EXPECT_THAT(sut.getReservedChunk(), Ne(nullptr));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_CHUNKS - NUMBER_OF_RESERVED_CHUNKS + 1U));
+}
+
+TEST_F(MemPool_test, ReservationFailsWhenNotEnoughChunksAreAvailable)
+{
+    constexpr uint32_t NUMBER_OF_USED_CHUNKS{95U};
+    for (uint32_t i = 0U; i < NUMBER_OF_USED_CHUNKS; ++i)
+    {
+        ASSERT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+    ASSERT_TRUE(sut.tryToReserveChunks(3U));
+
+    EXPECT_FALSE(sut.tryToReserveChunks(3U));
+    EXPECT_THAT(sut.getReservedChunks(), Eq(3U));
+    EXPECT_TRUE(sut.tryToReserveChunks(2U));
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+}
+
+TEST_F(MemPool_test, ReleasedReservedChunksCanBeAcquiredWithGetChunk)
+{
+    ASSERT_TRUE(sut.tryToReserveChunks(NUMBER_OF_CHUNKS));
+    void* reservedChunk = sut.getReservedChunk();
+    ASSERT_THAT(reservedChunk, Ne(nullptr));
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+
+    sut.freeReservedChunk(reservedChunk);
+    sut.releaseReservedChunks(NUMBER_OF_CHUNKS);
+
+    EXPECT_THAT(sut.getReservedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getChunk(), Ne(nullptr));
+}
+
 TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsSmallerThan32Bytes)
 {
     EXPECT_DEATH({ iox::mepoo::MemPool sut(12, 10, allocator, allocator); }, ".*");
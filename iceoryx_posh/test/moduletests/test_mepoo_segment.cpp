@@ -79,6 +79,17 @@ class MePooSegment_test : public Test
             m_isInitialized = true;
         }
 
+        SharedMemoryObject_MOCK(iox::posix::CreateUnnamedSingleProcessMemory_t,
+                                const uint64_t memorySizeInBytes,
+                                const void* baseAddressHint)
+            : m_memorySizeInBytes(memorySizeInBytes)
+            , m_baseAddressHint(const_cast<void*>(baseAddressHint))
+            , m_isSingleProcessMemory(true)
+        {
+            filehandle = SharedMemory::INVALID_HANDLE;
+            m_isInitialized = true;
+        }
+
         ~SharedMemoryObject_MOCK()
         {
             remove("/tmp/roudi_segment_test");
@@ -113,8 +124,14 @@ class MePooSegment_test : public Test
             return m_baseAddressHint;
         }
 
+        bool isSingleProcessMemory() const
+        {
+            return m_isSingleProcessMemory;
+        }
+
         uint64_t m_memorySizeInBytes{0};
         void* m_baseAddressHint{nullptr};
+        bool m_isSingleProcessMemory{false};
         static constexpr int MEM_SIZE = 100000;
         char memory[MEM_SIZE];
         std::shared_ptr<iox::posix::Allocator> allocator{new iox::posix::Allocator(memory, MEM_SIZE)};
@@ -184,6 +201,30 @@ TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(GetSharedMemoryObject))
     EXPECT_THAT(sut2.getSharedMemoryObject().getSizeInBytes(), Eq(memorySizeInBytes));
 }
 
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(SingleProcessScopeCreatesSingleProcessMemory))
+{
+    bool sharedMemoryCreated{false};
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator =
+        [&](const SharedMemory::Name_t,
+            const uint64_t,
+            const iox::posix::AccessMode,
+            const iox::posix::OpenMode,
+            const void*,
+            const mode_t) { sharedMemoryCreated = true; };
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{mepooConfig,
+                                                              m_managementAllocator,
+                                                              {"iox_roudi_test1"},
+                                                              {"iox_roudi_test2"},
+                                                              iox::mepoo::MemoryInfo(),
+                                                              iox::roudi::ProcessScope::SINGLE_PROCESS};
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator =
+        MePooSegment_test::SharedMemoryObject_MOCK::createFct();
+
+    EXPECT_FALSE(sharedMemoryCreated);
+    EXPECT_TRUE(sut2.getSharedMemoryObject().isSingleProcessMemory());
+    ASSERT_THAT(sut2.getMemoryManager().getNumberOfMemPools(), Eq(1U));
+}
+
 TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(GetReaderGroup))
 {
     EXPECT_THAT(sut.getReaderGroup(), Eq(iox::posix::PosixGroup("iox_roudi_test1")));
@@ -40,7 +40,8 @@ class MePooSegmentMock
                      Allocator& managementAllocator IOX_MAYBE_UNUSED,
                      const PosixGroup& readerGroup IOX_MAYBE_UNUSED,
                      const PosixGroup& writerGroup IOX_MAYBE_UNUSED,
-                     const MemoryInfo& memoryInfo IOX_MAYBE_UNUSED) noexcept
+                     const MemoryInfo& memoryInfo IOX_MAYBE_UNUSED,
+                     const iox::roudi::ProcessScope processScope IOX_MAYBE_UNUSED) noexcept
     {
     }
 };
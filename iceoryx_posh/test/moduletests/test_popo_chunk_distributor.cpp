@@ -15,6 +15,7 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include "iceoryx_hoofs/cxx/generic_raii.hpp"
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
@@ -64,6 +65,26 @@ class ChunkDistributor_test : public Test
         *static_cast<uint32_t*>(chunkHeader->userPayload()) = value;
         return SharedChunk(chunkMgmt);
     }
+    SharedChunk allocateChunkWithUserHeader(uint32_t value, uint32_t userHeaderValue)
+    {
+        ChunkManagement* chunkMgmt = static_cast<ChunkManagement*>(chunkMgmtPool.getChunk());
+        auto chunk = mempool.getChunk();
+
+        auto chunkSettingsResult = ChunkSettings::create(
+            sizeof(uint32_t), alignof(uint32_t), sizeof(userHeaderValue), alignof(uint32_t));
+        EXPECT_FALSE(chunkSettingsResult.has_error());
+        if (chunkSettingsResult.has_error())
+        {
+            return nullptr;
+        }
+        auto& chunkSettings = chunkSettingsResult.value();
+
+        ChunkHeader* chunkHeader = new (chunk) ChunkHeader(mempool.getChunkSize(), chunkSettings);
+        new (chunkMgmt) ChunkManagement{chunkHeader, &mempool, &chunkMgmtPool};
+        *static_cast<uint32_t*>(chunkHeader->userHeader()) = userHeaderValue;
+        *static_cast<uint32_t*>(chunkHeader->userPayload()) = value;
+        return SharedChunk(chunkMgmt);
+    }
     uint32_t getSharedChunkValue(const SharedChunk& chunk)
     {
         return *static_cast<uint32_t*>(chunk.getUserPayload());
@@ -98,6 +119,9 @@ class ChunkDistributor_test : public Test
     void SetUp(){};
     void TearDown(){};
 
+    GenericRAII m_uniqueRouDiId{[] { iox::popo::internal::setUniqueRouDiId(0U); },
+                                [] { iox::popo::internal::unsetUniqueRouDiId(); }};
+
     std::shared_ptr<ChunkQueueData_t>
     getChunkQueueData(const QueueFullPolicy policy = QueueFullPolicy::DISCARD_OLDEST_DATA,
                       const VariantQueueTypes queueType = VariantQueueTypes::SoFi_SingleProducerSingleConsumer)
@@ -371,6 +395,87 @@ TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithMultipleQueuesMult
     EXPECT_THAT(sut.getHistorySize(), Eq(limit));
 }
 
+TYPED_TEST(ChunkDistributor_test, GetQueueIndexReturnsIndexOfStoredQueue)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+
+    auto index = sut.getQueueIndex(queueData2->m_uniqueId, 0U);
+
+    ASSERT_TRUE(index.has_value());
+    EXPECT_THAT(index.value(), Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, GetQueueIndexOfRemovedQueueReturnsNothing)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+    EXPECT_FALSE(sut.getQueueIndex(queueData->m_uniqueId, 0U).has_value());
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithUniqueIdDeliversOnlyToThisQueue)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+
+    EXPECT_FALSE(sut.deliverToQueue(queueData2->m_uniqueId, 1U, this->allocateChunk(7331U)).has_error());
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue1(queueData1.get());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue2(queueData2.get());
+    EXPECT_FALSE(queue1.tryPop().has_value());
+    auto maybeSharedChunk = queue2.tryPop();
+    ASSERT_TRUE(maybeSharedChunk.has_value());
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(7331U));
+    EXPECT_THAT(sut.getHistorySize(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithOutdatedIndexFindsQueue)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData1.get()).has_error());
+
+    EXPECT_FALSE(sut.deliverToQueue(queueData2->m_uniqueId, 1U, this->allocateChunk(42U)).has_error());
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue2(queueData2.get());
+    EXPECT_TRUE(queue2.tryPop().has_value());
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToQueueWhichIsNotStoredFails)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+
+    auto result = sut.deliverToQueue(queueData->m_uniqueId, 0U, this->allocateChunk(42U));
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER));
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
 TYPED_TEST(ChunkDistributor_test, AddToHistoryWithoutQueues)
 {
     auto sutData = this->getChunkDistributorData();
@@ -412,6 +517,75 @@ TYPED_TEST(ChunkDistributor_test, addToHistoryWithoutDelivery)
     EXPECT_THAT(sut.getHistorySize(), Eq(limit));
 }
 
+TYPED_TEST(ChunkDistributor_test, HistoryKeepsTheLatestChunksWhenAddingMoreThanCapacity)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    const auto limit = 3U * this->HISTORY_SIZE + 5U;
+    for (auto i = 0U; i < limit; ++i)
+    {
+        sut.addToHistoryWithoutDelivery(this->allocateChunk(static_cast<uint32_t>(i)));
+    }
+
+    EXPECT_THAT(sut.getHistorySize(), Eq(this->HISTORY_SIZE));
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(this->HISTORY_SIZE));
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), this->HISTORY_SIZE).has_error());
+
+    // the history is delivered in the order oldest to newest
+    ASSERT_THAT(queue.size(), Eq(this->HISTORY_SIZE));
+    for (auto i = limit - this->HISTORY_SIZE; i < limit; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, ClearHistoryAfterHistoryWrappedAroundReleasesAllChunks)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    const auto limit = this->HISTORY_SIZE + 3U;
+    for (auto i = 0U; i < limit; ++i)
+    {
+        sut.addToHistoryWithoutDelivery(this->allocateChunk(static_cast<uint32_t>(i)));
+    }
+
+    sut.clearHistory();
+
+    EXPECT_THAT(sut.getHistorySize(), Eq(0U));
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, HistoryIsFilledFromTheStartAfterClearOfWrappedHistory)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    for (auto i = 0U; i < this->HISTORY_SIZE + 3U; ++i)
+    {
+        sut.addToHistoryWithoutDelivery(this->allocateChunk(static_cast<uint32_t>(i)));
+    }
+    sut.clearHistory();
+
+    sut.addToHistoryWithoutDelivery(this->allocateChunk(73U));
+    sut.addToHistoryWithoutDelivery(this->allocateChunk(74U));
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), this->HISTORY_SIZE).has_error());
+
+    ASSERT_THAT(queue.size(), Eq(2U));
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(73U));
+    maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(74U));
+}
+
 TYPED_TEST(ChunkDistributor_test, DeliverToQueueDirectlyWhenNotAdded)
 {
     auto sutData = this->getChunkDistributorData();
@@ -553,6 +727,149 @@ TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddWithMoreThanAvailable)
     EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(3u));
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesSkipsQueuesWhoseFilterDoesNotMatch)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto filteredQueueData = this->getChunkQueueData();
+    filteredQueueData->m_userHeaderFilter = UserHeaderFilter::fieldEquals(0U, uint32_t{7U});
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> filteredQueue(filteredQueueData.get());
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(filteredQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(1U, 8U));
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(2U, 7U));
+
+    EXPECT_THAT(queue.size(), Eq(2U));
+    ASSERT_THAT(filteredQueue.size(), Eq(1U));
+    auto maybeSharedChunk = filteredQueue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(2U));
+    EXPECT_FALSE(filteredQueue.hasLostChunks());
+    EXPECT_THAT(sut.getHistorySize(), Eq(2U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddSkipsChunksWhichDoNotMatchTheFilter)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(1U, 7U));
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(2U, 8U));
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(3U, 7U));
+
+    auto queueData = this->getChunkQueueData();
+    queueData->m_userHeaderFilter = UserHeaderFilter::fieldEquals(0U, uint32_t{7U});
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 3U).has_error());
+
+    ASSERT_THAT(queue.size(), Eq(2U));
+    EXPECT_THAT(this->getSharedChunkValue(*queue.tryPop()), Eq(1U));
+    EXPECT_THAT(this->getSharedChunkValue(*queue.tryPop()), Eq(3U));
+}
+
+TYPED_TEST(ChunkDistributor_test, ChunkWhichDoesNotMatchTheFilterDoesNotBlockAtFullBlockingQueue)
+{
+    auto sutData = this->getChunkDistributorData(SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PUBLISHER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    queueData->m_userHeaderFilter = UserHeaderFilter::fieldEquals(0U, uint32_t{7U});
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(1U, 7U));
+
+    // would block forever if the chunk was not filtered out
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(2U, 8U));
+
+    EXPECT_THAT(queue.size(), Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesDeliversOnlyEveryNthChunkToDecimatedQueue)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto decimatedQueueData = this->getChunkQueueData();
+    decimatedQueueData->m_deliveryRateLimiter.setLimits(3U, iox::units::Duration::fromNanoseconds(0U));
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> decimatedQueue(decimatedQueueData.get());
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(decimatedQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    for (uint32_t i = 0U; i < 7U; ++i)
+    {
+        sut.deliverToAllStoredQueues(this->allocateChunk(i));
+    }
+
+    ASSERT_THAT(decimatedQueue.size(), Eq(3U));
+    EXPECT_THAT(this->getSharedChunkValue(*decimatedQueue.tryPop()), Eq(0U));
+    EXPECT_THAT(this->getSharedChunkValue(*decimatedQueue.tryPop()), Eq(3U));
+    EXPECT_THAT(this->getSharedChunkValue(*decimatedQueue.tryPop()), Eq(6U));
+    EXPECT_FALSE(decimatedQueue.hasLostChunks());
+    EXPECT_THAT(queue.size(), Eq(7U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DecimationCountsOnlyTheChunksWhichMatchTheFilter)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    queueData->m_userHeaderFilter = UserHeaderFilter::fieldEquals(0U, uint32_t{7U});
+    queueData->m_deliveryRateLimiter.setLimits(2U, iox::units::Duration::fromNanoseconds(0U));
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(1U, 7U));
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(2U, 8U));
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(3U, 7U));
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(4U, 7U));
+
+    ASSERT_THAT(queue.size(), Eq(2U));
+    EXPECT_THAT(this->getSharedChunkValue(*queue.tryPop()), Eq(1U));
+    EXPECT_THAT(this->getSharedChunkValue(*queue.tryPop()), Eq(4U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddIsNotDownsampled)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    sut.deliverToAllStoredQueues(this->allocateChunk(1U));
+    sut.deliverToAllStoredQueues(this->allocateChunk(2U));
+    sut.deliverToAllStoredQueues(this->allocateChunk(3U));
+
+    auto queueData = this->getChunkQueueData();
+    queueData->m_deliveryRateLimiter.setLimits(10U, iox::units::Duration::fromSeconds(3600U));
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 3U).has_error());
+
+    EXPECT_THAT(queue.size(), Eq(3U));
+}
+
+TYPED_TEST(ChunkDistributor_test, RetriedDeliveryToBlockingQueueIsNotCountedAgainByTheDecimation)
+{
+    auto sutData = this->getChunkDistributorData(SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PUBLISHER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    queueData->m_deliveryRateLimiter.setLimits(2U, iox::units::Duration::fromNanoseconds(0U));
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(1U));
+    sut.deliverToAllStoredQueues(this->allocateChunk(2U));
+
+    std::thread t1([&] { sut.deliverToAllStoredQueues(this->allocateChunk(3U)); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(this->TIMEOUT_IN_MS));
+    EXPECT_THAT(this->getSharedChunkValue(*queue.tryPop()), Eq(1U));
+    t1.join();
+
+    ASSERT_THAT(queue.size(), Eq(1U));
+    EXPECT_THAT(this->getSharedChunkValue(*queue.tryPop()), Eq(3U));
+}
+
 TYPED_TEST(ChunkDistributor_test, DeliverToSingleQueueBlocksWhenOptionsAreSetToBlocking)
 {
     auto sutData = this->getChunkDistributorData(SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER);
@@ -28,6 +28,10 @@
 
 #include "test.hpp"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -383,4 +387,82 @@ TYPED_TEST(ChunkQueueSoFi_test, LostChunkInfoIsResetAfterRead)
     EXPECT_FALSE(this->m_popper.hasLostChunks());
 }
 
+class ChunkQueueMultiProducer_test : public Test, public ChunkQueue_testBase
+{
+  public:
+    using ChunkQueueData_t = ChunkQueueData<iox::DefaultChunkQueueConfig, ThreadSafePolicy>;
+
+    ChunkQueueData_t m_chunkData{QueueFullPolicy::BLOCK_PUBLISHER,
+                                 iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer};
+    ChunkQueuePopper<ChunkQueueData_t> m_popper{&m_chunkData};
+    ChunkQueuePusher<ChunkQueueData_t> m_pusher{&m_chunkData};
+};
+
+TEST_F(ChunkQueueMultiProducer_test, ConcurrentPushWhileConditionVariableIsReattachedLosesNoChunk)
+{
+    constexpr uint32_t NUMBER_OF_PRODUCERS{4U};
+    constexpr uint32_t CHUNKS_PER_PRODUCER{50U};
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    m_popper.setConditionVariable(condVar, 0U);
+
+    std::atomic_bool keepRunning{true};
+    std::vector<std::thread> producers;
+    for (uint32_t i = 0U; i < NUMBER_OF_PRODUCERS; ++i)
+    {
+        producers.emplace_back([&] {
+            for (uint32_t k = 0U; k < CHUNKS_PER_PRODUCER; ++k)
+            {
+                EXPECT_TRUE(m_pusher.push(allocateChunk()));
+            }
+        });
+    }
+
+    std::thread reattacher([&] {
+        while (keepRunning.load())
+        {
+            m_popper.unsetConditionVariable();
+            m_popper.setConditionVariable(condVar, 0U);
+        }
+    });
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    keepRunning.store(false);
+    reattacher.join();
+
+    uint32_t numberOfPoppedChunks{0U};
+    while (m_popper.tryPop().has_value())
+    {
+        ++numberOfPoppedChunks;
+    }
+    EXPECT_THAT(numberOfPoppedChunks, Eq(NUMBER_OF_PRODUCERS * CHUNKS_PER_PRODUCER));
+
+    condVarWaiter.timedWait(1_ns);
+    EXPECT_TRUE(m_pusher.push(allocateChunk()));
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+}
+
+TEST_F(ChunkQueueMultiProducer_test, UnsetConditionVariableDuringConcurrentPushIsNotNotifiedAnymore)
+{
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    m_popper.setConditionVariable(condVar, 0U);
+
+    std::thread producer([&] {
+        for (uint32_t k = 0U; k < 100U; ++k)
+        {
+            EXPECT_TRUE(m_pusher.push(allocateChunk()));
+        }
+    });
+    m_popper.unsetConditionVariable();
+    // collect the notifications which were issued before the detach returned
+    condVarWaiter.timedWait(1_ns);
+    producer.join();
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+}
+
 } // namespace
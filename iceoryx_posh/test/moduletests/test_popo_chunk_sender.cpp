@@ -198,6 +198,25 @@ TEST_F(ChunkSender_test, allocate_Overflow)
                 Eq(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY));
 }
 
+TEST_F(ChunkSender_test, allocate_ChunkWhenChunkQuotaIsExceededFails)
+{
+    constexpr uint32_t MAX_CHUNKS_IN_USE{2U};
+    m_chunkSenderData.m_chunkQuota = m_memoryManager.acquireChunkQuota({MAX_CHUNKS_IN_USE, 0U});
+    for (uint32_t i = 0U; i < MAX_CHUNKS_IN_USE; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            iox::UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        EXPECT_FALSE(maybeChunkHeader.has_error());
+    }
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        iox::UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+    EXPECT_THAT(maybeChunkHeader.get_error(), Eq(iox::popo::AllocationError::CHUNK_QUOTA_EXCEEDED));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(MAX_CHUNKS_IN_USE));
+}
+
 TEST_F(ChunkSender_test, freeChunk)
 {
     std::vector<iox::mepoo::ChunkHeader*> chunks;
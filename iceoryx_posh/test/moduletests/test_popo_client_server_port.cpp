@@ -0,0 +1,318 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/generic_raii.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_roudi.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_roudi.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_user.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "test.hpp"
+
+#include <memory>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+class ClientServerPort_test : public Test
+{
+  protected:
+    ClientServerPort_test()
+    {
+        m_mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS_IN_POOL});
+        m_memoryManager.configureMemoryManager(m_mempoolconf, m_memoryAllocator, m_memoryAllocator);
+    }
+
+    /// @brief emulates the port manager of RouDi by exchanging the CaPro messages between a client and the server
+    void connect(ClientPortRouDi& client)
+    {
+        auto offer = m_serverRouDi.tryGetCaProMessage();
+        if (offer.has_value())
+        {
+            client.dispatchCaProMessageAndGetPossibleResponse(offer.value());
+        }
+
+        auto connectRequest = client.tryGetCaProMessage();
+        ASSERT_TRUE(connectRequest.has_value());
+        EXPECT_THAT(connectRequest->m_type, Eq(iox::capro::CaproMessageType::SUB));
+        auto acknowledge = m_serverRouDi.dispatchCaProMessageAndGetPossibleResponse(connectRequest.value());
+        ASSERT_TRUE(acknowledge.has_value());
+        client.dispatchCaProMessageAndGetPossibleResponse(acknowledge.value());
+    }
+
+    RequestHeader* sendRequest(ClientPortUser& client, const uint64_t value)
+    {
+        auto allocateResult = client.allocateRequest(sizeof(uint64_t), alignof(uint64_t));
+        EXPECT_FALSE(allocateResult.has_error());
+        if (allocateResult.has_error())
+        {
+            return nullptr;
+        }
+        auto requestHeader = allocateResult.value();
+        *static_cast<uint64_t*>(requestHeader->getUserPayload()) = value;
+        client.sendRequest(requestHeader);
+        return requestHeader;
+    }
+
+    static constexpr size_t MEMORY_SIZE = 1024 * 1024;
+    uint8_t m_memory[MEMORY_SIZE];
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL = 20;
+    static constexpr uint32_t CHUNK_SIZE = 256;
+
+    iox::cxx::GenericRAII m_uniqueRouDiId{[] { iox::popo::internal::setUniqueRouDiId(0); },
+                                          [] { iox::popo::internal::unsetUniqueRouDiId(); }};
+
+    iox::posix::Allocator m_memoryAllocator{m_memory, MEMORY_SIZE};
+    iox::mepoo::MePooConfig m_mempoolconf;
+    iox::mepoo::MemoryManager m_memoryManager;
+
+    iox::capro::ServiceDescription m_serviceDescription{"Calculator", "Instance", "Add"};
+
+    std::unique_ptr<ServerPortData> m_serverData{
+        new ServerPortData(m_serviceDescription, "server", iox::NodeName_t(""), &m_memoryManager)};
+    ServerPortRouDi m_serverRouDi{m_serverData.get()};
+    ServerPortUser m_serverUser{m_serverData.get()};
+
+    std::unique_ptr<ClientPortData> m_clientDataA{
+        new ClientPortData(m_serviceDescription, "clientA", iox::NodeName_t(""), &m_memoryManager)};
+    ClientPortRouDi m_clientRouDiA{m_clientDataA.get()};
+    ClientPortUser m_clientUserA{m_clientDataA.get()};
+
+    std::unique_ptr<ClientPortData> m_clientDataB{
+        new ClientPortData(m_serviceDescription, "clientB", iox::NodeName_t(""), &m_memoryManager)};
+    ClientPortRouDi m_clientRouDiB{m_clientDataB.get()};
+    ClientPortUser m_clientUserB{m_clientDataB.get()};
+};
+
+TEST_F(ClientServerPort_test, InitiallyClientIsNotConnectedAndServerHasNoClients)
+{
+    EXPECT_THAT(m_clientUserA.getConnectionState(), Eq(iox::ConnectionState::NOT_CONNECTED));
+    EXPECT_FALSE(m_serverUser.hasClients());
+}
+
+TEST_F(ClientServerPort_test, ConnectToOfferedServerResultsInConnectedState)
+{
+    m_serverUser.offer();
+    m_clientUserA.connect();
+
+    connect(m_clientRouDiA);
+
+    EXPECT_THAT(m_clientUserA.getConnectionState(), Eq(iox::ConnectionState::CONNNECTED));
+    EXPECT_TRUE(m_serverUser.hasClients());
+}
+
+TEST_F(ClientServerPort_test, ConnectToNotOfferedServerWaitsForOffer)
+{
+    m_clientUserA.connect();
+
+    connect(m_clientRouDiA);
+
+    EXPECT_THAT(m_clientUserA.getConnectionState(), Eq(iox::ConnectionState::WAIT_FOR_OFFER));
+
+    m_serverUser.offer();
+    auto offer = m_serverRouDi.tryGetCaProMessage();
+    ASSERT_TRUE(offer.has_value());
+    auto connectRequest = m_clientRouDiA.dispatchCaProMessageAndGetPossibleResponse(offer.value());
+    ASSERT_TRUE(connectRequest.has_value());
+    auto acknowledge = m_serverRouDi.dispatchCaProMessageAndGetPossibleResponse(connectRequest.value());
+    ASSERT_TRUE(acknowledge.has_value());
+    m_clientRouDiA.dispatchCaProMessageAndGetPossibleResponse(acknowledge.value());
+
+    EXPECT_THAT(m_clientUserA.getConnectionState(), Eq(iox::ConnectionState::CONNNECTED));
+}
+
+TEST_F(ClientServerPort_test, RequestIsReceivedByServerWithSequenceNumberAndPayload)
+{
+    constexpr uint64_t REQUEST_VALUE{73U};
+    m_serverUser.offer();
+    m_clientUserA.connect();
+    connect(m_clientRouDiA);
+
+    sendRequest(m_clientUserA, 1U);
+    sendRequest(m_clientUserA, REQUEST_VALUE);
+
+    auto firstRequest = m_serverUser.getRequest();
+    ASSERT_FALSE(firstRequest.has_error());
+    ASSERT_TRUE(firstRequest.value().has_value());
+    EXPECT_THAT(firstRequest.value().value()->getSequenceNumber(), Eq(0));
+    m_serverUser.releaseRequest(firstRequest.value().value());
+
+    auto secondRequest = m_serverUser.getRequest();
+    ASSERT_FALSE(secondRequest.has_error());
+    ASSERT_TRUE(secondRequest.value().has_value());
+    EXPECT_THAT(secondRequest.value().value()->getSequenceNumber(), Eq(1));
+    EXPECT_THAT(*static_cast<const uint64_t*>(secondRequest.value().value()->getUserPayload()), Eq(REQUEST_VALUE));
+    m_serverUser.releaseRequest(secondRequest.value().value());
+}
+
+TEST_F(ClientServerPort_test, GetRequestWithoutRequestReturnsEmptyOptional)
+{
+    auto request = m_serverUser.getRequest();
+
+    ASSERT_FALSE(request.has_error());
+    EXPECT_FALSE(request.value().has_value());
+}
+
+TEST_F(ClientServerPort_test, ResponseIsOnlyDeliveredToRequestingClient)
+{
+    constexpr uint64_t RESPONSE_VALUE{42U};
+    m_serverUser.offer();
+    m_clientUserA.connect();
+    connect(m_clientRouDiA);
+    m_clientUserB.connect();
+    connect(m_clientRouDiB);
+
+    sendRequest(m_clientUserB, 0U);
+
+    auto request = m_serverUser.getRequest();
+    ASSERT_FALSE(request.has_error());
+    ASSERT_TRUE(request.value().has_value());
+    auto response = m_serverUser.allocateResponse(request.value().value(), sizeof(uint64_t), alignof(uint64_t));
+    ASSERT_FALSE(response.has_error());
+    *static_cast<uint64_t*>(response.value()->getUserPayload()) = RESPONSE_VALUE;
+    m_serverUser.releaseRequest(request.value().value());
+    EXPECT_TRUE(m_serverUser.sendResponse(response.value()));
+
+    EXPECT_FALSE(m_clientUserA.hasNewResponses());
+    ASSERT_TRUE(m_clientUserB.hasNewResponses());
+    auto receivedResponse = m_clientUserB.getResponse();
+    ASSERT_FALSE(receivedResponse.has_error());
+    ASSERT_TRUE(receivedResponse.value().has_value());
+    EXPECT_THAT(receivedResponse.value().value()->getSequenceNumber(), Eq(0));
+    EXPECT_THAT(*static_cast<const uint64_t*>(receivedResponse.value().value()->getUserPayload()), Eq(RESPONSE_VALUE));
+    m_clientUserB.releaseResponse(receivedResponse.value().value());
+}
+
+TEST_F(ClientServerPort_test, ResponseProvidesIndexOfClientQueueForTheNextRequest)
+{
+    m_serverUser.offer();
+    m_clientUserA.connect();
+    connect(m_clientRouDiA);
+    m_clientUserB.connect();
+    connect(m_clientRouDiB);
+
+    auto firstRequest = sendRequest(m_clientUserB, 0U);
+    ASSERT_THAT(firstRequest, Ne(nullptr));
+    EXPECT_THAT(firstRequest->getLastKnownClientQueueIndex(), Eq(RPCBaseHeader::UNKNOWN_CLIENT_QUEUE_INDEX + 0U));
+
+    auto request = m_serverUser.getRequest();
+    ASSERT_FALSE(request.has_error());
+    ASSERT_TRUE(request.value().has_value());
+    auto response = m_serverUser.allocateResponse(request.value().value(), sizeof(uint64_t), alignof(uint64_t));
+    ASSERT_FALSE(response.has_error());
+    EXPECT_THAT(response.value()->getLastKnownClientQueueIndex(), Eq(1U));
+    m_serverUser.releaseRequest(request.value().value());
+    EXPECT_TRUE(m_serverUser.sendResponse(response.value()));
+
+    auto receivedResponse = m_clientUserB.getResponse();
+    ASSERT_FALSE(receivedResponse.has_error());
+    ASSERT_TRUE(receivedResponse.value().has_value());
+    m_clientUserB.releaseResponse(receivedResponse.value().value());
+
+    auto secondRequest = sendRequest(m_clientUserB, 0U);
+    ASSERT_THAT(secondRequest, Ne(nullptr));
+    EXPECT_THAT(secondRequest->getLastKnownClientQueueIndex(), Eq(1U));
+}
+
+TEST_F(ClientServerPort_test, ResponseIsRoutedToRequestingClientAfterAnotherClientDisconnected)
+{
+    m_serverUser.offer();
+    m_clientUserA.connect();
+    connect(m_clientRouDiA);
+    m_clientUserB.connect();
+    connect(m_clientRouDiB);
+
+    sendRequest(m_clientUserB, 0U);
+    auto request = m_serverUser.getRequest();
+    ASSERT_FALSE(request.has_error());
+    ASSERT_TRUE(request.value().has_value());
+    auto response = m_serverUser.allocateResponse(request.value().value(), sizeof(uint64_t), alignof(uint64_t));
+    ASSERT_FALSE(response.has_error());
+    m_serverUser.releaseRequest(request.value().value());
+
+    // the queue of client B moves to index 0 and the index in the response is outdated
+    m_clientUserA.disconnect();
+    auto disconnectRequest = m_clientRouDiA.tryGetCaProMessage();
+    ASSERT_TRUE(disconnectRequest.has_value());
+    m_serverRouDi.dispatchCaProMessageAndGetPossibleResponse(disconnectRequest.value());
+
+    EXPECT_TRUE(m_serverUser.sendResponse(response.value()));
+    EXPECT_TRUE(m_clientUserB.hasNewResponses());
+}
+
+TEST_F(ClientServerPort_test, ResponseToDisconnectedClientIsDiscarded)
+{
+    m_serverUser.offer();
+    m_clientUserA.connect();
+    connect(m_clientRouDiA);
+    sendRequest(m_clientUserA, 0U);
+    auto request = m_serverUser.getRequest();
+    ASSERT_FALSE(request.has_error());
+    ASSERT_TRUE(request.value().has_value());
+    auto response = m_serverUser.allocateResponse(request.value().value(), sizeof(uint64_t), alignof(uint64_t));
+    ASSERT_FALSE(response.has_error());
+    m_serverUser.releaseRequest(request.value().value());
+
+    m_clientUserA.disconnect();
+    auto disconnectRequest = m_clientRouDiA.tryGetCaProMessage();
+    ASSERT_TRUE(disconnectRequest.has_value());
+    EXPECT_THAT(disconnectRequest->m_type, Eq(iox::capro::CaproMessageType::UNSUB));
+    auto acknowledge = m_serverRouDi.dispatchCaProMessageAndGetPossibleResponse(disconnectRequest.value());
+    ASSERT_TRUE(acknowledge.has_value());
+    m_clientRouDiA.dispatchCaProMessageAndGetPossibleResponse(acknowledge.value());
+
+    EXPECT_THAT(m_clientUserA.getConnectionState(), Eq(iox::ConnectionState::NOT_CONNECTED));
+    EXPECT_FALSE(m_serverUser.sendResponse(response.value()));
+    EXPECT_FALSE(m_clientUserA.hasNewResponses());
+}
+
+TEST_F(ClientServerPort_test, StopOfferDisconnectsClients)
+{
+    m_serverUser.offer();
+    m_clientUserA.connect();
+    connect(m_clientRouDiA);
+
+    m_serverUser.stopOffer();
+    auto stopOffer = m_serverRouDi.tryGetCaProMessage();
+    ASSERT_TRUE(stopOffer.has_value());
+    EXPECT_THAT(stopOffer->m_type, Eq(iox::capro::CaproMessageType::STOP_OFFER));
+    m_clientRouDiA.dispatchCaProMessageAndGetPossibleResponse(stopOffer.value());
+
+    EXPECT_FALSE(m_serverUser.hasClients());
+    EXPECT_THAT(m_clientUserA.getConnectionState(), Eq(iox::ConnectionState::WAIT_FOR_OFFER));
+    sendRequest(m_clientUserA, 0U);
+    EXPECT_FALSE(m_serverUser.hasNewRequests());
+}
+
+TEST_F(ClientServerPort_test, FreedRequestAndResponseChunksAreReturnedToTheMempool)
+{
+    m_serverUser.offer();
+    m_clientUserA.connect();
+    connect(m_clientRouDiA);
+
+    auto request = m_clientUserA.allocateRequest(sizeof(uint64_t), alignof(uint64_t));
+    ASSERT_FALSE(request.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(1U));
+    m_clientUserA.freeRequest(request.value());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+}
+
+} // namespace
@@ -89,6 +89,38 @@ TEST_F(ConditionVariable_test, NoNotifyResultsInNotBeingTriggered)
     EXPECT_FALSE(m_waiter.wasNotified());
 }
 
+TEST_F(ConditionVariable_test, NotifyWithoutSleepingListenerDoesNotPostSemaphore)
+{
+    m_signaler.notify();
+    m_signaler.notify();
+
+    auto semaphoreValue = m_condVarData.m_semaphore.getValue();
+    ASSERT_FALSE(semaphoreValue.has_error());
+    EXPECT_THAT(semaphoreValue.value(), Eq(0));
+    EXPECT_TRUE(m_waiter.wasNotified());
+    EXPECT_THAT(m_waiter.wait().size(), Eq(1U));
+}
+
+TEST_F(ConditionVariable_test, NotifyWithSleepingListenerPostsSemaphore)
+{
+    std::atomic_bool isThreadFinished{false};
+    std::thread t([&] {
+        m_waiter.wait();
+        isThreadFinished = true;
+    });
+
+    while (m_condVarData.m_numberOfSleepingWaiters.load() == 0U)
+    {
+        std::this_thread::yield();
+    }
+    EXPECT_FALSE(isThreadFinished.load());
+
+    m_signaler.notify();
+    t.join();
+    EXPECT_TRUE(isThreadFinished.load());
+    EXPECT_THAT(m_condVarData.m_numberOfSleepingWaiters.load(), Eq(0U));
+}
+
 TEST_F(ConditionVariable_test, WaitResetsAllNotificationsInWait)
 {
     m_signaler.notify();
@@ -146,6 +178,23 @@ TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstructionWithRunt
     }
 }
 
+TEST_F(ConditionVariable_test, SingleProcessScopeConditionVariableWakesUpWaiter)
+{
+    ConditionVariableData sut(m_runtimeName, iox::roudi::ProcessScope::SINGLE_PROCESS);
+    ConditionListener listener(sut);
+    ConditionNotifier notifier(sut, 0U);
+
+    std::thread waiter([&] {
+        IOX_DISCARD_RESULT(m_syncSemaphore.post());
+        auto notifications = listener.wait();
+        ASSERT_THAT(notifications.size(), Eq(1U));
+        EXPECT_THAT(notifications[0], Eq(0U));
+    });
+    IOX_DISCARD_RESULT(m_syncSemaphore.wait());
+    notifier.notify();
+    waiter.join();
+}
+
 TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
 {
     constexpr Type_t EVENT_INDEX = iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER - 1U;
@@ -468,4 +517,69 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsSortedListWhenTriggeredInReverseO
         *this, [this] { return m_waiter.timedWait(iox::units::Duration::fromSeconds(1)); });
 }
 
+TEST_F(ConditionVariable_test, SpinningWaitReturnsNotificationWithoutPostingSemaphore)
+{
+    ConditionListener sut(m_condVarData, WaitOptions{WaitStrategy::SPIN_THEN_BLOCK, 1_s});
+    std::atomic_bool isThreadFinished{false};
+    std::thread t([&] {
+        EXPECT_THAT(sut.wait().size(), Eq(1U));
+        isThreadFinished = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    m_signaler.notify();
+    t.join();
+
+    EXPECT_TRUE(isThreadFinished.load());
+    EXPECT_THAT(m_condVarData.m_semaphore.getValue().value(), Eq(0));
+}
+
+TEST_F(ConditionVariable_test, SpinningWaitBlocksAfterSpinDuration)
+{
+    ConditionListener sut(m_condVarData, WaitOptions{WaitStrategy::SPIN_THEN_BLOCK, 1_ms});
+    std::thread t([&] { EXPECT_THAT(sut.wait().size(), Eq(1U)); });
+
+    while (m_condVarData.m_numberOfSleepingWaiters.load() == 0U)
+    {
+        std::this_thread::yield();
+    }
+
+    m_signaler.notify();
+    t.join();
+}
+
+TEST_F(ConditionVariable_test, SpinningTimedWaitWithoutNotificationReturnsEmptyVector)
+{
+    ConditionListener sut(m_condVarData, WaitOptions{WaitStrategy::SPIN_THEN_BLOCK, 10_ms});
+    EXPECT_TRUE(sut.timedWait(20_ms).empty());
+}
+
+TEST_F(ConditionVariable_test, BusyPollingWaitReturnsNotificationAndNeverSleeps)
+{
+    ConditionListener sut(m_condVarData, WaitOptions{WaitStrategy::BUSY_POLL, 0_s});
+    std::thread t([&] { EXPECT_THAT(sut.wait().size(), Eq(1U)); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_THAT(m_condVarData.m_numberOfSleepingWaiters.load(), Eq(0U));
+    m_signaler.notify();
+    t.join();
+}
+
+TEST_F(ConditionVariable_test, BusyPollingTimedWaitWithoutNotificationReturnsEmptyVector)
+{
+    ConditionListener sut(m_condVarData, WaitOptions{WaitStrategy::BUSY_POLL, 0_s});
+    EXPECT_TRUE(sut.timedWait(10_ms).empty());
+    EXPECT_THAT(m_condVarData.m_numberOfSleepingWaiters.load(), Eq(0U));
+}
+
+TEST_F(ConditionVariable_test, DestroyStopsBusyPollingWait)
+{
+    ConditionListener sut(m_condVarData, WaitOptions{WaitStrategy::BUSY_POLL, 0_s});
+    std::thread t([&] { EXPECT_TRUE(sut.wait().empty()); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    sut.destroy();
+    t.join();
+}
+
 } // namespace
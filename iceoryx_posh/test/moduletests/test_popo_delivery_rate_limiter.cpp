@@ -0,0 +1,135 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/delivery_rate_limiter.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class DeliveryRateLimiter_test : public Test
+{
+  public:
+    uint64_t countDueChunks(const uint64_t numberOfChunks)
+    {
+        uint64_t numberOfDueChunks{0U};
+        for (uint64_t i = 0U; i < numberOfChunks; ++i)
+        {
+            if (sut.isNextChunkDue())
+            {
+                ++numberOfDueChunks;
+            }
+        }
+        return numberOfDueChunks;
+    }
+
+    DeliveryRateLimiter sut;
+};
+
+TEST_F(DeliveryRateLimiter_test, DefaultConstructedLimiterDeliversEveryChunk)
+{
+    EXPECT_FALSE(sut.isEnabled());
+    EXPECT_THAT(countDueChunks(100U), Eq(100U));
+}
+
+TEST_F(DeliveryRateLimiter_test, DecimationOfZeroAndOneDeliversEveryChunk)
+{
+    sut.setLimits(0U, 0_ns);
+    EXPECT_FALSE(sut.isEnabled());
+    EXPECT_THAT(countDueChunks(10U), Eq(10U));
+
+    sut.setLimits(1U, 0_ns);
+    EXPECT_FALSE(sut.isEnabled());
+    EXPECT_THAT(countDueChunks(10U), Eq(10U));
+}
+
+TEST_F(DeliveryRateLimiter_test, DecimationDeliversTheFirstOfEveryNthChunk)
+{
+    sut.setLimits(3U, 0_ns);
+
+    EXPECT_TRUE(sut.isEnabled());
+    EXPECT_TRUE(sut.isNextChunkDue());
+    EXPECT_FALSE(sut.isNextChunkDue());
+    EXPECT_FALSE(sut.isNextChunkDue());
+    EXPECT_TRUE(sut.isNextChunkDue());
+    EXPECT_THAT(countDueChunks(299U), Eq(99U));
+}
+
+TEST_F(DeliveryRateLimiter_test, MinDeliveryIntervalDeliversOnlyTheFirstChunkWithinTheInterval)
+{
+    sut.setLimits(1U, 1_h);
+
+    EXPECT_TRUE(sut.isEnabled());
+    EXPECT_THAT(countDueChunks(100U), Eq(1U));
+}
+
+TEST_F(DeliveryRateLimiter_test, MinDeliveryIntervalDeliversAgainAfterTheIntervalPassed)
+{
+    sut.setLimits(1U, 1_ms);
+    ASSERT_TRUE(sut.isNextChunkDue());
+    EXPECT_FALSE(sut.isNextChunkDue());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+    EXPECT_TRUE(sut.isNextChunkDue());
+}
+
+TEST_F(DeliveryRateLimiter_test, BothLimitsMustBeSatisfied)
+{
+    sut.setLimits(2U, 1_h);
+
+    EXPECT_TRUE(sut.isNextChunkDue());
+    EXPECT_THAT(countDueChunks(100U), Eq(0U));
+}
+
+TEST_F(DeliveryRateLimiter_test, ConcurrentPushersShareTheDecimation)
+{
+    constexpr uint64_t NUMBER_OF_CHUNKS_PER_THREAD{10000U};
+    constexpr uint64_t NUMBER_OF_THREADS{4U};
+    constexpr uint64_t DECIMATION{10U};
+    sut.setLimits(DECIMATION, 0_ns);
+    std::atomic<uint64_t> numberOfDueChunks{0U};
+
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0U; i < NUMBER_OF_THREADS; ++i)
+    {
+        threads.emplace_back([&] {
+            for (uint64_t j = 0U; j < NUMBER_OF_CHUNKS_PER_THREAD; ++j)
+            {
+                if (sut.isNextChunkDue())
+                {
+                    numberOfDueChunks.fetch_add(1U);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_THAT(numberOfDueChunks.load(), Eq(NUMBER_OF_THREADS * NUMBER_OF_CHUNKS_PER_THREAD / DECIMATION));
+}
+
+} // namespace
@@ -0,0 +1,254 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_reader.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_writer.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::mepoo;
+
+class LatestValue_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        MePooConfig mempoolconf;
+        mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS_IN_POOL});
+        memoryManager.configureMemoryManager(mempoolconf, m_memoryAllocator, m_memoryAllocator);
+    }
+
+    SharedChunk getChunkWithValue(const uint64_t value)
+    {
+        auto chunkSettingsResult = ChunkSettings::create(sizeof(uint64_t), alignof(uint64_t));
+        EXPECT_FALSE(chunkSettingsResult.has_error());
+        if (chunkSettingsResult.has_error())
+        {
+            return nullptr;
+        }
+
+        auto chunk = memoryManager.getChunk(chunkSettingsResult.value());
+        if (chunk)
+        {
+            *static_cast<uint64_t*>(chunk.getUserPayload()) = value;
+        }
+        return chunk;
+    }
+
+    static uint64_t valueOf(const SharedChunk& chunk)
+    {
+        return *static_cast<const uint64_t*>(chunk.getUserPayload());
+    }
+
+    uint32_t usedChunks()
+    {
+        return memoryManager.getMemPoolInfo(0U).m_usedChunks;
+    }
+
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL = 100;
+    static constexpr uint32_t CHUNK_SIZE = 128;
+
+    MemoryManager memoryManager;
+    LatestValueData latestValueData;
+    LatestValueWriter writer{&latestValueData};
+    LatestValueReader reader{&latestValueData};
+
+  private:
+    static constexpr size_t KILOBYTE = 1 << 10;
+    static constexpr size_t MEMORY_SIZE = 100 * KILOBYTE;
+    std::unique_ptr<char[]> m_memory{new char[MEMORY_SIZE]};
+
+    iox::posix::Allocator m_memoryAllocator{m_memory.get(), MEMORY_SIZE};
+};
+
+TEST_F(LatestValue_test, PeekWithoutValueReturnsEmptyChunk)
+{
+    EXPECT_FALSE(reader.peek());
+}
+
+TEST_F(LatestValue_test, PeekReturnsTheUpdatedValue)
+{
+    ASSERT_TRUE(writer.update(getChunkWithValue(42U)));
+
+    auto chunk = reader.peek();
+
+    ASSERT_TRUE(chunk);
+    EXPECT_THAT(valueOf(chunk), Eq(42U));
+}
+
+TEST_F(LatestValue_test, PeekReturnsOnlyTheLatestOfMultipleUpdates)
+{
+    for (uint64_t i = 0U; i < 10U; ++i)
+    {
+        ASSERT_TRUE(writer.update(getChunkWithValue(i)));
+    }
+
+    auto chunk = reader.peek();
+
+    ASSERT_TRUE(chunk);
+    EXPECT_THAT(valueOf(chunk), Eq(9U));
+}
+
+TEST_F(LatestValue_test, PeekDoesNotConsumeTheValue)
+{
+    ASSERT_TRUE(writer.update(getChunkWithValue(13U)));
+
+    auto firstChunk = reader.peek();
+    auto secondChunk = reader.peek();
+
+    ASSERT_TRUE(firstChunk);
+    ASSERT_TRUE(secondChunk);
+    EXPECT_THAT(firstChunk.getChunkHeader(), Eq(secondChunk.getChunkHeader()));
+}
+
+TEST_F(LatestValue_test, PeekedChunkStaysValidAfterUpdate)
+{
+    ASSERT_TRUE(writer.update(getChunkWithValue(1U)));
+    auto peekedChunk = reader.peek();
+
+    ASSERT_TRUE(writer.update(getChunkWithValue(2U)));
+
+    ASSERT_TRUE(peekedChunk);
+    EXPECT_THAT(valueOf(peekedChunk), Eq(1U));
+    EXPECT_THAT(valueOf(reader.peek()), Eq(2U));
+}
+
+TEST_F(LatestValue_test, ReplacedValuesAreReleased)
+{
+    for (uint64_t i = 0U; i < 2U * NUM_CHUNKS_IN_POOL; ++i)
+    {
+        ASSERT_TRUE(writer.update(getChunkWithValue(i)));
+    }
+
+    EXPECT_THAT(usedChunks(), Eq(1U));
+}
+
+TEST_F(LatestValue_test, ReplacedValueIsReleasedWhenTheLastReaderReleasesIt)
+{
+    ASSERT_TRUE(writer.update(getChunkWithValue(1U)));
+    auto peekedChunk = reader.peek();
+    ASSERT_TRUE(writer.update(getChunkWithValue(2U)));
+    EXPECT_THAT(usedChunks(), Eq(2U));
+
+    peekedChunk = SharedChunk();
+
+    EXPECT_THAT(usedChunks(), Eq(1U));
+}
+
+TEST_F(LatestValue_test, UpdateFailsWhenAllOtherSlotsHaveReaders)
+{
+    ASSERT_TRUE(writer.update(getChunkWithValue(0U)));
+    // simulates readers which are preempted while registered at the other slots
+    const auto currentSlot = latestValueData.m_currentSlot.load();
+    for (uint32_t i = 0U; i < LatestValueData::NUMBER_OF_SLOTS; ++i)
+    {
+        if (i != currentSlot)
+        {
+            latestValueData.m_slots[i].m_numberOfReaders.store(1U);
+        }
+    }
+
+    EXPECT_FALSE(writer.update(getChunkWithValue(1U)));
+    EXPECT_THAT(valueOf(reader.peek()), Eq(0U));
+
+    for (auto& slot : latestValueData.m_slots)
+    {
+        slot.m_numberOfReaders.store(0U);
+    }
+    writer.releaseAll();
+}
+
+TEST_F(LatestValue_test, ReleaseAllReleasesAllChunks)
+{
+    for (uint64_t i = 0U; i < 5U; ++i)
+    {
+        ASSERT_TRUE(writer.update(getChunkWithValue(i)));
+    }
+
+    writer.releaseAll();
+
+    EXPECT_FALSE(reader.peek());
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+TEST_F(LatestValue_test, ConcurrentReadersAlwaysGetAConsistentValue)
+{
+    constexpr uint64_t NUMBER_OF_UPDATES{10000U};
+    constexpr uint32_t NUMBER_OF_READERS{3U};
+    std::atomic_bool isFinished{false};
+    std::atomic<uint64_t> numberOfInconsistentValues{0U};
+
+    std::vector<std::thread> readers;
+    for (uint32_t i = 0U; i < NUMBER_OF_READERS; ++i)
+    {
+        readers.emplace_back([&] {
+            LatestValueReader threadReader(&latestValueData);
+            uint64_t lastValue{0U};
+            while (!isFinished.load())
+            {
+                auto chunk = threadReader.peek();
+                if (!chunk)
+                {
+                    continue;
+                }
+                const auto value = valueOf(chunk);
+                // the value must never go back in time
+                if (value < lastValue)
+                {
+                    numberOfInconsistentValues.fetch_add(1U);
+                }
+                lastValue = value;
+            }
+        });
+    }
+
+    uint64_t numberOfSuccessfulUpdates{0U};
+    for (uint64_t i = 1U; i <= NUMBER_OF_UPDATES; ++i)
+    {
+        if (writer.update(getChunkWithValue(i)))
+        {
+            ++numberOfSuccessfulUpdates;
+        }
+    }
+    isFinished.store(true);
+
+    for (auto& thread : readers)
+    {
+        thread.join();
+    }
+
+    EXPECT_THAT(numberOfSuccessfulUpdates, Gt(0U));
+    EXPECT_THAT(numberOfInconsistentValues.load(), Eq(0U));
+
+    writer.releaseAll();
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+} // namespace
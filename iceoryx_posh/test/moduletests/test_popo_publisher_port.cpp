@@ -22,6 +22,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_reader.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_roudi.hpp"
@@ -527,6 +528,67 @@ TEST_F(PublisherPort_test, lastChunkAvailableAfterSend)
     EXPECT_THAT(maybeLastChunkHeader.value()->userPayload(), Eq(firstPayloadPtr));
 }
 
+TEST_F(PublisherPort_test, latestValueSubscriptionWhenProvidedReturnsACKWithTheLatestValue)
+{
+    iox::popo::PublisherOptions options;
+    options.provideLatestValue = true;
+    iox::popo::PublisherPortData publisherPortData{
+        iox::capro::ServiceDescription("a", "b", "c"), "myApp", &m_memoryManager, options};
+    iox::popo::PublisherPortRouDi sutRouDiSide{&publisherPortData};
+    sutRouDiSide.tryGetCaProMessage();
+    iox::capro::CaproMessage caproMessage(iox::capro::CaproMessageType::SUB,
+                                          iox::capro::ServiceDescription("a", "b", "c"),
+                                          iox::capro::CaproMessageSubType::FIELD);
+
+    auto maybeCaProMessage = sutRouDiSide.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+
+    ASSERT_TRUE(maybeCaProMessage.has_value());
+    EXPECT_THAT(maybeCaProMessage->m_type, Eq(iox::capro::CaproMessageType::ACK));
+    EXPECT_THAT(maybeCaProMessage->m_subType, Eq(iox::capro::CaproMessageSubType::FIELD));
+    EXPECT_THAT(maybeCaProMessage->m_chunkQueueData,
+                Eq(static_cast<void*>(&publisherPortData.m_chunkSenderData.m_latestValue)));
+    // the reader of the latest value does not count as subscriber which needs a delivery
+    EXPECT_FALSE(iox::popo::PublisherPortUser(&publisherPortData).hasSubscribers());
+}
+
+TEST_F(PublisherPort_test, latestValueSubscriptionWhenNotProvidedReturnsNACK)
+{
+    iox::capro::CaproMessage caproMessage(iox::capro::CaproMessageType::SUB,
+                                          iox::capro::ServiceDescription("x", "y", "z"),
+                                          iox::capro::CaproMessageSubType::FIELD);
+
+    m_sutWithDefaultOptionsRouDiSide.tryGetCaProMessage();
+
+    auto maybeCaProMessage = m_sutWithDefaultOptionsRouDiSide.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+
+    ASSERT_TRUE(maybeCaProMessage.has_value());
+    EXPECT_THAT(maybeCaProMessage->m_type, Eq(iox::capro::CaproMessageType::NACK));
+}
+
+TEST_F(PublisherPort_test, sendUpdatesTheLatestValueWhenProvided)
+{
+    iox::popo::PublisherOptions options;
+    options.provideLatestValue = true;
+    iox::popo::PublisherPortData publisherPortData{
+        iox::capro::ServiceDescription("a", "b", "c"), "myApp", &m_memoryManager, options};
+    iox::popo::PublisherPortUser sutUserSide{&publisherPortData};
+    iox::popo::PublisherPortRouDi sutRouDiSide{&publisherPortData};
+
+    auto maybeChunkHeader = sutUserSide.tryAllocateChunk(
+        sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    auto chunkHeader = maybeChunkHeader.value();
+    sutUserSide.sendChunk(chunkHeader);
+
+    auto latestChunk = iox::popo::LatestValueReader(&publisherPortData.m_chunkSenderData.m_latestValue).peek();
+    ASSERT_TRUE(latestChunk);
+    EXPECT_THAT(latestChunk.getChunkHeader(), Eq(chunkHeader));
+
+    latestChunk = iox::mepoo::SharedChunk();
+    sutRouDiSide.releaseAllChunks();
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 TEST_F(PublisherPort_test, cleanupReleasesAllChunks)
 {
     // push some chunks to history
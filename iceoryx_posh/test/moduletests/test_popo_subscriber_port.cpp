@@ -79,6 +79,32 @@ class SubscriberPortSingleProducer_test : public Test
         m_defaultSubscriberOptions};
     iox::popo::SubscriberPortUser m_sutUserSideDefaultOptions{&m_subscriberPortDataDefaultOptions};
     iox::popo::SubscriberPortSingleProducer m_sutRouDiSideDefaultOptions{&m_subscriberPortDataDefaultOptions};
+
+    iox::popo::SubscriberOptions m_latestValueOnlyOptions{
+        iox::popo::SubscriberPortData::ChunkQueueData_t::MAX_CAPACITY,
+        0U,
+        iox::NodeName_t(""),
+        false,
+        iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
+        true};
+    iox::popo::SubscriberPortData m_subscriberPortDataLatestValueOnly{
+        TEST_SERVICE_DESCRIPTION,
+        "myApp",
+        iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
+        m_latestValueOnlyOptions};
+    iox::popo::SubscriberPortUser m_sutUserSideLatestValueOnly{&m_subscriberPortDataLatestValueOnly};
+    iox::popo::SubscriberPortSingleProducer m_sutRouDiSideLatestValueOnly{&m_subscriberPortDataLatestValueOnly};
+    iox::popo::LatestValueData m_latestValueData;
+
+    void subscribeToLatestValue()
+    {
+        m_sutUserSideLatestValueOnly.subscribe();
+        m_sutRouDiSideLatestValueOnly.tryGetCaProMessage(); // only RouDi changes state
+        iox::capro::CaproMessage caproMessage(
+            iox::capro::CaproMessageType::ACK, TEST_SERVICE_DESCRIPTION, iox::capro::CaproMessageSubType::FIELD);
+        caproMessage.m_chunkQueueData = &m_latestValueData;
+        m_sutRouDiSideLatestValueOnly.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+    }
 };
 
 const iox::capro::ServiceDescription SubscriberPortSingleProducer_test::TEST_SERVICE_DESCRIPTION("x", "y", "z");
@@ -349,6 +375,70 @@ TEST_F(SubscriberPortSingleProducer_test, NackWhenNotWaitingForResultsInError)
     ASSERT_THAT(receivedError, Eq(iox::Error::kPOPO__CAPRO_PROTOCOL_ERROR));
 }
 
+TEST_F(SubscriberPortSingleProducer_test, SubscribeWithLatestValueOnlyResultsInFieldSubCaProMessage)
+{
+    m_sutUserSideLatestValueOnly.subscribe();
+
+    auto maybeCaproMessage = m_sutRouDiSideLatestValueOnly.tryGetCaProMessage();
+
+    ASSERT_TRUE(maybeCaproMessage.has_value());
+    EXPECT_THAT(maybeCaproMessage->m_type, Eq(iox::capro::CaproMessageType::SUB));
+    EXPECT_THAT(maybeCaproMessage->m_subType, Eq(iox::capro::CaproMessageSubType::FIELD));
+}
+
+TEST_F(SubscriberPortSingleProducer_test, PeekLatestChunkWithoutPublisherReturnsEmptyChunk)
+{
+    EXPECT_FALSE(m_sutUserSideLatestValueOnly.peekLatestChunk());
+}
+
+TEST_F(SubscriberPortSingleProducer_test, AckWithLatestValueResultsInSubscribedAndConnectsTheLatestValue)
+{
+    subscribeToLatestValue();
+
+    EXPECT_THAT(m_sutUserSideLatestValueOnly.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+    EXPECT_THAT(static_cast<iox::popo::LatestValueData*>(m_subscriberPortDataLatestValueOnly.m_latestValue),
+                Eq(&m_latestValueData));
+}
+
+TEST_F(SubscriberPortSingleProducer_test, AckWithLatestValueIsIgnoredWithoutLatestValueOnly)
+{
+    m_sutUserSideSingleProducer.subscribe();
+    m_sutRouDiSideSingleProducer.tryGetCaProMessage(); // only RouDi changes state
+    iox::capro::CaproMessage caproMessage(
+        iox::capro::CaproMessageType::ACK, TEST_SERVICE_DESCRIPTION, iox::capro::CaproMessageSubType::FIELD);
+    caproMessage.m_chunkQueueData = &m_latestValueData;
+    m_sutRouDiSideSingleProducer.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+
+    EXPECT_THAT(static_cast<iox::popo::LatestValueData*>(m_subscriberPortDataSingleProducer.m_latestValue),
+                Eq(nullptr));
+}
+
+TEST_F(SubscriberPortSingleProducer_test, StopOfferDisconnectsTheLatestValue)
+{
+    subscribeToLatestValue();
+    iox::capro::CaproMessage caproMessage(iox::capro::CaproMessageType::STOP_OFFER, TEST_SERVICE_DESCRIPTION);
+    m_sutRouDiSideLatestValueOnly.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+
+    EXPECT_THAT(static_cast<iox::popo::LatestValueData*>(m_subscriberPortDataLatestValueOnly.m_latestValue),
+                Eq(nullptr));
+}
+
+TEST_F(SubscriberPortSingleProducer_test, UnsubscribeDisconnectsTheLatestValue)
+{
+    subscribeToLatestValue();
+    m_sutUserSideLatestValueOnly.unsubscribe();
+    auto maybeCaproMessage = m_sutRouDiSideLatestValueOnly.tryGetCaProMessage();
+    ASSERT_TRUE(maybeCaproMessage.has_value());
+    EXPECT_THAT(maybeCaproMessage->m_subType, Eq(iox::capro::CaproMessageSubType::FIELD));
+    iox::capro::CaproMessage caproMessage(
+        iox::capro::CaproMessageType::ACK, TEST_SERVICE_DESCRIPTION, iox::capro::CaproMessageSubType::FIELD);
+    m_sutRouDiSideLatestValueOnly.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+
+    EXPECT_THAT(m_sutUserSideLatestValueOnly.getSubscriptionState(), Eq(iox::SubscribeState::NOT_SUBSCRIBED));
+    EXPECT_THAT(static_cast<iox::popo::LatestValueData*>(m_subscriberPortDataLatestValueOnly.m_latestValue),
+                Eq(nullptr));
+}
+
 class SubscriberPortMultiProducer_test : public Test
 {
   protected:
@@ -524,4 +614,32 @@ TEST_F(SubscriberPortMultiProducer_test, InvalidMessageResultsInError)
     ASSERT_THAT(receivedError, Eq(iox::Error::kPOPO__CAPRO_PROTOCOL_ERROR));
 }
 
+TEST_F(SubscriberPortMultiProducer_test, StopOfferOfAnotherPublisherKeepsTheLatestValue)
+{
+    iox::popo::SubscriberOptions options;
+    options.latestValueOnly = true;
+    iox::popo::SubscriberPortData subscriberPortData{SubscriberPortSingleProducer_test::TEST_SERVICE_DESCRIPTION,
+                                                     "myApp",
+                                                     iox::cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
+                                                     options};
+    iox::popo::SubscriberPortMultiProducer sutRouDiSide{&subscriberPortData};
+    sutRouDiSide.tryGetCaProMessage(); // only RouDi changes state
+    iox::popo::LatestValueData latestValueData;
+    iox::popo::LatestValueData otherLatestValueData;
+    iox::capro::CaproMessage caproMessage(iox::capro::CaproMessageType::ACK,
+                                          SubscriberPortSingleProducer_test::TEST_SERVICE_DESCRIPTION,
+                                          iox::capro::CaproMessageSubType::FIELD);
+    caproMessage.m_chunkQueueData = &latestValueData;
+    sutRouDiSide.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+
+    caproMessage.m_type = iox::capro::CaproMessageType::STOP_OFFER;
+    caproMessage.m_chunkQueueData = &otherLatestValueData;
+    sutRouDiSide.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+    EXPECT_THAT(static_cast<iox::popo::LatestValueData*>(subscriberPortData.m_latestValue), Eq(&latestValueData));
+
+    caproMessage.m_chunkQueueData = &latestValueData;
+    sutRouDiSide.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+    EXPECT_THAT(static_cast<iox::popo::LatestValueData*>(subscriberPortData.m_latestValue), Eq(nullptr));
+}
+
 } // namespace
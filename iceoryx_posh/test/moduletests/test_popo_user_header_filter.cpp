@@ -0,0 +1,152 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/user_header_filter.hpp"
+
+#include "test.hpp"
+
+#include <cstddef>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::mepoo;
+
+struct TestUserHeader
+{
+    uint32_t sequenceNumber{0U};
+    uint16_t cameraId{0U};
+    uint8_t flags{0U};
+};
+
+class UserHeaderFilter_test : public Test
+{
+  public:
+    ChunkHeader* createChunk(const TestUserHeader& userHeader)
+    {
+        auto chunkSettingsResult = ChunkSettings::create(
+            USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, sizeof(TestUserHeader), alignof(TestUserHeader));
+        EXPECT_FALSE(chunkSettingsResult.has_error());
+        auto chunkHeader = new (storage) ChunkHeader(CHUNK_SIZE, chunkSettingsResult.value());
+        *static_cast<TestUserHeader*>(chunkHeader->userHeader()) = userHeader;
+        return chunkHeader;
+    }
+
+    ChunkHeader* createChunkWithoutUserHeader()
+    {
+        auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT);
+        EXPECT_FALSE(chunkSettingsResult.has_error());
+        return new (storage) ChunkHeader(CHUNK_SIZE, chunkSettingsResult.value());
+    }
+
+    static constexpr uint32_t CHUNK_SIZE{256U};
+    static constexpr uint32_t USER_PAYLOAD_SIZE{8U};
+    static constexpr uint32_t USER_PAYLOAD_ALIGNMENT{8U};
+    alignas(ChunkHeader) uint8_t storage[CHUNK_SIZE];
+};
+
+TEST_F(UserHeaderFilter_test, DefaultConstructedFilterIsDisabled)
+{
+    UserHeaderFilter sut;
+
+    EXPECT_FALSE(sut.isEnabled());
+}
+
+TEST_F(UserHeaderFilter_test, DisabledFilterMatchesChunksWithAndWithoutUserHeader)
+{
+    UserHeaderFilter sut;
+
+    EXPECT_TRUE(sut.matches(*createChunk(TestUserHeader())));
+    EXPECT_TRUE(sut.matches(*createChunkWithoutUserHeader()));
+}
+
+TEST_F(UserHeaderFilter_test, FieldEqualsMatchesChunkWithEqualField)
+{
+    auto sut = UserHeaderFilter::fieldEquals(offsetof(TestUserHeader, cameraId), static_cast<uint16_t>(3U));
+    TestUserHeader userHeader;
+    userHeader.sequenceNumber = 0xFFFFFFFFU;
+    userHeader.cameraId = 3U;
+
+    EXPECT_TRUE(sut.isEnabled());
+    EXPECT_TRUE(sut.matches(*createChunk(userHeader)));
+}
+
+TEST_F(UserHeaderFilter_test, FieldEqualsDoesNotMatchChunkWithDifferentField)
+{
+    auto sut = UserHeaderFilter::fieldEquals(offsetof(TestUserHeader, cameraId), static_cast<uint16_t>(3U));
+    TestUserHeader userHeader;
+    userHeader.cameraId = 4U;
+
+    EXPECT_FALSE(sut.matches(*createChunk(userHeader)));
+}
+
+TEST_F(UserHeaderFilter_test, FieldEqualsWithMaskComparesOnlyTheMaskedBits)
+{
+    auto sut = UserHeaderFilter::fieldEquals(
+        offsetof(TestUserHeader, flags), static_cast<uint8_t>(0x01U), static_cast<uint8_t>(0x0FU));
+    TestUserHeader userHeader;
+
+    userHeader.flags = 0xF1U;
+    EXPECT_TRUE(sut.matches(*createChunk(userHeader)));
+    userHeader.flags = 0x12U;
+    EXPECT_FALSE(sut.matches(*createChunk(userHeader)));
+}
+
+TEST_F(UserHeaderFilter_test, EnabledFilterDoesNotMatchChunkWithoutUserHeader)
+{
+    auto sut = UserHeaderFilter::fieldEquals(0U, static_cast<uint8_t>(0U));
+
+    EXPECT_FALSE(sut.matches(*createChunkWithoutUserHeader()));
+}
+
+TEST_F(UserHeaderFilter_test, FieldBeyondTheUserHeaderDoesNotMatch)
+{
+    auto sut = UserHeaderFilter::fieldEquals(static_cast<uint32_t>(sizeof(TestUserHeader)) - 2U, uint32_t{0U});
+
+    EXPECT_FALSE(sut.matches(*createChunk(TestUserHeader())));
+}
+
+TEST_F(UserHeaderFilter_test, SerializationRoundTripResultsInEqualFilter)
+{
+    auto filter = UserHeaderFilter::fieldEquals(offsetof(TestUserHeader, cameraId), static_cast<uint16_t>(7U));
+    TestUserHeader userHeader;
+    userHeader.cameraId = 7U;
+
+    UserHeaderFilter sut(static_cast<iox::cxx::Serialization>(filter));
+
+    EXPECT_TRUE(sut.isEnabled());
+    EXPECT_TRUE(sut.matches(*createChunk(userHeader)));
+    userHeader.cameraId = 8U;
+    EXPECT_FALSE(sut.matches(*createChunk(userHeader)));
+}
+
+TEST_F(UserHeaderFilter_test, InvalidSerializationResultsInDisabledFilter)
+{
+    UserHeaderFilter sut(iox::cxx::Serialization("ThisIsNotAFilter"));
+
+    EXPECT_FALSE(sut.isEnabled());
+}
+
+TEST_F(UserHeaderFilter_test, SerializationWithTooLargeFieldResultsInDisabledFilter)
+{
+    UserHeaderFilter sut(iox::cxx::Serialization::create(0U, UserHeaderFilter::MAX_FIELD_SIZE + 1U, 0U, 0U));
+
+    EXPECT_FALSE(sut.isEnabled());
+}
+
+} // namespace
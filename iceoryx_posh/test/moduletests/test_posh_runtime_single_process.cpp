@@ -16,10 +16,16 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/runtime/posh_runtime_single_process.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
+#include "iceoryx_posh/popo/publisher.hpp"
+#include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_posh/testing/roudi_environment/roudi_environment.hpp"
 
 #include "test.hpp"
 
+#include <chrono>
+#include <thread>
+
 namespace
 {
 using namespace ::testing;
@@ -59,6 +65,46 @@ TEST_F(PoshRuntimeSingleProcess_test, ConstructorPoshRuntimeSingleProcessIsSucce
     EXPECT_NO_FATAL_FAILURE({ PoshRuntimeSingleProcess m_runtimeSingleProcess(m_runtimeName); });
 }
 
+TEST_F(PoshRuntimeSingleProcess_test, SingleProcessScopeTransmitsDataWithoutSharedMemory)
+{
+    iox::RouDiConfig_t roudiConfig = iox::RouDiConfig_t().setDefaults();
+    roudiConfig.m_processScope = ProcessScope::SINGLE_PROCESS;
+    IceOryxRouDiComponents roudiComponents(roudiConfig);
+
+    RouDi roudi(roudiComponents.rouDiMemoryManager,
+                roudiComponents.portManager,
+                RouDi::RoudiStartupParameters{iox::roudi::MonitoringMode::OFF, false});
+
+    PoshRuntimeSingleProcess runtime("App");
+
+    EXPECT_TRUE(iox::posix::SharedMemoryObject::create(SHM_NAME,
+                                                       8U,
+                                                       iox::posix::AccessMode::READ_ONLY,
+                                                       iox::posix::OpenMode::OPEN_EXISTING,
+                                                       iox::posix::SharedMemoryObject::NO_ADDRESS_HINT)
+                    .has_error());
+
+    iox::popo::Publisher<uint64_t> publisher({"Single", "Process", "Scope"});
+    iox::popo::Subscriber<uint64_t> subscriber({"Single", "Process", "Scope"});
+
+    // the subscription is established by the discovery loop of RouDi
+    constexpr uint64_t MAX_NUMBER_OF_RETRIES{100U};
+    for (uint64_t i = 0U;
+         i < MAX_NUMBER_OF_RETRIES && subscriber.getSubscriptionState() != iox::SubscribeState::SUBSCRIBED;
+         ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+
+    constexpr uint64_t DATA{73U};
+    ASSERT_FALSE(publisher.publishCopyOf(DATA).has_error());
+
+    auto sample = subscriber.take();
+    ASSERT_FALSE(sample.has_error());
+    EXPECT_THAT(*sample.value(), Eq(DATA));
+}
+
 TEST_F(PoshRuntimeSingleProcess_test, ConstructorPoshRuntimeSingleProcessMultipleProcessIsFound)
 {
     RouDiEnvironment m_roudiEnv{iox::RouDiConfig_t().setDefaults()};
@@ -0,0 +1,179 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+
+struct TestElement
+{
+    explicit TestElement(const uint64_t value)
+        : value(value)
+    {
+        ++numberOfLiveElements;
+    }
+
+    ~TestElement()
+    {
+        --numberOfLiveElements;
+    }
+
+    uint64_t value{0U};
+    static uint64_t numberOfLiveElements;
+};
+
+uint64_t TestElement::numberOfLiveElements{0U};
+
+class FixedPositionContainer_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        TestElement::numberOfLiveElements = 0U;
+    }
+
+    ~FixedPositionContainer_test()
+    {
+        sut.~Container_t();
+        iox::cxx::alignedFree(m_sutMemory);
+    }
+
+    static constexpr uint64_t CAPACITY{5U};
+    using Container_t = FixedPositionContainer<TestElement, CAPACITY>;
+    // the container is over-aligned and must therefore not be part of the fixture which is created with new
+    void* m_sutMemory{iox::cxx::alignedAlloc(alignof(Container_t), sizeof(Container_t))};
+    Container_t& sut{*new (m_sutMemory) Container_t};
+};
+
+constexpr uint64_t FixedPositionContainer_test::CAPACITY;
+
+TEST_F(FixedPositionContainer_test, NewContainerIsEmptyAndHasFreeSpace)
+{
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_TRUE(sut.hasFreeSpace());
+    EXPECT_THAT(sut.content().size(), Eq(0U));
+}
+
+TEST_F(FixedPositionContainer_test, InsertUntilFullWorks)
+{
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        EXPECT_TRUE(sut.hasFreeSpace());
+        auto element = sut.insert(i);
+        ASSERT_THAT(element, Ne(nullptr));
+        EXPECT_THAT(element->value, Eq(i));
+    }
+
+    EXPECT_FALSE(sut.hasFreeSpace());
+    EXPECT_THAT(sut.insert(CAPACITY), Eq(nullptr));
+    EXPECT_THAT(sut.size(), Eq(CAPACITY));
+    EXPECT_THAT(TestElement::numberOfLiveElements, Eq(CAPACITY));
+}
+
+TEST_F(FixedPositionContainer_test, ContentIsInInsertionOrder)
+{
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        sut.insert(i);
+    }
+
+    auto content = sut.content();
+    ASSERT_THAT(content.size(), Eq(CAPACITY));
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        EXPECT_THAT(content[i]->value, Eq(i));
+    }
+}
+
+TEST_F(FixedPositionContainer_test, ElementsDoNotShareACacheLine)
+{
+    auto first = reinterpret_cast<uintptr_t>(sut.insert(0U));
+    auto second = reinterpret_cast<uintptr_t>(sut.insert(1U));
+
+    EXPECT_THAT(alignof(Container_t), Ge(iox::CACHE_LINE_SIZE));
+    EXPECT_THAT(first % iox::CACHE_LINE_SIZE, Eq(0U));
+    EXPECT_THAT((second - first) % iox::CACHE_LINE_SIZE, Eq(0U));
+    EXPECT_THAT(second - first, Ge(iox::CACHE_LINE_SIZE));
+}
+
+TEST_F(FixedPositionContainer_test, EraseReleasesSlotForReuseAndKeepsOtherElementsInPlace)
+{
+    auto first = sut.insert(0U);
+    auto second = sut.insert(1U);
+    auto third = sut.insert(2U);
+
+    sut.erase(second);
+    EXPECT_THAT(TestElement::numberOfLiveElements, Eq(2U));
+
+    auto content = sut.content();
+    ASSERT_THAT(content.size(), Eq(2U));
+    EXPECT_THAT(content[0], Eq(first));
+    EXPECT_THAT(content[1], Eq(third));
+
+    auto fourth = sut.insert(3U);
+    EXPECT_THAT(fourth, Eq(second));
+
+    content = sut.content();
+    ASSERT_THAT(content.size(), Eq(3U));
+    EXPECT_THAT(content[2]->value, Eq(3U));
+}
+
+TEST_F(FixedPositionContainer_test, EraseOfFirstAndLastElementWorks)
+{
+    auto first = sut.insert(0U);
+    sut.insert(1U);
+    auto last = sut.insert(2U);
+
+    sut.erase(first);
+    sut.erase(last);
+
+    auto content = sut.content();
+    ASSERT_THAT(content.size(), Eq(1U));
+    EXPECT_THAT(content[0]->value, Eq(1U));
+    EXPECT_THAT(sut.size(), Eq(1U));
+}
+
+TEST_F(FixedPositionContainer_test, EraseOfUnknownOrAlreadyErasedElementIsIgnored)
+{
+    auto element = sut.insert(0U);
+    TestElement unknownElement{1U};
+
+    sut.erase(&unknownElement);
+    sut.erase(element);
+    sut.erase(element);
+
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_TRUE(sut.hasFreeSpace());
+}
+
+TEST_F(FixedPositionContainer_test, DestructorDestroysAllElements)
+{
+    {
+        FixedPositionContainer<TestElement, CAPACITY> container;
+        container.insert(0U);
+        container.insert(1U);
+        EXPECT_THAT(TestElement::numberOfLiveElements, Eq(2U));
+    }
+
+    EXPECT_THAT(TestElement::numberOfLiveElements, Eq(0U));
+}
+
+} // namespace
@@ -1015,6 +1015,52 @@ TEST_F(PortManager_test, PortsDestroyInProcess2ChangeStatesOfPortsInProcess1)
     }
 }
 
+TEST_F(PortManager_test, DestroyedPublisherPortIsKeptWhileSubscriberPeeksLatestValue)
+{
+    auto service = getUniqueSD();
+    PublisherOptions publisherOptions;
+    publisherOptions.provideLatestValue = true;
+    SubscriberOptions subscriberOptions;
+    subscriberOptions.latestValueOnly = true;
+
+    auto publisherData =
+        m_portManager
+            ->acquirePublisherPortData(
+                service, publisherOptions, m_runtimeName, m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value();
+    auto subscriberData =
+        m_portManager->acquireSubscriberPortData(service, subscriberOptions, m_runtimeName, PortConfigInfo()).value();
+    m_portManager->doDiscovery();
+    ASSERT_THAT(static_cast<iox::popo::LatestValueData*>(subscriberData->m_latestValue), Ne(nullptr));
+
+    // simulate a subscriber in another process which is in the middle of a peek
+    subscriberData->m_numberOfLatestValuePeeks.fetch_add(1U);
+    PublisherPortUser(publisherData).destroy();
+    m_portManager->doDiscovery();
+
+    EXPECT_THAT(static_cast<iox::popo::LatestValueData*>(subscriberData->m_latestValue), Eq(nullptr));
+    // the slot of the destroyed port is not reused as long as the peek is in progress
+    auto otherPublisherData =
+        m_portManager
+            ->acquirePublisherPortData(
+                getUniqueSD(), publisherOptions, m_runtimeName, m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value();
+    EXPECT_THAT(otherPublisherData, Ne(publisherData));
+    PublisherPortUser(otherPublisherData).destroy();
+    m_portManager->doDiscovery();
+
+    subscriberData->m_numberOfLatestValuePeeks.fetch_sub(1U);
+    m_portManager->doDiscovery();
+
+    // the port pool hands out the most recently freed slot first
+    auto newPublisherData =
+        m_portManager
+            ->acquirePublisherPortData(
+                getUniqueSD(), publisherOptions, m_runtimeName, m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value();
+    EXPECT_THAT(newPublisherData, Eq(publisherData));
+}
+
 TEST_F(PortManager_test, OfferPublisherServiceUpdatesServiceRegistryChangeCounter)
 {
     auto serviceCounter = m_portManager->serviceRegistryChangeCounter();
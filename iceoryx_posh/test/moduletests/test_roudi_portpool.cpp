@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
@@ -33,7 +34,15 @@ static constexpr uint32_t DEFAULT_MEMORY_TYPE{100U};
 class PortPool_test : public Test
 {
   public:
-    roudi::PortPoolData m_portPoolData;
+    ~PortPool_test()
+    {
+        m_portPoolData.~PortPoolData();
+        iox::cxx::alignedFree(m_portPoolDataMemory);
+    }
+
+    // the PortPoolData is over-aligned and must therefore not be part of the fixture which is created with new
+    void* m_portPoolDataMemory{iox::cxx::alignedAlloc(alignof(roudi::PortPoolData), sizeof(roudi::PortPoolData))};
+    roudi::PortPoolData& m_portPoolData{*new (m_portPoolDataMemory) roudi::PortPoolData};
     roudi::PortPool sut{m_portPoolData};
 
     ServiceDescription m_serviceDescription{"service1", "instance1"};
@@ -599,6 +608,90 @@ TEST_F(PortPool_test, RemoveConditionVariableDataIsSuccessful)
     ASSERT_EQ(condtionalVariableData.size(), 0U);
 }
 
+TEST_F(PortPool_test, GetPublisherPortDataListOfRuntimeContainsOnlyItsPortsInInsertionOrder)
+{
+    const RuntimeName_t otherRuntimeName{"otherRuntime"};
+    auto firstPort = sut.addPublisherPort(
+        {"service1", "instance1", "event1"}, &m_memoryManager, m_runtimeName, m_publisherOptions, m_memoryInfo);
+    ASSERT_FALSE(
+        sut.addPublisherPort(
+               {"service1", "instance1", "event2"}, &m_memoryManager, otherRuntimeName, m_publisherOptions, m_memoryInfo)
+            .has_error());
+    auto secondPort = sut.addPublisherPort(
+        {"service1", "instance1", "event3"}, &m_memoryManager, m_runtimeName, m_publisherOptions, m_memoryInfo);
+    ASSERT_FALSE(firstPort.has_error());
+    ASSERT_FALSE(secondPort.has_error());
+
+    auto publisherPortDataList = sut.getPublisherPortDataList(m_runtimeName);
+
+    ASSERT_THAT(publisherPortDataList.size(), Eq(2U));
+    EXPECT_THAT(publisherPortDataList[0], Eq(firstPort.value()));
+    EXPECT_THAT(publisherPortDataList[1], Eq(secondPort.value()));
+    EXPECT_THAT(sut.getPublisherPortDataList(otherRuntimeName).size(), Eq(1U));
+}
+
+TEST_F(PortPool_test, GetSubscriberPortDataListOfRuntimeDoesNotContainRemovedPorts)
+{
+    auto firstPort = sut.addSubscriberPort(m_serviceDescription, m_runtimeName, m_subscriberOptions, m_memoryInfo);
+    auto secondPort = sut.addSubscriberPort(m_serviceDescription, m_runtimeName, m_subscriberOptions, m_memoryInfo);
+    ASSERT_FALSE(firstPort.has_error());
+    ASSERT_FALSE(secondPort.has_error());
+
+    sut.removeSubscriberPort(firstPort.value());
+    auto subscriberPortDataList = sut.getSubscriberPortDataList(m_runtimeName);
+
+    ASSERT_THAT(subscriberPortDataList.size(), Eq(1U));
+    EXPECT_THAT(subscriberPortDataList[0], Eq(secondPort.value()));
+}
+
+TEST_F(PortPool_test, GetDataListsOfUnknownRuntimeAreEmpty)
+{
+    ASSERT_FALSE(sut.addInterfacePort(m_runtimeName, Interfaces::INTERNAL).has_error());
+    ASSERT_FALSE(sut.addApplicationPort(m_runtimeName).has_error());
+    ASSERT_FALSE(sut.addNodeData(m_runtimeName, m_nodeName, m_nodeDeviceId).has_error());
+    ASSERT_FALSE(sut.addConditionVariableData(m_runtimeName).has_error());
+
+    const RuntimeName_t unknownRuntimeName{"unknownRuntime"};
+    EXPECT_THAT(sut.getInterfacePortDataList(unknownRuntimeName).size(), Eq(0U));
+    EXPECT_THAT(sut.getApplicationPortDataList(unknownRuntimeName).size(), Eq(0U));
+    EXPECT_THAT(sut.getNodeDataList(unknownRuntimeName).size(), Eq(0U));
+    EXPECT_THAT(sut.getConditionVariableDataList(unknownRuntimeName).size(), Eq(0U));
+
+    EXPECT_THAT(sut.getInterfacePortDataList(m_runtimeName).size(), Eq(1U));
+    EXPECT_THAT(sut.getApplicationPortDataList(m_runtimeName).size(), Eq(1U));
+    EXPECT_THAT(sut.getNodeDataList(m_runtimeName).size(), Eq(1U));
+    EXPECT_THAT(sut.getConditionVariableDataList(m_runtimeName).size(), Eq(1U));
+}
+
+TEST_F(PortPool_test, RuntimeIsNotFoundAnymoreWhenAllOfItsDataIsRemoved)
+{
+    auto nodeData = sut.addNodeData(m_runtimeName, m_nodeName, m_nodeDeviceId);
+    ASSERT_FALSE(nodeData.has_error());
+
+    sut.removeNodeData(nodeData.value());
+    ASSERT_FALSE(sut.addNodeData(m_applicationName, m_nodeName, m_nodeDeviceId).has_error());
+
+    EXPECT_THAT(sut.getNodeDataList(m_runtimeName).size(), Eq(0U));
+    EXPECT_THAT(sut.getNodeDataList(m_applicationName).size(), Eq(1U));
+}
+
+TEST_F(PortPool_test, GetDataListOfRuntimeIsCompleteWhenMoreRuntimesThanTrackedOwnersExist)
+{
+    for (uint32_t i = 0U; i < MAX_NUMBER_OF_CONDITION_VARIABLES; ++i)
+    {
+        RuntimeName_t applicationName = {cxx::TruncateToCapacity, "AppName" + cxx::convert::toString(i)};
+        ASSERT_FALSE(sut.addConditionVariableData(applicationName).has_error());
+    }
+
+    for (uint32_t i = 0U; i < MAX_NUMBER_OF_CONDITION_VARIABLES; ++i)
+    {
+        RuntimeName_t applicationName = {cxx::TruncateToCapacity, "AppName" + cxx::convert::toString(i)};
+        auto conditionVariableDataList = sut.getConditionVariableDataList(applicationName);
+        ASSERT_THAT(conditionVariableDataList.size(), Eq(1U));
+        EXPECT_THAT(conditionVariableDataList[0]->m_runtimeName, Eq(applicationName));
+    }
+}
+
 TEST_F(PortPool_test, GetServiceRegistryChangeCounterReturnsZeroAsInitialValue)
 {
     auto serviceCounter = sut.serviceRegistryChangeCounter();
@@ -18,6 +18,7 @@
 #include "iceoryx_hoofs/cxx/string.hpp"
 #include "iceoryx_hoofs/platform/types.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/ports/application_port.hpp"
 #include "iceoryx_posh/internal/roudi/process.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
@@ -112,4 +113,32 @@ TEST_F(Process_test, TimeStamp)
     EXPECT_THAT(roudiproc.getTimestamp(), Eq(timestmp));
 }
 
+TEST_F(Process_test, TimeStampIsUpdatedByHeartbeatOfApplicationPort)
+{
+    const auto oldTimestamp = iox::mepoo::BaseClock_t::now() - std::chrono::seconds(10);
+    Process roudiproc(processname, pid, user, isMonitored, sessionId);
+    roudiproc.setTimestamp(oldTimestamp);
+
+    ApplicationPortData applicationPortData{processname};
+    roudiproc.setApplicationPortData(&applicationPortData);
+    ApplicationPort applicationPort(&applicationPortData);
+
+    const auto beforeHeartbeat = iox::mepoo::BaseClock_t::now();
+    applicationPort.sendHeartbeat();
+
+    EXPECT_THAT(roudiproc.getTimestamp(), Ge(beforeHeartbeat));
+    EXPECT_THAT(roudiproc.getTimestamp(), Eq(applicationPort.getLastHeartbeat()));
+}
+
+TEST_F(Process_test, TimeStampIsNotOlderThanSetTimestampWhenHeartbeatIsOlder)
+{
+    ApplicationPortData applicationPortData{processname};
+    const auto newTimestamp = iox::mepoo::BaseClock_t::now() + std::chrono::seconds(10);
+    Process roudiproc(processname, pid, user, isMonitored, sessionId);
+    roudiproc.setApplicationPortData(&applicationPortData);
+    roudiproc.setTimestamp(newTimestamp);
+
+    EXPECT_THAT(roudiproc.getTimestamp(), Eq(newTimestamp));
+}
+
 } // namespace
@@ -0,0 +1,179 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_posh/internal/roudi/runtime_name_index.hpp"
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::roudi;
+
+class RuntimeNameIndex_test : public Test
+{
+  public:
+    static RuntimeName_t nameOf(const uint64_t i)
+    {
+        return RuntimeName_t(cxx::TruncateToCapacity, "runtime" + cxx::convert::toString(i));
+    }
+
+    static constexpr uint64_t CAPACITY{100U};
+    RuntimeNameIndex<uint64_t, CAPACITY> sut;
+};
+
+constexpr uint64_t RuntimeNameIndex_test::CAPACITY;
+
+TEST_F(RuntimeNameIndex_test, NewIndexIsEmpty)
+{
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_FALSE(sut.find(nameOf(0U)).has_value());
+}
+
+TEST_F(RuntimeNameIndex_test, InsertedValueCanBeFound)
+{
+    ASSERT_TRUE(sut.insert(nameOf(1U), 42U));
+
+    auto value = sut.find(nameOf(1U));
+    ASSERT_TRUE(value.has_value());
+    EXPECT_THAT(value.value(), Eq(42U));
+    EXPECT_THAT(sut.size(), Eq(1U));
+}
+
+TEST_F(RuntimeNameIndex_test, InsertingAnExistingNameFailsAndKeepsTheValue)
+{
+    ASSERT_TRUE(sut.insert(nameOf(1U), 42U));
+
+    EXPECT_FALSE(sut.insert(nameOf(1U), 73U));
+    EXPECT_THAT(sut.find(nameOf(1U)).value(), Eq(42U));
+    EXPECT_THAT(sut.size(), Eq(1U));
+}
+
+TEST_F(RuntimeNameIndex_test, InsertingUpToCapacityIsSuccessful)
+{
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(sut.insert(nameOf(i), i));
+    }
+
+    EXPECT_THAT(sut.size(), Eq(CAPACITY));
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        auto value = sut.find(nameOf(i));
+        ASSERT_TRUE(value.has_value());
+        EXPECT_THAT(value.value(), Eq(i));
+    }
+}
+
+TEST_F(RuntimeNameIndex_test, InsertingBeyondCapacityFails)
+{
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(sut.insert(nameOf(i), i));
+    }
+
+    EXPECT_FALSE(sut.insert(nameOf(CAPACITY), CAPACITY));
+    EXPECT_FALSE(sut.find(nameOf(CAPACITY)).has_value());
+}
+
+TEST_F(RuntimeNameIndex_test, ErasedNameCannotBeFound)
+{
+    ASSERT_TRUE(sut.insert(nameOf(1U), 42U));
+
+    EXPECT_TRUE(sut.erase(nameOf(1U)));
+
+    EXPECT_FALSE(sut.find(nameOf(1U)).has_value());
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
+TEST_F(RuntimeNameIndex_test, ErasingUnknownNameFails)
+{
+    ASSERT_TRUE(sut.insert(nameOf(1U), 42U));
+
+    EXPECT_FALSE(sut.erase(nameOf(2U)));
+    EXPECT_THAT(sut.size(), Eq(1U));
+}
+
+TEST_F(RuntimeNameIndex_test, ErasingNamesKeepsTheRemainingNamesAccessible)
+{
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(sut.insert(nameOf(i), i));
+    }
+
+    for (uint64_t i = 0U; i < CAPACITY; i += 3U)
+    {
+        ASSERT_TRUE(sut.erase(nameOf(i)));
+    }
+
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        auto value = sut.find(nameOf(i));
+        if (i % 3U == 0U)
+        {
+            EXPECT_FALSE(value.has_value());
+        }
+        else
+        {
+            ASSERT_TRUE(value.has_value());
+            EXPECT_THAT(value.value(), Eq(i));
+        }
+    }
+}
+
+TEST_F(RuntimeNameIndex_test, ErasedSlotsCanBeReused)
+{
+    for (uint64_t round = 0U; round < 10U; ++round)
+    {
+        for (uint64_t i = 0U; i < CAPACITY; ++i)
+        {
+            ASSERT_TRUE(sut.insert(nameOf(round * CAPACITY + i), i));
+        }
+        for (uint64_t i = 0U; i < CAPACITY; ++i)
+        {
+            ASSERT_TRUE(sut.erase(nameOf(round * CAPACITY + i)));
+        }
+    }
+
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
+TEST_F(RuntimeNameIndex_test, ClearRemovesAllNames)
+{
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(sut.insert(nameOf(i), i));
+    }
+
+    sut.clear();
+
+    EXPECT_THAT(sut.size(), Eq(0U));
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        EXPECT_FALSE(sut.find(nameOf(i)).has_value());
+    }
+    EXPECT_TRUE(sut.insert(nameOf(0U), 0U));
+}
+
+TEST_F(RuntimeNameIndex_test, HashOfEqualNamesIsEqual)
+{
+    using Index_t = RuntimeNameIndex<uint64_t, CAPACITY>;
+    EXPECT_THAT(Index_t::hash(nameOf(7U)), Eq(Index_t::hash(nameOf(7U))));
+    EXPECT_THAT(Index_t::hash(nameOf(7U)), Ne(Index_t::hash(nameOf(8U))));
+}
+
+} // namespace
@@ -0,0 +1,112 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/roudi/memory/single_process_memory_provider.hpp"
+
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
+
+#include "mocks/roudi_memory_block_mock.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+
+using namespace iox::roudi;
+
+class SingleProcessMemoryProvider_Test : public Test
+{
+  public:
+    MemoryBlockMock memoryBlock1;
+};
+
+TEST_F(SingleProcessMemoryProvider_Test, CreateMemory)
+{
+    SingleProcessMemoryProvider sut;
+    ASSERT_FALSE(sut.addMemoryBlock(&memoryBlock1).has_error());
+    uint64_t MEMORY_SIZE{16};
+    uint64_t MEMORY_ALIGNMENT{8};
+    EXPECT_CALL(memoryBlock1, sizeMock()).WillRepeatedly(Return(MEMORY_SIZE));
+    EXPECT_CALL(memoryBlock1, alignmentMock()).WillRepeatedly(Return(MEMORY_ALIGNMENT));
+
+    ASSERT_THAT(sut.create().has_error(), Eq(false));
+
+    auto baseAddress = sut.baseAddress();
+    ASSERT_THAT(baseAddress.has_value(), Eq(true));
+    EXPECT_THAT(baseAddress.value(), Ne(nullptr));
+    EXPECT_THAT(sut.size(), Ge(MEMORY_SIZE));
+
+    EXPECT_CALL(memoryBlock1, destroyMock());
+}
+
+TEST_F(SingleProcessMemoryProvider_Test, CreatedMemoryIsWritable)
+{
+    SingleProcessMemoryProvider sut;
+    ASSERT_FALSE(sut.addMemoryBlock(&memoryBlock1).has_error());
+    uint64_t MEMORY_SIZE{64};
+    uint64_t MEMORY_ALIGNMENT{8};
+    EXPECT_CALL(memoryBlock1, sizeMock()).WillRepeatedly(Return(MEMORY_SIZE));
+    EXPECT_CALL(memoryBlock1, alignmentMock()).WillRepeatedly(Return(MEMORY_ALIGNMENT));
+
+    ASSERT_FALSE(sut.create().has_error());
+
+    auto memory = static_cast<uint8_t*>(sut.baseAddress().value());
+    for (uint64_t i = 0U; i < MEMORY_SIZE; ++i)
+    {
+        memory[i] = static_cast<uint8_t>(i);
+    }
+    for (uint64_t i = 0U; i < MEMORY_SIZE; ++i)
+    {
+        EXPECT_THAT(memory[i], Eq(static_cast<uint8_t>(i)));
+    }
+
+    EXPECT_CALL(memoryBlock1, destroyMock());
+}
+
+TEST_F(SingleProcessMemoryProvider_Test, DestroyMemory)
+{
+    SingleProcessMemoryProvider sut;
+    ASSERT_FALSE(sut.addMemoryBlock(&memoryBlock1).has_error());
+    uint64_t MEMORY_SIZE{16};
+    uint64_t MEMORY_ALIGNMENT{8};
+    EXPECT_CALL(memoryBlock1, sizeMock()).WillRepeatedly(Return(MEMORY_SIZE));
+    EXPECT_CALL(memoryBlock1, alignmentMock()).WillRepeatedly(Return(MEMORY_ALIGNMENT));
+
+    ASSERT_FALSE(sut.create().has_error());
+
+    EXPECT_CALL(memoryBlock1, destroyMock());
+
+    ASSERT_FALSE(sut.destroy().has_error());
+
+    EXPECT_THAT(sut.isAvailable(), Eq(false));
+}
+
+TEST_F(SingleProcessMemoryProvider_Test, CreationFailedWithAlignmentExceedingPageSize)
+{
+    SingleProcessMemoryProvider sut;
+    ASSERT_FALSE(sut.addMemoryBlock(&memoryBlock1).has_error());
+    uint64_t MEMORY_SIZE{16};
+    uint64_t MEMORY_ALIGNMENT{iox::posix::pageSize() + 8U};
+    EXPECT_CALL(memoryBlock1, sizeMock()).WillRepeatedly(Return(MEMORY_SIZE));
+    EXPECT_CALL(memoryBlock1, alignmentMock()).WillRepeatedly(Return(MEMORY_ALIGNMENT));
+
+    auto expectFailed = sut.create();
+    ASSERT_THAT(expectFailed.has_error(), Eq(true));
+    ASSERT_THAT(expectFailed.get_error(), Eq(MemoryProviderError::MEMORY_ALIGNMENT_EXCEEDS_PAGE_SIZE));
+}
+
+} // namespace